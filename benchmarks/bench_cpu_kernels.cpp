@@ -0,0 +1,161 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "bench_support.hpp"
+#include "platform/aligned_buffer.hpp"
+#include "platform/cpu_kernels.hpp"
+#include "platform/thread_pool.hpp"
+
+// Every kernel runs in three variants selected by range(0): 0 = naive reference, 1 = dispatched
+// SIMD on one thread, 2 = SIMD shared with a pool of (hardware threads - 1) workers. range(1) is
+// the element count: 64K floats stays in L2, 16M floats is DRAM-bound.
+namespace {
+    enum Variant { kReference = 0, kSimd = 1, kSimdPool = 2 };
+
+    platform::AlignedBuffer<float> random_buffer(std::size_t n, unsigned seed) {
+        std::mt19937 rng{seed};
+        std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+        platform::AlignedBuffer<float> buf(n);
+        for (auto &x : buf) {
+            x = dist(rng);
+        }
+        return buf;
+    }
+
+    platform::ThreadPool &shared_pool() {
+        static platform::ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+        return pool;
+    }
+
+    platform::KernelOptions options_for(benchmark::State &state) {
+        platform::KernelOptions options;
+        if (state.range(0) == kSimdPool) {
+            options.pool = &shared_pool();
+        }
+        return options;
+    }
+
+    const char *variant_label(benchmark::State &state) {
+        switch (state.range(0)) {
+            case kReference:
+                return "reference";
+            case kSimd:
+                return "simd";
+            default:
+                return "simd+pool";
+        }
+    }
+
+    // Runs `reference` or `optimized` per the variant and reports bytes moved per element.
+    template <class Ref, class Opt>
+    void run_kernel(benchmark::State &state, std::size_t bytes_per_element, const Ref &reference, const Opt &optimized) {
+        const auto options = options_for(state);
+        state.SetLabel(variant_label(state));
+        bench::PerfCounterReport perf(state);
+        for (auto _ : state) {
+            if (state.range(0) == kReference) {
+                reference();
+            } else {
+                optimized(options);
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+        state.SetBytesProcessed(state.iterations() * state.range(1) * static_cast<std::int64_t>(bytes_per_element));
+    }
+
+    void kernel_args(benchmark::internal::Benchmark *b) {
+        b->ArgNames({"variant", "n"})->ArgsProduct({{kReference, kSimd, kSimdPool}, {1 << 16, 1 << 24}})->UseRealTime();
+    }
+} // namespace
+
+static void BM_Kernel_ReduceSum(benchmark::State &state) {
+    const auto x = random_buffer(static_cast<std::size_t>(state.range(1)), 1);
+    run_kernel(
+        state, sizeof(float), [&] { benchmark::DoNotOptimize(platform::reference::reduce_sum(x)); },
+        [&](const platform::KernelOptions &o) { benchmark::DoNotOptimize(platform::reduce_sum(x, o)); });
+}
+BENCHMARK(BM_Kernel_ReduceSum)->Apply(kernel_args);
+
+static void BM_Kernel_Dot(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(1));
+    const auto a = random_buffer(n, 1), b = random_buffer(n, 2);
+    run_kernel(
+        state, 2 * sizeof(float), [&] { benchmark::DoNotOptimize(platform::reference::dot(a, b)); },
+        [&](const platform::KernelOptions &o) { benchmark::DoNotOptimize(platform::dot(a, b, o)); });
+}
+BENCHMARK(BM_Kernel_Dot)->Apply(kernel_args);
+
+static void BM_Kernel_InclusiveScan(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(1));
+    const auto x = random_buffer(n, 1);
+    platform::AlignedBuffer<float> out(n);
+    run_kernel(
+        state, 2 * sizeof(float), [&] { platform::reference::inclusive_scan(x, out); },
+        [&](const platform::KernelOptions &o) { platform::inclusive_scan(x, out, o); });
+}
+BENCHMARK(BM_Kernel_InclusiveScan)->Apply(kernel_args);
+
+static void BM_Kernel_Saxpy(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(1));
+    const auto x = random_buffer(n, 1);
+    auto y       = random_buffer(n, 2);
+    run_kernel(
+        state, 3 * sizeof(float), [&] { platform::reference::saxpy(1e-3f, x, y); },
+        [&](const platform::KernelOptions &o) { platform::saxpy(1e-3f, x, y, o); });
+}
+BENCHMARK(BM_Kernel_Saxpy)->Apply(kernel_args);
+
+static void BM_Kernel_Conv1d9(benchmark::State &state) {
+    const auto n    = static_cast<std::size_t>(state.range(1));
+    const auto x    = random_buffer(n + 8, 1);
+    const auto taps = random_buffer(9, 2);
+    platform::AlignedBuffer<float> out(n);
+    run_kernel(
+        state, 2 * sizeof(float), [&] { platform::reference::conv1d(x, taps, out); },
+        [&](const platform::KernelOptions &o) { platform::conv1d(x, taps, out, o); });
+}
+BENCHMARK(BM_Kernel_Conv1d9)->Apply(kernel_args);
+
+// Square image of n pixels with a 3x3 kernel.
+static void BM_Kernel_Conv2d3x3(benchmark::State &state) {
+    const auto n     = static_cast<std::size_t>(state.range(1));
+    const auto width = static_cast<std::size_t>(std::sqrt(static_cast<double>(n)));
+    const auto image = random_buffer(width * width, 1);
+    const auto k     = random_buffer(9, 2);
+    platform::AlignedBuffer<float> out((width - 2) * (width - 2));
+    run_kernel(
+        state, 2 * sizeof(float), [&] { platform::reference::conv2d(image, width, k, 3, out); },
+        [&](const platform::KernelOptions &o) { platform::conv2d(image, width, k, 3, out, o); });
+}
+BENCHMARK(BM_Kernel_Conv2d3x3)->Apply(kernel_args);
+
+static void BM_Kernel_Stencil5(benchmark::State &state) {
+    const auto n     = static_cast<std::size_t>(state.range(1));
+    const auto width = static_cast<std::size_t>(std::sqrt(static_cast<double>(n)));
+    const auto image = random_buffer(width * width, 1);
+    platform::AlignedBuffer<float> out(width * width);
+    const platform::Stencil5 weights{0.5f, 0.125f, 0.125f, 0.125f, 0.125f};
+    run_kernel(
+        state, 2 * sizeof(float), [&] { platform::reference::stencil5(image, width, weights, out); },
+        [&](const platform::KernelOptions &o) { platform::stencil5(image, width, weights, out, o); });
+}
+BENCHMARK(BM_Kernel_Stencil5)->Apply(kernel_args);
+
+// Four chained multiply-adds: the reference makes one pass per step, the kernel one in total.
+static void BM_Kernel_FusedAffine4(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(1));
+    const auto x = random_buffer(n, 1);
+    platform::AlignedBuffer<float> out(n);
+    const std::vector<platform::AffineStep> steps{{1.01f, 0.1f}, {0.99f, -0.1f}, {1.5f, 0.0f}, {0.5f, 0.25f}};
+    run_kernel(
+        state, 2 * sizeof(float), [&] { platform::reference::fused_affine(x, steps, out); },
+        [&](const platform::KernelOptions &o) { platform::fused_affine(x, steps, out, o); });
+}
+BENCHMARK(BM_Kernel_FusedAffine4)->Apply(kernel_args);
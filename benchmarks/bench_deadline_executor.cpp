@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+#include "bench_support.hpp"
+#include "platform/deadline_executor.hpp"
+#include "platform/latency_histogram.hpp"
+#include "platform/thread_pool.hpp"
+
+// Mixed load: each iteration submits a burst of 64 jobs at once, one in eight a short control job
+// (2us of work, due 200us after submission) and the rest 10us background jobs due in 20ms. A FIFO
+// ThreadPool runs them in arrival order; the EDF executor runs control jobs first. Both run late
+// jobs, and each job checks its own finish time against its deadline. Reports the share of
+// control and background jobs that missed, plus control submit-to-finish latency percentiles.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int kBurst        = 64;
+    constexpr int kControlEvery = 8;
+    constexpr std::chrono::microseconds kControlBudget{200};
+    constexpr std::chrono::microseconds kBackgroundBudget{20000};
+
+    void spin_for(std::chrono::nanoseconds work) {
+        const auto until = Clock::now() + work;
+        while (Clock::now() < until) {
+        }
+    }
+
+    struct MixedLoad {
+        std::atomic<int> done{0};
+        std::atomic<std::int64_t> control_misses{0};
+        std::atomic<std::int64_t> background_misses{0};
+        platform::LatencyHistogram control_latency;
+        std::int64_t bursts{0};
+
+        // Submits one burst through `submit(deadline, job)` and waits until every job has run.
+        template <class Submit> void submit_burst(Submit submit) {
+            done.store(0, std::memory_order_relaxed);
+            const auto submitted = Clock::now();
+            for (int i = 0; i < kBurst; ++i) {
+                const bool control  = i % kControlEvery == kControlEvery - 1;
+                const std::chrono::microseconds budget = control ? kControlBudget : kBackgroundBudget;
+                const auto deadline                    = submitted + budget;
+                const auto work = control ? std::chrono::microseconds(2) : std::chrono::microseconds(10);
+                submit(deadline, [this, control, deadline, submitted, work] {
+                    spin_for(work);
+                    const auto finished = Clock::now();
+                    if (finished > deadline) {
+                        (control ? control_misses : background_misses).fetch_add(1, std::memory_order_relaxed);
+                    }
+                    if (control) {
+                        control_latency.record(static_cast<std::uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(finished - submitted).count()));
+                    }
+                    done.fetch_add(1, std::memory_order_release);
+                });
+            }
+            while (done.load(std::memory_order_acquire) < kBurst) {
+                std::this_thread::yield();
+            }
+            ++bursts;
+        }
+
+        void report(benchmark::State &state) {
+            const auto per_burst  = kBurst / kControlEvery;
+            const auto control    = static_cast<double>(std::max<std::int64_t>(bursts * per_burst, 1));
+            const auto background = static_cast<double>(std::max<std::int64_t>(bursts * (kBurst - per_burst), 1));
+            state.counters["control_miss"]    = static_cast<double>(control_misses.load()) / control;
+            state.counters["background_miss"] = static_cast<double>(background_misses.load()) / background;
+            state.SetItemsProcessed(bursts * kBurst);
+            bench::report_percentiles(state, control_latency);
+        }
+    };
+} // namespace
+
+static void BM_MixedDeadlines_Fifo(benchmark::State &state) {
+    platform::ThreadPool pool(static_cast<std::size_t>(state.range(0)), 1024);
+    MixedLoad load;
+    for (auto _ : state) {
+        load.submit_burst([&](Clock::time_point, std::function<void()> job) { pool.enqueue(std::move(job)); });
+    }
+    pool.shutdown();
+    load.report(state);
+}
+BENCHMARK(BM_MixedDeadlines_Fifo)->ArgName("workers")->Arg(1)->Arg(2)->UseRealTime();
+
+static void BM_MixedDeadlines_Edf(benchmark::State &state) {
+    platform::DeadlineExecutor executor({.threads = static_cast<std::size_t>(state.range(0))});
+    MixedLoad load;
+    for (auto _ : state) {
+        load.submit_burst([&](Clock::time_point deadline, std::function<void()> job) {
+            executor.submit(deadline, std::move(job), platform::LatePolicy::kRun);
+        });
+    }
+    executor.shutdown();
+    load.report(state);
+}
+BENCHMARK(BM_MixedDeadlines_Edf)->ArgName("workers")->Arg(1)->Arg(2)->UseRealTime();
+
+// Submit-to-run cost of an empty job with one submitter and one worker; range(0) sweeps shards.
+static void BM_DeadlineExecutor_SubmitToRun(benchmark::State &state) {
+    platform::DeadlineExecutor executor({.threads = 1, .shards = static_cast<std::size_t>(state.range(0))});
+    std::atomic<std::int64_t> ran{0};
+    std::int64_t submitted = 0;
+    for (auto _ : state) {
+        executor.submit(Clock::now() + std::chrono::seconds(1),
+                        [&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+        ++submitted;
+        if (submitted % 512 == 0) {
+            while (ran.load(std::memory_order_relaxed) < submitted) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    while (ran.load(std::memory_order_relaxed) < submitted) {
+        std::this_thread::yield();
+    }
+    state.SetItemsProcessed(submitted);
+}
+BENCHMARK(BM_DeadlineExecutor_SubmitToRun)->ArgName("shards")->Arg(1)->Arg(4)->UseRealTime();
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "platform/aligned_buffer.hpp"
+#include "platform/cuda_stage.hpp"
+#include "platform/expr.hpp"
+#include "platform/thread_pool.hpp"
+
+// A chain of K elementwise adds over K + 1 inputs. range(0) selects the variant: 0 = unfused
+// vector_add_cpu calls with a temporary std::vector per intermediate, 1 = fused expression on one
+// thread, 2 = fused across a pool of (hardware threads - 1) workers. range(1) is the element
+// count. Bytes processed counts only the unavoidable traffic (K + 1 reads and one write per
+// element), so the unfused variant's extra passes show up as lower bandwidth.
+namespace {
+    enum Variant { kUnfused = 0, kFused = 1, kFusedPool = 2 };
+
+    platform::ThreadPool &shared_pool() {
+        static platform::ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+        return pool;
+    }
+
+    template <std::size_t... I>
+    void eval_fused(const std::vector<platform::AlignedBuffer<float>> &in, std::span<float> out,
+                    const platform::KernelOptions &options, std::index_sequence<I...>) {
+        using platform::expr::view;
+        platform::expr::eval((view(in[I]) + ...), out, options);
+    }
+
+    void eval_unfused(const std::vector<platform::AlignedBuffer<float>> &in, std::span<float> out) {
+        std::vector<float> acc(in[0].begin(), in[0].end());
+        for (std::size_t k = 1; k + 1 < in.size(); ++k) {
+            std::vector<float> next(acc.size());
+            platform::vector_add_cpu(acc, in[k], next);
+            acc = std::move(next);
+        }
+        platform::vector_add_cpu(acc, in.back(), out);
+    }
+} // namespace
+
+template <std::size_t K> static void BM_ExprAddChain(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(1));
+    std::vector<platform::AlignedBuffer<float>> in;
+    for (std::size_t k = 0; k <= K; ++k) {
+        in.emplace_back(n);
+        std::fill(in.back().begin(), in.back().end(), static_cast<float>(k));
+    }
+    platform::AlignedBuffer<float> out(n);
+    platform::KernelOptions options;
+    if (state.range(0) == kFusedPool) {
+        options.pool = &shared_pool();
+    }
+    for (auto _ : state) {
+        if (state.range(0) == kUnfused) {
+            eval_unfused(in, out);
+        } else {
+            eval_fused(in, out, options, std::make_index_sequence<K + 1>{});
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(state.range(0) == kUnfused ? "unfused" : state.range(0) == kFused ? "fused" : "fused_pool");
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+    state.SetBytesProcessed(state.iterations() * state.range(1) * static_cast<std::int64_t>((K + 2) * sizeof(float)));
+}
+BENCHMARK_TEMPLATE(BM_ExprAddChain, 2)
+    ->ArgNames({"variant", "n"})
+    ->ArgsProduct({{kUnfused, kFused, kFusedPool}, {1 << 16, 1 << 22}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ExprAddChain, 4)
+    ->ArgNames({"variant", "n"})
+    ->ArgsProduct({{kUnfused, kFused, kFusedPool}, {1 << 16, 1 << 22}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ExprAddChain, 8)
+    ->ArgNames({"variant", "n"})
+    ->ArgsProduct({{kUnfused, kFused, kFusedPool}, {1 << 16, 1 << 22}})
+    ->UseRealTime();
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "bench_support.hpp"
+#include "platform/latency_histogram.hpp"
+
+namespace {
+    std::vector<std::uint64_t> make_samples(std::size_t n) {
+        std::mt19937_64 rng{7};
+        std::lognormal_distribution<double> dist{11.0, 0.6};
+        std::vector<std::uint64_t> samples(n);
+        for (auto &s : samples) {
+            s = static_cast<std::uint64_t>(dist(rng));
+        }
+        return samples;
+    }
+} // namespace
+
+static void BM_LatencyHistogram_Record(benchmark::State &state) {
+    const auto samples = make_samples(4096);
+    platform::LatencyHistogram hist(platform::LatencyHistogram::kDefaultHighest, static_cast<int>(state.range(0)));
+    std::size_t i = 0;
+    bench::PerfCounterReport perf(state);
+    for (auto _ : state) {
+        hist.record(samples[i++ & 4095]);
+    }
+    benchmark::DoNotOptimize(hist.count());
+    state.counters["bytes"] = static_cast<double>(hist.memory_bytes());
+}
+BENCHMARK(BM_LatencyHistogram_Record)->Arg(1)->Arg(2)->Arg(3);
+
+// Recording N samples then querying p50/p95/p99, as a 200 Hz stream over `N / 200` seconds.
+static void BM_LatencyHistogram_RecordAndQuery(benchmark::State &state) {
+    const auto samples = make_samples(static_cast<std::size_t>(state.range(0)));
+    platform::LatencyHistogram hist;
+    for (auto _ : state) {
+        hist.reset();
+        for (auto s : samples) {
+            hist.record(s);
+        }
+        benchmark::DoNotOptimize(hist.percentile(50.0) + hist.percentile(95.0) + hist.percentile(99.0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["bytes"] = static_cast<double>(hist.memory_bytes());
+}
+BENCHMARK(BM_LatencyHistogram_RecordAndQuery)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+
+// Baseline: the module 05 approach of storing every sample, copying and sorting.
+static void BM_SortPercentiles_RecordAndQuery(benchmark::State &state) {
+    const auto samples = make_samples(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> stored;
+    for (auto _ : state) {
+        stored.clear();
+        for (auto s : samples) {
+            stored.push_back(s);
+        }
+        auto sorted = stored;
+        std::sort(sorted.begin(), sorted.end());
+        benchmark::DoNotOptimize(sorted[sorted.size() / 2] + sorted[sorted.size() * 95 / 100] +
+                                 sorted[sorted.size() * 99 / 100]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["bytes"] = static_cast<double>(2 * stored.capacity() * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SortPercentiles_RecordAndQuery)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
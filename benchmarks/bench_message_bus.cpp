@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+
+#include "bench_support.hpp"
+#include "platform/latency_histogram.hpp"
+#include "platform/message_bus.hpp"
+
+namespace {
+    platform::MessageBus g_bus;
+    std::atomic<std::uint64_t> g_delivered{0};
+} // namespace
+
+// Publish cost with range(0) subscribers on the topic; Threads() sweeps concurrent publishers
+// contending on the bus's shared lock.
+static void BM_MessageBus_Publish(benchmark::State &state) {
+    using Clock = std::chrono::steady_clock;
+    const auto subscribers = static_cast<std::size_t>(state.range(0));
+    std::vector<platform::SubscriptionId> ids;
+    if (state.thread_index() == 0) {
+        for (std::size_t i = 0; i < subscribers; ++i) {
+            ids.push_back(g_bus.subscribe("bench.topic", [](const platform::Message &) {
+                g_delivered.fetch_add(1, std::memory_order_relaxed);
+            }));
+        }
+    }
+    const platform::Message msg{.topic = "bench.topic", .payload = "imu:1.000000"};
+    platform::LatencyHistogram hist;
+    for (auto _ : state) {
+        const auto start = Clock::now();
+        g_bus.publish(msg);
+        hist.record(Clock::now() - start);
+    }
+    if (state.thread_index() == 0) {
+        for (auto id : ids) {
+            g_bus.unsubscribe(id);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    state.counters["fanout"] = static_cast<double>(subscribers);
+    bench::report_percentiles(state, hist);
+}
+BENCHMARK(BM_MessageBus_Publish)->ArgName("subscribers")->RangeMultiplier(4)->Range(1, 64)->ThreadRange(1, 8);
@@ -0,0 +1,244 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "bench_support.hpp"
+#include "platform/logging.hpp"
+#include "platform/pipeline.hpp"
+
+// Full sensor -> perception -> control latency at range(0) ms sensor period with range(1) pool
+// workers. Each iteration runs the pipeline for a fixed window and reads the pipeline's own
+// `pipeline_sensor_to_actuator_ns` histogram.
+static void BM_Pipeline_SensorToActuator(benchmark::State &state) {
+    constexpr auto kWindow = std::chrono::milliseconds(400);
+    platform::set_log_level(platform::LogLevel::kError);
+    std::size_t processed = 0;
+    platform::HistogramSnapshot latency;
+    for (auto _ : state) {
+        platform::Pipeline pipeline(platform::PipelineOptions{
+            .sensor_period  = std::chrono::milliseconds(state.range(0)),
+            .worker_threads = static_cast<std::size_t>(state.range(1)),
+        });
+        pipeline.start();
+        std::this_thread::sleep_for(kWindow);
+        pipeline.stop();
+        processed += pipeline.processed_samples();
+        const auto snap = pipeline.metrics().snapshot();
+        if (const auto *h = snap.find_histogram("pipeline_sensor_to_actuator_ns")) {
+            latency = h->data;
+        }
+    }
+    platform::set_log_level(platform::LogLevel::kInfo);
+    state.SetItemsProcessed(static_cast<std::int64_t>(processed));
+    bench::report_percentiles(state, latency);
+}
+BENCHMARK(BM_Pipeline_SensorToActuator)
+    ->ArgNames({"period_ms", "workers"})
+    ->Args({20, 1})
+    ->Args({5, 1})
+    ->Args({5, 4})
+    ->Args({1, 1})
+    ->Args({1, 4})
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Throughput as the sensor count grows: range(0) sensors, each publishing every 1 ms, with both
+// stages at placement range(1) (0 = inline, 1 = pool, 2 = dedicated) on two pool workers.
+// items_per_second is perception throughput; `dropped` counts samples that never reached it
+// within the window (backlog at stop).
+static void BM_Pipeline_SensorScaling(benchmark::State &state) {
+    constexpr auto kWindow = std::chrono::milliseconds(300);
+    const auto sensors     = static_cast<std::size_t>(state.range(0));
+    const auto placement   = static_cast<platform::StagePlacement>(state.range(1));
+    platform::set_log_level(platform::LogLevel::kError);
+    std::size_t processed   = 0;
+    std::uint64_t published = 0;
+    platform::HistogramSnapshot latency;
+    for (auto _ : state) {
+        platform::PipelineOptions options{.worker_threads = 2};
+        for (std::size_t i = 0; i < sensors; ++i) {
+            options.sensors.push_back({.name = "s" + std::to_string(i), .period = std::chrono::milliseconds(1)});
+        }
+        options.stages = {
+            {.name         = "perception",
+             .input_topics = {"sensor.raw"},
+             .output_topic = "control.cmd",
+             .placement    = placement},
+            {.name         = "control",
+             .kind         = platform::StageKind::kControl,
+             .input_topics = {"control.cmd"},
+             .placement    = placement},
+        };
+        platform::Pipeline pipeline(options);
+        pipeline.start();
+        std::this_thread::sleep_for(kWindow);
+        pipeline.stop();
+        processed += pipeline.processed_samples();
+        const auto snap = pipeline.metrics().snapshot();
+        if (const auto *c = snap.find_counter("bus_published_total{topic=\"sensor.raw\"}")) {
+            published += c->value;
+        }
+        if (const auto *h = snap.find_histogram("pipeline_sensor_to_actuator_ns")) {
+            latency = h->data;
+        }
+    }
+    platform::set_log_level(platform::LogLevel::kInfo);
+    state.SetItemsProcessed(static_cast<std::int64_t>(processed));
+    state.counters["dropped"] = static_cast<double>(published - processed);
+    state.SetLabel(platform::to_string(placement));
+    bench::report_percentiles(state, latency);
+}
+BENCHMARK(BM_Pipeline_SensorScaling)
+    ->ArgNames({"sensors", "placement"})
+    ->ArgsProduct({{1, 8, 32, 128}, {0, 1, 2}})
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+namespace {
+    // Perception at range(0) samples per batch; 1 is the per-sample path, one pool job per sample.
+    platform::PipelineOptions batching_options(std::int64_t batch, std::chrono::microseconds flush,
+                                               std::size_t capacity) {
+        const bool per_sample = batch <= 1;
+        platform::PipelineOptions options{.worker_threads = 1, .queue_capacity = capacity};
+        options.stages = {
+            {.name         = "perception",
+             .input_topics = {"sensor.raw"},
+             .output_topic = "control.cmd",
+             .placement    = per_sample ? platform::StagePlacement::kPool : platform::StagePlacement::kDedicated,
+             .batch_size   = per_sample ? 1 : static_cast<std::size_t>(batch),
+             .batch_flush  = flush},
+            {.name         = "control",
+             .kind         = platform::StageKind::kControl,
+             .input_topics = {"control.cmd"},
+             .placement    = platform::StagePlacement::kInline},
+        };
+        return options;
+    }
+} // namespace
+
+// Perception throughput: the benchmark thread publishes kSamples text samples back to back and
+// the time runs until perception has processed all of them. Queues are sized so nothing drops.
+static void BM_Pipeline_PerceptionBatching(benchmark::State &state) {
+    constexpr std::size_t kSamples = 20000;
+    platform::set_log_level(platform::LogLevel::kError);
+    std::size_t processed = 0;
+    for (auto _ : state) {
+        auto options    = batching_options(state.range(0), std::chrono::microseconds(500), kSamples);
+        options.sensors = {{.name = "imu", .period = std::chrono::hours(1)}};
+        platform::Pipeline pipeline(options);
+        pipeline.start();
+        while (pipeline.processed_samples() == 0) {
+            std::this_thread::yield();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < kSamples; ++i) {
+            pipeline.bus().publish("sensor.raw", "imu:1.0");
+        }
+        while (pipeline.processed_samples() < kSamples + 1) {
+            std::this_thread::yield();
+        }
+        state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        pipeline.stop();
+        processed += kSamples;
+    }
+    platform::set_log_level(platform::LogLevel::kInfo);
+    state.SetItemsProcessed(static_cast<std::int64_t>(processed));
+}
+BENCHMARK(BM_Pipeline_PerceptionBatching)
+    ->ArgName("batch")
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Added latency at sensor rates: 8 sensors every 1 ms feed perception per sample on the pool
+// (batch 1) or batched 64 at a time with a range(1) us flush bound. At 8 samples/ms a batch of 64
+// rarely fills, so the flush timer sets the extra latency.
+static void BM_Pipeline_BatchFlushLatency(benchmark::State &state) {
+    constexpr auto kWindow = std::chrono::milliseconds(300);
+    platform::set_log_level(platform::LogLevel::kError);
+    std::size_t processed = 0;
+    platform::HistogramSnapshot latency;
+    for (auto _ : state) {
+        auto options = batching_options(state.range(0), std::chrono::microseconds(state.range(1)), 256);
+        for (int i = 0; i < 8; ++i) {
+            options.sensors.push_back({.name = "s" + std::to_string(i), .period = std::chrono::milliseconds(1)});
+        }
+        platform::Pipeline pipeline(options);
+        pipeline.start();
+        std::this_thread::sleep_for(kWindow);
+        pipeline.stop();
+        processed += pipeline.processed_samples();
+        const auto snap = pipeline.metrics().snapshot();
+        if (const auto *h = snap.find_histogram("pipeline_sensor_to_actuator_ns")) {
+            latency = h->data;
+        }
+    }
+    platform::set_log_level(platform::LogLevel::kInfo);
+    state.SetItemsProcessed(static_cast<std::int64_t>(processed));
+    bench::report_percentiles(state, latency);
+}
+BENCHMARK(BM_Pipeline_BatchFlushLatency)
+    ->ArgNames({"batch", "flush_us"})
+    ->Args({1, 0})
+    ->Args({64, 250})
+    ->Args({64, 1000})
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Overload: 128 sensors at 1 kHz into one worker and an 8-slot pool queue, with perception
+// shedding by policy range(0) (0 = block, 1 = drop_newest, 3 = coalesce) and control coalescing
+// at high priority. `published` shows whether the sensor thread kept its schedule; `shed` counts
+// perception samples dropped instead.
+static void BM_Pipeline_Overload(benchmark::State &state) {
+    constexpr auto kWindow = std::chrono::milliseconds(300);
+    const auto policy      = static_cast<platform::ShedPolicy>(state.range(0));
+    platform::set_log_level(platform::LogLevel::kError);
+    std::uint64_t published = 0;
+    std::uint64_t shed      = 0;
+    std::size_t processed   = 0;
+    platform::HistogramSnapshot latency;
+    for (auto _ : state) {
+        platform::PipelineOptions options{.worker_threads = 1, .queue_capacity = 8};
+        for (int i = 0; i < 128; ++i) {
+            options.sensors.push_back({.name = "s" + std::to_string(i), .period = std::chrono::milliseconds(1)});
+        }
+        options.stages = {
+            {.name = "perception", .input_topics = {"sensor.raw"}, .output_topic = "control.cmd", .shed = policy},
+            {.name         = "control",
+             .kind         = platform::StageKind::kControl,
+             .input_topics = {"control.cmd"},
+             .shed         = platform::ShedPolicy::kCoalesce,
+             .priority     = platform::JobPriority::kHigh},
+        };
+        platform::Pipeline pipeline(options);
+        pipeline.start();
+        std::this_thread::sleep_for(kWindow);
+        pipeline.stop();
+        processed += pipeline.processed_samples();
+        const auto snap = pipeline.metrics().snapshot();
+        if (const auto *c = snap.find_counter("bus_published_total{topic=\"sensor.raw\"}")) {
+            published += c->value;
+        }
+        if (const auto *c = snap.find_counter("pipeline_shed_total{stage=\"perception\"}")) {
+            shed += c->value;
+        }
+        if (const auto *h = snap.find_histogram("pipeline_sensor_to_actuator_ns")) {
+            latency = h->data;
+        }
+    }
+    platform::set_log_level(platform::LogLevel::kInfo);
+    state.SetItemsProcessed(static_cast<std::int64_t>(processed));
+    state.counters["published"] = static_cast<double>(published);
+    state.counters["shed"]      = static_cast<double>(shed);
+    state.SetLabel(platform::to_string(policy));
+    bench::report_percentiles(state, latency);
+}
+BENCHMARK(BM_Pipeline_Overload)->Arg(0)->Arg(1)->Arg(3)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
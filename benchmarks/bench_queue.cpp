@@ -1,9 +1,17 @@
 #include <benchmark/benchmark.h>
 
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include "bench_support.hpp"
 #include "platform/bounded_queue.hpp"
+#include "platform/latency_histogram.hpp"
 
 static void BM_BoundedQueue_PushPop(benchmark::State& state) {
     platform::BoundedQueue<int> q(static_cast<std::size_t>(state.range(0)));
+    bench::PerfCounterReport perf(state);
     for (auto _ : state) {
         q.push(1);
         auto v = q.pop();
@@ -12,5 +20,107 @@ static void BM_BoundedQueue_PushPop(benchmark::State& state) {
 }
 BENCHMARK(BM_BoundedQueue_PushPop)->Arg(64)->Arg(256)->Arg(1024);
 
-BENCHMARK_MAIN();
+// Round-trips a heap-owning payload by move, so the steady state performs no allocation. Extra
+// copies in the push path (see PLATFORM_FAILURE_PERF) show up directly as malloc + memcpy.
+static void BM_BoundedQueue_PushPopMove(benchmark::State& state) {
+    platform::BoundedQueue<std::vector<int>> q(64);
+    std::vector<int> payload(static_cast<std::size_t>(state.range(0)), 1);
+    for (auto _ : state) {
+        q.push(std::move(payload));
+        payload = std::move(*q.pop());
+        benchmark::DoNotOptimize(payload.data());
+    }
+}
+BENCHMARK(BM_BoundedQueue_PushPopMove)->Arg(64)->Arg(4096);
 
+// Contended MPMC throughput: range(0) producers and range(1) consumers share one queue. Each item
+// carries its push time so consumers can report queue residency percentiles.
+static void BM_BoundedQueue_MPMC(benchmark::State& state) {
+    using Clock = std::chrono::steady_clock;
+    const auto producers = static_cast<std::size_t>(state.range(0));
+    const auto consumers = static_cast<std::size_t>(state.range(1));
+    constexpr std::size_t kItemsPerProducer = 20'000;
+    platform::LatencyHistogram merged;
+    for (auto _ : state) {
+        platform::BoundedQueue<Clock::time_point> q(1024);
+        std::vector<platform::LatencyHistogram> hists(consumers);
+        std::vector<std::jthread> consumer_threads;
+        for (std::size_t c = 0; c < consumers; ++c) {
+            consumer_threads.emplace_back([&q, &hist = hists[c]]() {
+                while (auto pushed_at = q.pop()) {
+                    hist.record(Clock::now() - *pushed_at);
+                }
+            });
+        }
+        {
+            std::vector<std::jthread> producer_threads;
+            for (std::size_t p = 0; p < producers; ++p) {
+                producer_threads.emplace_back([&q]() {
+                    for (std::size_t i = 0; i < kItemsPerProducer; ++i) {
+                        q.push(Clock::now());
+                    }
+                });
+            }
+        }
+        q.close();
+        consumer_threads.clear();
+        for (const auto& h : hists) {
+            merged.merge(h);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(producers * kItemsPerProducer));
+    bench::report_percentiles(state, merged);
+}
+BENCHMARK(BM_BoundedQueue_MPMC)
+    ->ArgNames({"producers", "consumers"})
+    ->Args({1, 1})
+    ->Args({2, 2})
+    ->Args({4, 4})
+    ->Args({8, 8})
+    ->Args({4, 1})
+    ->Args({1, 4})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Wake-to-run latency and CPU burn of one consumer on an otherwise idle queue, per wait strategy
+// (range(0): 0 block, 1 spin_park with the default 50 us budget, 2 spin) and message rate (range(1),
+// Hz). Each iteration pushes one timestamped message on schedule; cpu_pct is process CPU time,
+// nearly all of it the consumer's, over wall time. Once the gap between messages exceeds the spin
+// budget spin_park parks like block; spin buys its latency with a whole core at every rate.
+static void BM_BoundedQueue_WakeToRun(benchmark::State& state) {
+    using Clock       = std::chrono::steady_clock;
+    const auto mode   = static_cast<platform::WaitMode>(state.range(0));
+    const auto period = std::chrono::nanoseconds(1'000'000'000 / state.range(1));
+    platform::BoundedQueue<Clock::time_point> q(64, {.mode = mode});
+    platform::LatencyHistogram hist;
+    std::jthread consumer([&q, &hist]() {
+        while (auto pushed_at = q.pop()) {
+            hist.record(Clock::now() - *pushed_at);
+        }
+    });
+    const std::clock_t cpu_started = std::clock();
+    const auto wall_started        = Clock::now();
+    auto next                      = wall_started;
+    for (auto _ : state) {
+        next += period;
+        std::this_thread::sleep_until(next);
+        q.push(Clock::now());
+    }
+    q.close();
+    consumer.join();
+    const double cpu_s  = static_cast<double>(std::clock() - cpu_started) / CLOCKS_PER_SEC;
+    const double wall_s = std::chrono::duration<double>(Clock::now() - wall_started).count();
+
+    state.counters["cpu_pct"] = 100.0 * cpu_s / wall_s;
+    state.SetLabel(platform::to_string(mode));
+    bench::report_percentiles(state, hist);
+}
+BENCHMARK(BM_BoundedQueue_WakeToRun)
+    ->ArgNames({"wait", "hz"})
+    ->ArgsProduct({{0, 1, 2}, {200, 2000, 20000}})
+    ->Iterations(400)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_support.hpp"
+#include "platform/latency_histogram.hpp"
+#include "platform/scheduler.hpp"
+
+// Tick jitter: lateness of each tick relative to its ideal release time start + k * period.
+// range(0) is the period in ms; range(1) runs that many schedulers concurrently to expose
+// wakeup contention.
+static void BM_Scheduler_Jitter(benchmark::State &state) {
+    using Clock = std::chrono::steady_clock;
+    constexpr std::size_t kTicks = 100;
+    const std::chrono::milliseconds period(state.range(0));
+    const auto scheduler_count = static_cast<std::size_t>(state.range(1));
+    platform::LatencyHistogram hist;
+    for (auto _ : state) {
+        std::vector<std::vector<Clock::time_point>> ticks(scheduler_count, std::vector<Clock::time_point>(kTicks));
+        std::vector<std::atomic<std::size_t>> counts(scheduler_count);
+        {
+            std::vector<std::unique_ptr<platform::Scheduler>> schedulers;
+            for (std::size_t s = 0; s < scheduler_count; ++s) {
+                schedulers.push_back(std::make_unique<platform::Scheduler>());
+                schedulers.back()->start(period, [&tick = ticks[s], &count = counts[s]]() {
+                    const auto n = count.load(std::memory_order_relaxed);
+                    if (n < kTicks) {
+                        tick[n] = Clock::now();
+                        count.store(n + 1, std::memory_order_release);
+                    }
+                });
+            }
+            for (auto &count : counts) {
+                while (count.load(std::memory_order_acquire) < kTicks) {
+                    std::this_thread::sleep_for(period);
+                }
+            }
+        }
+        for (const auto &tick : ticks) {
+            for (std::size_t k = 1; k < kTicks; ++k) {
+                hist.record(tick[k] - (tick[0] + period * static_cast<long>(k)));
+            }
+        }
+    }
+    bench::report_percentiles(state, hist);
+}
+BENCHMARK(BM_Scheduler_Jitter)
+    ->ArgNames({"period_ms", "schedulers"})
+    ->Args({1, 1})
+    ->Args({1, 4})
+    ->Args({1, 16})
+    ->Args({5, 1})
+    ->Args({5, 16})
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,149 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include "platform/serial_bridge.hpp"
+#include "platform/wire_format.hpp"
+
+// Serial bridge over a PTY pair. The "MCU" writes framed 48-byte sensor records into the master;
+// the bridge reads the slave, decodes and publishes on sensor.raw, and a subscriber counts
+// arrivals. BM_PtyHandoffLatency is the same one-way trip with a plain blocking reader thread in
+// place of the bridge, so the difference to BM_SerialBridgeLatency is what epoll, decoding and
+// publishing add per frame.
+namespace {
+    std::string sensor_frame(std::uint32_t sequence) {
+        char record[sizeof(platform::wire::SensorSampleRecord)];
+        const std::size_t size = platform::wire::encode_sensor_sample(record, "imu", 1.5, 1'000, sequence);
+        std::string out(platform::serial::max_frame_size(size), '\0');
+        out.resize(platform::serial::encode_frame(std::span<const char>(record, size), out));
+        return out;
+    }
+
+    bool write_all(int fd, const std::string &bytes) {
+        std::size_t done = 0;
+        while (done < bytes.size()) {
+            const ssize_t n = ::write(fd, bytes.data() + done, bytes.size() - done);
+            if (n <= 0) {
+                return false;
+            }
+            done += static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    void wait_for(const std::atomic<std::uint64_t> &counter, std::uint64_t target) {
+        for (std::uint64_t seen = counter.load(); seen < target; seen = counter.load()) {
+            counter.wait(seen);
+        }
+    }
+} // namespace
+
+// Arg: frames written per burst.
+static void BM_SerialBridgeThroughput(benchmark::State &state) {
+    auto pair = platform::SerialPort::open_pty_pair();
+    if (!pair) {
+        state.SkipWithError("pseudo-terminals unavailable");
+        return;
+    }
+    const int mcu = pair->first.fd();
+    platform::MessageBus bus;
+    std::atomic<std::uint64_t> received{0};
+    bus.subscribe("sensor.raw", [&](const platform::Message &) {
+        received.fetch_add(1);
+        received.notify_one();
+    });
+    platform::SerialBridge bridge(bus, std::move(pair->second));
+    bridge.start();
+
+    const auto burst = static_cast<std::uint64_t>(state.range(0));
+    std::string stream;
+    for (std::uint64_t i = 0; i < burst; ++i) {
+        stream += sensor_frame(static_cast<std::uint32_t>(i));
+    }
+    std::uint64_t expected = 0;
+    for (auto _ : state) {
+        if (!write_all(mcu, stream)) {
+            state.SkipWithError("write failed");
+            break;
+        }
+        expected += burst;
+        wait_for(received, expected);
+    }
+    bridge.stop();
+    state.SetItemsProcessed(static_cast<std::int64_t>(expected));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(stream.size()));
+    state.counters["decode_errors"] = static_cast<double>(bridge.stats().decode_errors);
+}
+BENCHMARK(BM_SerialBridgeThroughput)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+
+static void BM_SerialBridgeLatency(benchmark::State &state) {
+    auto pair = platform::SerialPort::open_pty_pair();
+    if (!pair) {
+        state.SkipWithError("pseudo-terminals unavailable");
+        return;
+    }
+    const int mcu = pair->first.fd();
+    platform::MessageBus bus;
+    std::atomic<std::uint64_t> received{0};
+    bus.subscribe("sensor.raw", [&](const platform::Message &) {
+        received.fetch_add(1);
+        received.notify_one();
+    });
+    platform::SerialBridge bridge(bus, std::move(pair->second));
+    bridge.start();
+
+    const std::string frame = sensor_frame(0);
+    std::uint64_t expected  = 0;
+    for (auto _ : state) {
+        write_all(mcu, frame);
+        wait_for(received, ++expected);
+    }
+    bridge.stop();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SerialBridgeLatency)->UseRealTime();
+
+static void BM_PtyHandoffLatency(benchmark::State &state) {
+    auto pair = platform::SerialPort::open_pty_pair();
+    if (!pair) {
+        state.SkipWithError("pseudo-terminals unavailable");
+        return;
+    }
+    const int mcu           = pair->first.fd();
+    const int host          = pair->second.fd();
+    const std::string frame = sensor_frame(0);
+    std::atomic<std::uint64_t> received{0};
+    std::jthread reader([&](std::stop_token st) {
+        char buffer[256];
+        std::size_t bytes = 0;
+        while (!st.stop_requested()) {
+            const ssize_t n = ::read(host, buffer, sizeof(buffer));
+            if (n <= 0) {
+                return;
+            }
+            bytes += static_cast<std::size_t>(n);
+            if (bytes >= frame.size()) {
+                bytes -= frame.size();
+                received.fetch_add(1);
+                received.notify_one();
+            }
+        }
+    });
+
+    std::uint64_t expected = 0;
+    for (auto _ : state) {
+        write_all(mcu, frame);
+        wait_for(received, ++expected);
+    }
+    reader.request_stop();
+    // Unblock the reader's read() with one more frame.
+    write_all(mcu, frame);
+    reader.join();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PtyHandoffLatency)->UseRealTime();
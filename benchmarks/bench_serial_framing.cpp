@@ -0,0 +1,149 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "platform/serial_framing.hpp"
+
+// Serial link framing: the module 09 text frame ("<payload>|CS=<n>", additive checksum, rfind +
+// stoul) against COBS + CRC-32 encoded into a reused buffer and decoded by the streaming
+// FrameDecoder. Throughput is reported over payload bytes.
+namespace {
+    std::string random_payload(std::size_t size) {
+        std::mt19937 rng(42);
+        std::string out(size, '\0');
+        for (auto &c : out) {
+            c = static_cast<char>(rng());
+        }
+        return out;
+    }
+
+    std::string legacy_encode(const std::string &payload) {
+        unsigned checksum = 0;
+        for (const char c : payload) {
+            checksum = (checksum + static_cast<unsigned char>(c)) & 0xFFu;
+        }
+        return payload + "|CS=" + std::to_string(checksum);
+    }
+
+    bool legacy_decode(const std::string &frame, std::string &payload) {
+        const auto sep = frame.rfind("|CS=");
+        if (sep == std::string::npos) {
+            return false;
+        }
+        payload           = frame.substr(0, sep);
+        unsigned checksum = 0;
+        for (const char c : payload) {
+            checksum = (checksum + static_cast<unsigned char>(c)) & 0xFFu;
+        }
+        return checksum == std::stoul(frame.substr(sep + 4));
+    }
+
+    // `count` frames of `size` random bytes back to back, as the UART would deliver them.
+    std::string frame_stream(std::size_t size, std::size_t count) {
+        const std::string payload = random_payload(size);
+        std::string frame(platform::serial::max_frame_size(size), '\0');
+        frame.resize(platform::serial::encode_frame(payload, frame));
+        std::string stream;
+        for (std::size_t i = 0; i < count; ++i) {
+            stream += frame;
+        }
+        return stream;
+    }
+} // namespace
+
+static void BM_SerialCrc32(benchmark::State &state) {
+    const std::string data = random_payload(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(platform::serial::crc32(data));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerialCrc32)->Arg(48)->Arg(1024);
+
+static void BM_SerialEncodeLegacyText(benchmark::State &state) {
+    // Text framing cannot carry arbitrary bytes; printable payloads keep the comparison fair.
+    const std::string payload(static_cast<std::size_t>(state.range(0)), 'a');
+    for (auto _ : state) {
+        std::string frame = legacy_encode(payload);
+        benchmark::DoNotOptimize(frame.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerialEncodeLegacyText)->Arg(48)->Arg(1024);
+
+static void BM_SerialEncodeCobs(benchmark::State &state) {
+    const std::string payload = random_payload(static_cast<std::size_t>(state.range(0)));
+    std::vector<char> out(platform::serial::max_frame_size(payload.size()));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(platform::serial::encode_frame(payload, out));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerialEncodeCobs)->Arg(48)->Arg(1024);
+
+static void BM_SerialDecodeLegacyText(benchmark::State &state) {
+    const std::string frame = legacy_encode(std::string(static_cast<std::size_t>(state.range(0)), 'a'));
+    std::string payload;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_decode(frame, payload));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerialDecodeLegacyText)->Arg(48)->Arg(1024);
+
+// Args: payload size, read() chunk size handed to the decoder.
+static void BM_SerialDecodeStream(benchmark::State &state) {
+    constexpr std::size_t kFrames = 64;
+    const auto size               = static_cast<std::size_t>(state.range(0));
+    const auto chunk              = static_cast<std::size_t>(state.range(1));
+    const std::string stream      = frame_stream(size, kFrames);
+    platform::serial::FrameDecoder decoder(size);
+    for (auto _ : state) {
+        for (std::size_t pos = 0; pos < stream.size(); pos += chunk) {
+            std::span<const char> in(stream.data() + pos, std::min(chunk, stream.size() - pos));
+            while (auto payload = decoder.next(in)) {
+                benchmark::DoNotOptimize(payload->data());
+            }
+        }
+    }
+    if (decoder.stats().frames != state.iterations() * kFrames) {
+        state.SkipWithError("frames lost");
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kFrames * size));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kFrames));
+}
+BENCHMARK(BM_SerialDecodeStream)->Args({48, 16})->Args({48, 4096})->Args({1024, 64})->Args({1024, 4096});
+
+// Resynchronisation: a burst of line noise followed by good 48-byte frames. The frame right after
+// the noise usually merges with its tail and fails the CRC; each iteration is the time from the
+// start of the corruption until the decoder hands out the next valid payload.
+static void BM_SerialResyncAfterCorruption(benchmark::State &state) {
+    std::mt19937 rng(3);
+    std::string noise(static_cast<std::size_t>(state.range(0)), '\0');
+    for (auto &c : noise) {
+        c = static_cast<char>(rng());
+    }
+    const std::string stream = noise + frame_stream(48, 2);
+    platform::serial::FrameDecoder decoder(256);
+    std::int64_t recovered = 0;
+    for (auto _ : state) {
+        std::span<const char> in(stream);
+        while (auto payload = decoder.next(in)) {
+            benchmark::DoNotOptimize(payload->data());
+            ++recovered;
+        }
+    }
+    if (recovered < state.iterations()) {
+        state.SkipWithError("frame after corruption not recovered");
+    }
+    state.counters["discarded_bytes_per_resync"] = benchmark::Counter(
+        static_cast<double>(decoder.stats().bytes_discarded), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SerialResyncAfterCorruption)->Arg(16)->Arg(256)->Arg(4096);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "platform/cpu_features.hpp"
+#include "platform/simt.hpp"
+
+// Mask summarisation per ISA over 1M masks (4 MiB, LLC-resident); items are masks.
+static void BM_SimtSummarizeMasks(benchmark::State &state) {
+    const auto isa = static_cast<platform::SimdIsa>(state.range(0));
+    if (!platform::simd_isa_supported(isa)) {
+        state.SkipWithError((std::string(platform::to_string(isa)) + " not supported on this CPU").c_str());
+        return;
+    }
+    std::mt19937 rng{1};
+    std::vector<std::uint32_t> masks(static_cast<std::size_t>(state.range(1)));
+    for (auto &m : masks) {
+        m = static_cast<std::uint32_t>(rng());
+    }
+    state.SetLabel(platform::to_string(isa));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(platform::simt::summarize_masks(masks, isa));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_SimtSummarizeMasks)
+    ->ArgNames({"isa", "n"})
+    ->ArgsProduct({{static_cast<int>(platform::SimdIsa::kScalar), static_cast<int>(platform::SimdIsa::kSse2),
+                    static_cast<int>(platform::SimdIsa::kAvx2), static_cast<int>(platform::SimdIsa::kAvx512),
+                    static_cast<int>(platform::SimdIsa::kNeon)},
+                   {1 << 20}});
+
+// Whole simulation of a kernel with a divergent branch and a data-dependent loop; items are
+// recorded warp instructions.
+static void BM_SimtSimulateDivergentKernel(benchmark::State &state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    std::vector<float> data(threads, 1.0f);
+    std::uint64_t masks = 0;
+    for (auto _ : state) {
+        const auto report = platform::simt::simulate(threads, [&](platform::simt::Warp &warp) {
+            warp.branch([](std::size_t t) { return t % 3 == 0; },
+                        [&](platform::simt::Warp &w) { w.step([&](std::size_t t) { data[t] *= 2.0f; }); });
+            int trips[platform::simt::kWarpSize] = {};
+            const std::size_t first              = warp.first_thread();
+            warp.loop([&](std::size_t t) { return trips[t - first] < static_cast<int>(t % 5); },
+                      [&](platform::simt::Warp &w) { w.step([&](std::size_t t) { ++trips[t - first]; }); });
+        });
+        masks += report.masks.size();
+        benchmark::DoNotOptimize(report.lanes);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(masks));
+}
+BENCHMARK(BM_SimtSimulateDivergentKernel)->Arg(1 << 16)->Arg(1 << 20);
@@ -0,0 +1,57 @@
+// bench_support.hpp - shared helpers for platform_core_bench cases.
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "platform/latency_histogram.hpp"
+#include "platform/metrics.hpp"
+#include "platform/perf_counters.hpp"
+
+namespace bench {
+
+    // Reports latency percentiles (ns) as user counters. In multi-threaded cases each thread reports
+    // its own histogram and the values are averaged across threads.
+    inline void report_percentiles(benchmark::State &state, const platform::LatencyHistogram &hist) {
+        using benchmark::Counter;
+        state.counters["p50_ns"]  = Counter(static_cast<double>(hist.percentile(50.0)), Counter::kAvgThreads);
+        state.counters["p90_ns"]  = Counter(static_cast<double>(hist.percentile(90.0)), Counter::kAvgThreads);
+        state.counters["p99_ns"]  = Counter(static_cast<double>(hist.percentile(99.0)), Counter::kAvgThreads);
+        state.counters["p999_ns"] = Counter(static_cast<double>(hist.percentile(99.9)), Counter::kAvgThreads);
+        state.counters["max_ns"]  = Counter(static_cast<double>(hist.max()), Counter::kAvgThreads);
+    }
+
+    inline void report_percentiles(benchmark::State &state, const platform::HistogramSnapshot &snap) {
+        using benchmark::Counter;
+        state.counters["p50_ns"]  = Counter(static_cast<double>(snap.quantile(0.5)), Counter::kAvgThreads);
+        state.counters["p90_ns"]  = Counter(static_cast<double>(snap.quantile(0.9)), Counter::kAvgThreads);
+        state.counters["p99_ns"]  = Counter(static_cast<double>(snap.quantile(0.99)), Counter::kAvgThreads);
+        state.counters["p999_ns"] = Counter(static_cast<double>(snap.quantile(0.999)), Counter::kAvgThreads);
+        state.counters["max_ns"]  = Counter(static_cast<double>(snap.max), Counter::kAvgThreads);
+    }
+
+    // Attaches hardware counters for the timed loop to the benchmark as user counters: IPC,
+    // cache MPKI and per-iteration cycles/branch misses. Construct right before the
+    // `for (auto _ : state)` loop. Reports nothing when perf_event_open is unavailable.
+    class PerfCounterReport {
+      public:
+        explicit PerfCounterReport(benchmark::State &state) : state_(state) {}
+        PerfCounterReport(const PerfCounterReport &)            = delete;
+        PerfCounterReport &operator=(const PerfCounterReport &) = delete;
+        ~PerfCounterReport() {
+            if (!scope_.available()) {
+                return;
+            }
+            const auto s = scope_.elapsed();
+            using benchmark::Counter;
+            state_.counters["ipc"]         = Counter(s.ipc(), Counter::kAvgThreads);
+            state_.counters["cache_mpki"]  = Counter(s.cache_mpki(), Counter::kAvgThreads);
+            state_.counters["cycles"]      = Counter(static_cast<double>(s.cycles), Counter::kAvgIterations);
+            state_.counters["branch_miss"] = Counter(static_cast<double>(s.branch_misses), Counter::kAvgIterations);
+        }
+
+      private:
+        benchmark::State &state_;
+        platform::PerfScope scope_;
+    };
+
+} // namespace bench
@@ -0,0 +1,227 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "bench_support.hpp"
+#include "platform/cpu_topology.hpp"
+#include "platform/latency_histogram.hpp"
+#include "platform/thread_pool.hpp"
+
+// Enqueue-to-run latency: each iteration submits a burst of jobs that record how long they waited
+// between enqueue() and the start of execution. range(0) sweeps worker count.
+static void BM_ThreadPool_EnqueueToRun(benchmark::State &state) {
+    using Clock = std::chrono::steady_clock;
+    constexpr std::size_t kBurst = 256;
+    platform::ThreadPool pool(static_cast<std::size_t>(state.range(0)), 1024);
+    std::vector<std::uint64_t> waits(kBurst);
+    std::atomic<std::size_t> done{0};
+    platform::LatencyHistogram hist;
+    for (auto _ : state) {
+        done.store(0, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < kBurst; ++i) {
+            const auto enqueued = Clock::now();
+            pool.enqueue([&waits, &done, i, enqueued]() {
+                waits[i] = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - enqueued).count());
+                done.fetch_add(1, std::memory_order_release);
+            });
+        }
+        while (done.load(std::memory_order_acquire) < kBurst) {
+            std::this_thread::yield();
+        }
+        for (auto w : waits) {
+            hist.record(w);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBurst));
+    bench::report_percentiles(state, hist);
+}
+BENCHMARK(BM_ThreadPool_EnqueueToRun)->ArgName("workers")->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+// High-priority latency under saturation: a feeder keeps the queue topped up with ~20us
+// low-priority jobs while the timed loop submits one probe job at a time and waits for it to run.
+// Reports the probe's enqueue-to-start latency. range(0) selects the pool setup:
+//   0 fifo      - probes go into the low lane behind the backlog (the single-queue baseline)
+//   1 strict    - probes in the high lane, always served first
+//   2 weighted  - probes in the high lane with weights {1, 2, 4}
+//   3 reserved  - strict, plus one worker that only runs high-priority jobs
+static void BM_ThreadPool_HighPriorityUnderLoad(benchmark::State &state) {
+    using Clock                     = std::chrono::steady_clock;
+    constexpr std::size_t kCapacity = 256;
+    const auto mode                 = state.range(0);
+    platform::PoolPriorities priorities;
+    if (mode == 2) {
+        priorities.selection = platform::LaneSelection::kWeighted;
+    } else if (mode == 3) {
+        priorities.reserved_workers = 1;
+    }
+    platform::ThreadPool pool(2, kCapacity, priorities);
+    const auto probe_priority = mode == 0 ? platform::JobPriority::kLow : platform::JobPriority::kHigh;
+
+    std::atomic<bool> stop{false};
+    std::thread feeder([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            const bool admitted = pool.try_enqueue(
+                [] {
+                    const auto until = Clock::now() + std::chrono::microseconds(20);
+                    while (Clock::now() < until) {
+                    }
+                },
+                platform::JobPriority::kLow);
+            if (!admitted) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    while (pool.queue_depth() < kCapacity / 2) {
+        std::this_thread::yield();
+    }
+
+    platform::LatencyHistogram hist;
+    for (auto _ : state) {
+        std::atomic<bool> done{false};
+        std::uint64_t wait_ns = 0;
+        const auto enqueued   = Clock::now();
+        pool.enqueue(
+            [&done, &wait_ns, enqueued] {
+                wait_ns = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - enqueued).count());
+                done.store(true, std::memory_order_release);
+            },
+            probe_priority);
+        while (!done.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        hist.record(wait_ns);
+    }
+    stop.store(true, std::memory_order_relaxed);
+    feeder.join();
+    pool.shutdown();
+    bench::report_percentiles(state, hist);
+}
+BENCHMARK(BM_ThreadPool_HighPriorityUnderLoad)->ArgName("mode")->DenseRange(0, 3)->UseRealTime();
+
+// Cache locality of pool workers: every job re-reads a 256 KiB per-worker working set (sized to
+// stay in L2), so a worker that migrates to another core refetches it. range(0): 0 leaves workers
+// to the scheduler, 1 pins one worker per core (PinPolicy::kCore). Workers = usable CPUs.
+static void BM_ThreadPool_WorkingSetLocality(benchmark::State &state) {
+    constexpr std::size_t kWords = (256 * 1024) / sizeof(std::uint64_t);
+    constexpr int kBurst         = 64;
+    const std::size_t workers    = platform::cpu_topology().usable.size();
+    platform::ThreadPlacement placement;
+    placement.pin = state.range(0) == 1 ? platform::PinPolicy::kCore : platform::PinPolicy::kNone;
+    platform::ThreadPool pool(workers, 1024, {}, placement);
+    std::atomic<int> done{0};
+    std::atomic<std::uint64_t> sink{0};
+    for (auto _ : state) {
+        done.store(0, std::memory_order_relaxed);
+        for (int i = 0; i < kBurst; ++i) {
+            pool.enqueue([&done, &sink] {
+                thread_local std::vector<std::uint64_t> working_set(kWords, 1);
+                sink.fetch_add(std::accumulate(working_set.begin(), working_set.end(), std::uint64_t{0}),
+                               std::memory_order_relaxed);
+                done.fetch_add(1, std::memory_order_release);
+            });
+        }
+        while (done.load(std::memory_order_acquire) < kBurst) {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kBurst);
+    state.SetBytesProcessed(state.iterations() * kBurst * static_cast<std::int64_t>(kWords * sizeof(std::uint64_t)));
+    state.counters["pinned"] = static_cast<double>(pool.pinned_workers());
+}
+BENCHMARK(BM_ThreadPool_WorkingSetLocality)->ArgName("pinned")->Arg(0)->Arg(1)->UseRealTime();
+
+// Two threads take turns incrementing a counter on one cache line, the handoff pattern between a
+// submitter and a worker. range(0): 0 unpinned, 1 both on one CPU, 2 on two different CPUs (the
+// line moves between cores every round trip). Skipped when only one CPU is usable.
+static void BM_CacheLinePingPong(benchmark::State &state) {
+    const auto &usable = platform::cpu_topology().usable;
+    const auto mode    = state.range(0);
+    if (mode == 2 && usable.size() < 2) {
+        state.SkipWithError("needs two usable CPUs");
+        return;
+    }
+    const std::array<int, 2> cpus{usable.front(), mode == 2 ? usable[1] : usable.front()};
+    // Threads that may share a CPU yield while waiting so the other side can run.
+    const bool shared_cpu = mode == 1 || usable.size() == 1;
+    struct alignas(64) Line {
+        std::atomic<std::uint64_t> turn{0};
+    } line;
+    std::atomic<bool> stop{false};
+    std::thread partner([&] {
+        if (mode != 0) {
+            platform::pin_current_thread(std::span<const int>(&cpus[1], 1));
+        }
+        while (!stop.load(std::memory_order_relaxed)) {
+            const auto t = line.turn.load(std::memory_order_acquire);
+            if (t % 2 == 1) {
+                line.turn.store(t + 1, std::memory_order_release);
+            } else if (shared_cpu) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    if (mode != 0) {
+        platform::pin_current_thread(std::span<const int>(&cpus[0], 1));
+    }
+    for (auto _ : state) {
+        const auto t = line.turn.load(std::memory_order_relaxed);
+        line.turn.store(t + 1, std::memory_order_release);
+        while (line.turn.load(std::memory_order_acquire) != t + 2) {
+            if (shared_cpu) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    stop.store(true, std::memory_order_relaxed);
+    partner.join();
+    platform::pin_current_thread(usable);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CacheLinePingPong)->ArgName("mode")->DenseRange(0, 2)->UseRealTime();
+
+// BM_BoundedQueue_WakeToRun for pool workers: one worker, one job per iteration submitted on
+// schedule at range(1) Hz, under wait strategy range(0) (0 block, 1 spin_park, 2 spin). Reports
+// enqueue-to-run percentiles and process CPU time over wall time as cpu_pct.
+static void BM_ThreadPool_WakeToRun(benchmark::State &state) {
+    using Clock       = std::chrono::steady_clock;
+    const auto mode   = static_cast<platform::WaitMode>(state.range(0));
+    const auto period = std::chrono::nanoseconds(1'000'000'000 / state.range(1));
+    platform::LatencyHistogram hist;
+    std::clock_t cpu_started = 0;
+    auto wall_started        = Clock::now();
+    {
+        platform::ThreadPool pool(1, 64, {}, {}, {}, {.mode = mode});
+        cpu_started  = std::clock();
+        wall_started = Clock::now();
+        auto next    = wall_started;
+        for (auto _ : state) {
+            next += period;
+            std::this_thread::sleep_until(next);
+            const auto enqueued = Clock::now();
+            pool.enqueue([&hist, enqueued] { hist.record(Clock::now() - enqueued); });
+        }
+    }
+    const double cpu_s  = static_cast<double>(std::clock() - cpu_started) / CLOCKS_PER_SEC;
+    const double wall_s = std::chrono::duration<double>(Clock::now() - wall_started).count();
+
+    state.counters["cpu_pct"] = 100.0 * cpu_s / wall_s;
+    state.SetLabel(platform::to_string(mode));
+    bench::report_percentiles(state, hist);
+}
+BENCHMARK(BM_ThreadPool_WakeToRun)
+    ->ArgNames({"wait", "hz"})
+    ->ArgsProduct({{0, 1, 2}, {200, 2000, 20000}})
+    ->Iterations(400)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "platform/topic_synchronizer.hpp"
+
+// Approximate-time alignment over mixed-rate topics: topic i publishes every (i % 4 + 1) ms with
+// a little per-topic skew, so fast topics pile up samples the slow ones never match and the
+// buffers stay partly full. Reports the cost per push and the resulting match rate.
+namespace {
+    struct Arrival {
+        std::size_t topic;
+        std::int64_t timestamp_ns;
+    };
+
+    // Merges every topic's schedule into arrival order over `span_ms` of simulated time.
+    std::vector<Arrival> mixed_rate_schedule(std::size_t topics, std::int64_t span_ms) {
+        std::vector<Arrival> out;
+        for (std::int64_t t = 0; t < span_ms * 1'000'000; t += 100'000) {
+            for (std::size_t i = 0; i < topics; ++i) {
+                const std::int64_t period = static_cast<std::int64_t>(i % 4 + 1) * 1'000'000;
+                const std::int64_t skew   = static_cast<std::int64_t>(i % 5) * 100'000;
+                if ((t - skew) % period == 0 && t >= skew) {
+                    out.push_back({i, t});
+                }
+            }
+        }
+        return out;
+    }
+} // namespace
+
+static void BM_TopicSyncMixedRate(benchmark::State &state) {
+    const auto topics     = static_cast<std::size_t>(state.range(0));
+    const auto capacity   = static_cast<std::size_t>(state.range(1));
+    const auto arrivals   = mixed_rate_schedule(topics, 1000);
+    std::uint64_t sink    = 0;
+    std::uint64_t matched = 0;
+    for (auto _ : state) {
+        platform::TopicSynchronizer sync(topics, {.tolerance = std::chrono::microseconds(500), .capacity = capacity},
+                                         [&sink](std::span<const platform::StampedValue> tuple) {
+                                             sink += static_cast<std::uint64_t>(tuple.front().timestamp_ns);
+                                         });
+        for (const auto &a : arrivals) {
+            sync.push(a.topic, {a.timestamp_ns, 1.0});
+        }
+        matched += sync.stats().matched;
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * arrivals.size()));
+    state.counters["matches_per_s"] =
+        benchmark::Counter(static_cast<double>(matched), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_TopicSyncMixedRate)
+    ->ArgsProduct({{2, 4, 12, 32}, {16, 256}})
+    ->ArgNames({"topics", "capacity"})
+    ->Unit(benchmark::kMicrosecond);
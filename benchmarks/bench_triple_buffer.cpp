@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "platform/triple_buffer.hpp"
+
+// Latest-value handoff of a 64-byte command: TripleBuffer against a mutex-guarded slot. The
+// uncontended benchmarks time one update (write, or write + fetch); the Contended ones run a
+// writer thread alongside the timed reader loop.
+namespace {
+    struct Command {
+        std::array<double, 8> values{};
+    };
+
+    class MutexSlot {
+      public:
+        void write(const Command &c) {
+            std::lock_guard lock(mutex_);
+            value_ = c;
+            fresh_ = true;
+        }
+        bool fetch(Command &out) {
+            std::lock_guard lock(mutex_);
+            if (!fresh_) {
+                return false;
+            }
+            out    = value_;
+            fresh_ = false;
+            return true;
+        }
+
+      private:
+        std::mutex mutex_;
+        Command value_;
+        bool fresh_{false};
+    };
+} // namespace
+
+static void BM_TripleBufferWrite(benchmark::State &state) {
+    platform::TripleBuffer<Command> buffer;
+    Command c;
+    for (auto _ : state) {
+        c.values[0] += 1.0;
+        benchmark::DoNotOptimize(buffer.write(c));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TripleBufferWrite);
+
+static void BM_TripleBufferWriteFetch(benchmark::State &state) {
+    platform::TripleBuffer<Command> buffer;
+    Command c;
+    for (auto _ : state) {
+        c.values[0] += 1.0;
+        buffer.write(c);
+        buffer.fetch();
+        benchmark::DoNotOptimize(buffer.current().values[0]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TripleBufferWriteFetch);
+
+static void BM_MutexSlotWriteFetch(benchmark::State &state) {
+    MutexSlot slot;
+    Command c;
+    Command out;
+    for (auto _ : state) {
+        c.values[0] += 1.0;
+        slot.write(c);
+        slot.fetch(out);
+        benchmark::DoNotOptimize(out.values[0]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexSlotWriteFetch);
+
+// Reader cost per fetch attempt while another thread writes continuously; `fresh` is the share
+// of attempts that found a new value.
+template <class Fetch, class Write> void run_contended(benchmark::State &state, Fetch fetch, Write write) {
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        Command c;
+        while (!stop.load(std::memory_order_relaxed)) {
+            c.values[0] += 1.0;
+            write(c);
+        }
+    });
+    std::int64_t fresh = 0;
+    for (auto _ : state) {
+        fresh += fetch() ? 1 : 0;
+    }
+    stop.store(true, std::memory_order_relaxed);
+    writer.join();
+    state.SetItemsProcessed(state.iterations());
+    const auto attempts     = std::max<std::int64_t>(state.iterations(), 1);
+    state.counters["fresh"] = static_cast<double>(fresh) / static_cast<double>(attempts);
+}
+
+static void BM_TripleBufferContended(benchmark::State &state) {
+    platform::TripleBuffer<Command> buffer;
+    run_contended(
+        state, [&] { return buffer.fetch() && buffer.current().values[0] > 0.0; },
+        [&](const Command &c) { buffer.write(c); });
+}
+BENCHMARK(BM_TripleBufferContended)->UseRealTime();
+
+static void BM_MutexSlotContended(benchmark::State &state) {
+    MutexSlot slot;
+    Command out;
+    run_contended(
+        state, [&] { return slot.fetch(out) && out.values[0] > 0.0; }, [&](const Command &c) { slot.write(c); });
+}
+BENCHMARK(BM_MutexSlotContended)->UseRealTime();
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "platform/wire_format.hpp"
+
+// sensor.raw encode/decode: the text payload built with std::to_string and read back with
+// substr + stod (the original Pipeline path), the same text through to_chars/from_chars into a
+// stack buffer, and the binary record written into a reused buffer and read in place.
+namespace {
+    constexpr double kValue = 1.0123456789;
+} // namespace
+
+static void BM_WireEncodeText(benchmark::State &state) {
+    const std::string name = "imu";
+    for (auto _ : state) {
+        std::string payload = name + ":" + std::to_string(kValue);
+        benchmark::DoNotOptimize(payload.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_WireEncodeText);
+
+static void BM_WireEncodeBinary(benchmark::State &state) {
+    char buffer[sizeof(platform::wire::SensorSampleRecord)];
+    std::uint32_t sequence = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(platform::wire::encode_sensor_sample(buffer, "imu", kValue, 1'000, sequence++));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_WireEncodeBinary);
+
+static void BM_WireDecodeText(benchmark::State &state) {
+    const std::string payload = "imu:" + std::to_string(kValue);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::stod(payload.substr(payload.find(':') + 1)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_WireDecodeText);
+
+static void BM_WireDecodeBinary(benchmark::State &state) {
+    const std::string payload = platform::wire::sensor_sample_payload("imu", kValue, 1'000);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(payload.data());
+        const auto view = platform::wire::SensorSampleView::from(payload);
+        benchmark::DoNotOptimize(view->value());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_WireDecodeBinary);
+
+static void BM_WireEncodeTextCharconv(benchmark::State &state) {
+    char buffer[platform::wire::kMaxSensorTextChars];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(platform::wire::format_sensor_text(buffer, "imu", kValue));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_WireEncodeTextCharconv);
+
+// Samples parsed per second through the allocation-free text codec.
+static void BM_WireDecodeTextCharconv(benchmark::State &state) {
+    char buffer[platform::wire::kMaxSensorTextChars];
+    const std::string_view payload(buffer, platform::wire::format_sensor_text(buffer, "imu", kValue));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(payload.data());
+        benchmark::DoNotOptimize(platform::wire::parse_sensor_text(payload));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_WireDecodeTextCharconv);
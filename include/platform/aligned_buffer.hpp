@@ -0,0 +1,97 @@
+// aligned_buffer.hpp - fixed-size, over-aligned heap array for SIMD kernels.
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace platform {
+
+    // Owns `size` value-initialised elements starting on an `Alignment` boundary (a cache line by
+    // default, which also satisfies every vector load width we dispatch to). Move-only; never
+    // reallocates, so spans taken from it stay valid for its lifetime.
+    template <class T, std::size_t Alignment = 64> class AlignedBuffer {
+        static_assert(std::is_trivially_destructible_v<T>, "AlignedBuffer holds plain data only");
+        static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "invalid alignment");
+
+      public:
+        static constexpr std::size_t kAlignment = Alignment;
+
+        AlignedBuffer() = default;
+        explicit AlignedBuffer(std::size_t size)
+            : data_(size == 0 ? nullptr
+                              : static_cast<T *>(::operator new(size * sizeof(T), std::align_val_t{Alignment}))),
+              size_(size) {
+            std::uninitialized_value_construct_n(data_.get(), size_);
+        }
+        AlignedBuffer(AlignedBuffer &&other) noexcept : data_(std::move(other.data_)), size_(other.size_) {
+            other.size_ = 0;
+        }
+        AlignedBuffer &operator=(AlignedBuffer &&other) noexcept {
+            data_       = std::move(other.data_);
+            size_       = other.size_;
+            other.size_ = 0;
+            return *this;
+        }
+
+        T *data() noexcept {
+            return data_.get();
+        }
+        const T *data() const noexcept {
+            return data_.get();
+        }
+        std::size_t size() const noexcept {
+            return size_;
+        }
+        bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        T &operator[](std::size_t i) noexcept {
+            return data_.get()[i];
+        }
+        const T &operator[](std::size_t i) const noexcept {
+            return data_.get()[i];
+        }
+
+        T *begin() noexcept {
+            return data();
+        }
+        T *end() noexcept {
+            return data() + size_;
+        }
+        const T *begin() const noexcept {
+            return data();
+        }
+        const T *end() const noexcept {
+            return data() + size_;
+        }
+
+        std::span<T> span() noexcept {
+            return {data(), size_};
+        }
+        std::span<const T> span() const noexcept {
+            return {data(), size_};
+        }
+        operator std::span<T>() noexcept {
+            return span();
+        }
+        operator std::span<const T>() const noexcept {
+            return span();
+        }
+
+      private:
+        struct Deleter {
+            void operator()(T *p) const noexcept {
+                ::operator delete(p, std::align_val_t{Alignment});
+            }
+        };
+
+        std::unique_ptr<T, Deleter> data_;
+        std::size_t size_{0};
+    };
+
+} // namespace platform
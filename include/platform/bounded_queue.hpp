@@ -1,18 +1,42 @@
-// bounded_queue.hpp - Bounded MPMC queue with optional stop_token support.
+// bounded_queue.hpp - Bounded MPMC queue with optional stop_token support and a consumer wait strategy.
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <limits>
 #include <mutex>
 #include <optional>
 #include <stop_token>
+#include <string_view>
 #include <utility>
 
+#include "platform/wait_strategy.hpp"
+
 namespace platform {
 
+    class MetricsRegistry;
+    class Gauge;
+    class Histogram;
+
+    namespace detail {
+        // Metric updates live in bounded_queue.cpp, so this header needs only the declarations above.
+        struct QueueMetrics {
+            Gauge *depth{nullptr};
+            Histogram *push_wait_ns{nullptr};
+            Histogram *pop_wait_ns{nullptr};
+        };
+        QueueMetrics bind_queue_metrics(MetricsRegistry &registry, std::string_view prefix);
+        void set_depth(Gauge &depth, std::size_t size);
+        void record_wait(Histogram &hist, std::chrono::steady_clock::duration waited);
+    } // namespace detail
+
     template <typename T> class BoundedQueue {
       public:
-        explicit BoundedQueue(std::size_t capacity) : capacity_(capacity) {}
+        // `wait` decides how pop() waits on an empty queue; producers always block on a full one.
+        explicit BoundedQueue(std::size_t capacity, WaitStrategy wait = {}) : capacity_(capacity), wait_(wait) {}
 
         bool push(const T &value, std::stop_token st = {}) {
             return emplace_impl(value, st);
@@ -25,14 +49,67 @@ namespace platform {
             return emplace_impl(T(std::forward<Args>(args)...), st);
         }
 
+        // Never blocks. Returns false, leaving `value` untouched, when the queue is closed or already
+        // holds min(limit, capacity) elements; a limit below capacity reserves the rest of the queue
+        // for callers passing a higher one.
+        bool try_push(T &&value, std::size_t limit = std::numeric_limits<std::size_t>::max()) {
+#ifndef PLATFORM_FAILURE_RACE
+            std::lock_guard lock(mutex_);
+#else
+            std::lock_guard lock(dummy_mutex_);
+#endif
+            if (closed_ || queue_.size() >= std::min(limit, capacity_)) {
+                return false;
+            }
+            queue_.push_back(std::move(value));
+            update_depth();
+            cv_not_empty_.notify_one();
+            return true;
+        }
+
+        // Never blocks: when full, discards the oldest element to make room and sets `evicted`.
+        // Returns false, leaving `value` untouched, when the queue is closed or has no capacity.
+        bool push_evict_oldest(T &&value, bool &evicted) {
+#ifndef PLATFORM_FAILURE_RACE
+            std::lock_guard lock(mutex_);
+#else
+            std::lock_guard lock(dummy_mutex_);
+#endif
+            evicted = false;
+            if (closed_ || capacity_ == 0) {
+                return false;
+            }
+            if (queue_.size() >= capacity_) {
+                queue_.pop_front();
+                evicted = true;
+            }
+            queue_.push_back(std::move(value));
+            update_depth();
+            cv_not_empty_.notify_one();
+            return true;
+        }
+
+        // Publishes `<prefix>_depth`, `<prefix>_push_wait_ns` and `<prefix>_pop_wait_ns`. Wait
+        // histograms only record calls that actually blocked, so the uncontended path reads no clock.
+        void bind_metrics(MetricsRegistry &registry, std::string_view prefix) {
+            const auto metrics = detail::bind_queue_metrics(registry, prefix);
+            std::lock_guard lock(mutex_);
+            depth_        = metrics.depth;
+            push_wait_ns_ = metrics.push_wait_ns;
+            pop_wait_ns_  = metrics.pop_wait_ns;
+            detail::set_depth(*depth_, queue_.size());
+        }
+
         std::optional<T> pop(std::stop_token st = {}) {
 #ifndef PLATFORM_FAILURE_RACE
-            std::unique_lock lock(mutex_);
+            std::unique_lock lock(mutex_, std::defer_lock);
 #else
             // Intentional: skip locking to create a race.
-            std::unique_lock lock(dummy_mutex_);
+            std::unique_lock lock(dummy_mutex_, std::defer_lock);
 #endif
-            auto wait_pred = [this]() { return closed_ || !queue_.empty(); };
+            const auto spun_since = spin_then_lock(lock, st);
+            auto wait_pred        = [this]() { return closed_ || !queue_.empty(); };
+            const WaitTimer timer(pop_wait_ns_, wait_pred() && !spun_since, spun_since);
             if (st.stop_possible()) {
                 if (!cv_not_empty_.wait(lock, st, wait_pred)) {
                     return std::nullopt;
@@ -45,6 +122,7 @@ namespace platform {
             }
             T value = std::move(queue_.front());
             queue_.pop_front();
+            update_depth();
             cv_not_full_.notify_one();
             return value;
         }
@@ -56,10 +134,19 @@ namespace platform {
             std::lock_guard lock(dummy_mutex_);
 #endif
             closed_ = true;
+            published_closed_.store(true, std::memory_order_release);
             cv_not_full_.notify_all();
             cv_not_empty_.notify_all();
         }
 
+        std::size_t capacity() const {
+            return capacity_;
+        }
+
+        const WaitStrategy &wait_strategy() const {
+            return wait_;
+        }
+
         std::size_t size() const {
 #ifndef PLATFORM_FAILURE_RACE
             std::lock_guard lock(mutex_);
@@ -70,6 +157,32 @@ namespace platform {
         }
 
       private:
+        using Clock = std::chrono::steady_clock;
+
+        // Takes `lock` for pop(). Spinning strategies first poll the published size and closed flag
+        // without it, so a spinning consumer never holds producers up; kSpin polls again whenever
+        // another consumer took the element first. Returns when the caller started to wait, if it
+        // spun.
+        std::optional<Clock::time_point> spin_then_lock(std::unique_lock<std::mutex> &lock, std::stop_token st) {
+            auto arrived = [this]() {
+                return published_size_.load(std::memory_order_acquire) != 0 ||
+                       published_closed_.load(std::memory_order_acquire);
+            };
+            if (wait_.mode == WaitMode::kBlock || arrived()) {
+                lock.lock();
+                return std::nullopt;
+            }
+            const auto since = Clock::now();
+            for (;;) {
+                spin_until(wait_, st, arrived);
+                lock.lock();
+                if (wait_.mode != WaitMode::kSpin || closed_ || !queue_.empty() || st.stop_requested()) {
+                    return since;
+                }
+                lock.unlock();
+            }
+        }
+
         template <typename U> bool emplace_impl(U &&value, std::stop_token st) {
 #ifndef PLATFORM_FAILURE_RACE
             std::unique_lock lock(mutex_);
@@ -77,6 +190,7 @@ namespace platform {
             std::unique_lock lock(dummy_mutex_);
 #endif
             auto full_pred = [this]() { return closed_ || queue_.size() < capacity_; };
+            const WaitTimer timer(push_wait_ns_, full_pred());
             if (st.stop_possible()) {
                 if (!cv_not_full_.wait(lock, st, full_pred)) {
                     return false;
@@ -94,16 +208,53 @@ namespace platform {
 #else
             queue_.push_back(std::forward<U>(value));
 #endif
+            update_depth();
             cv_not_empty_.notify_one();
             return true;
         }
 
+        // Times a blocking wait into `hist` when bound and the caller is about to block, from `since`
+        // when it already spun.
+        class WaitTimer {
+          public:
+            WaitTimer(Histogram *hist, bool ready, std::optional<Clock::time_point> since = std::nullopt)
+                : hist_(ready ? nullptr : hist),
+                  start_(hist_ != nullptr ? since.value_or(Clock::now()) : Clock::time_point{}) {}
+            WaitTimer(const WaitTimer &)            = delete;
+            WaitTimer &operator=(const WaitTimer &) = delete;
+            ~WaitTimer() {
+                if (hist_ != nullptr) {
+                    detail::record_wait(*hist_, Clock::now() - start_);
+                }
+            }
+
+          private:
+            Histogram *hist_;
+            Clock::time_point start_;
+        };
+
+        // Called under the lock after every change in size.
+        void update_depth() {
+            published_size_.store(queue_.size(), std::memory_order_release);
+            if (depth_ != nullptr) {
+                detail::set_depth(*depth_, queue_.size());
+            }
+        }
+
         const std::size_t capacity_;
+        const WaitStrategy wait_;
         mutable std::mutex mutex_;
         std::condition_variable_any cv_not_full_;
         std::condition_variable_any cv_not_empty_;
         std::deque<T> queue_;
         bool closed_{false};
+        // Mirrors of queue_.size() and closed_ that spinning consumers poll without the lock.
+        std::atomic<std::size_t> published_size_{0};
+        std::atomic<bool> published_closed_{false};
+
+        Gauge *depth_{nullptr};
+        Histogram *push_wait_ns_{nullptr};
+        Histogram *pop_wait_ns_{nullptr};
 
         // Used only when race injection is enabled to satisfy lock_guard types.
         mutable std::mutex dummy_mutex_;
@@ -0,0 +1,30 @@
+// cpu_features.hpp - runtime CPU feature detection (SIMD ISA, cache size) for kernel dispatch.
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace platform {
+
+    // Ordered from least to most capable within each architecture family.
+    enum class SimdIsa { kScalar, kSse2, kAvx2, kAvx512, kNeon };
+
+    // True when this binary carries a kernel for `isa` and the running CPU (and OS) can execute it.
+    bool simd_isa_supported(SimdIsa isa);
+
+    // Best ISA supported by the running CPU.
+    SimdIsa detect_simd_isa();
+
+    // ISA used by dispatched kernels: detect_simd_isa(), unless the `PLATFORM_SIMD` environment
+    // variable names a supported ISA (`scalar`, `sse2`, `avx2`, `avx512`, `neon`). Resolved once.
+    SimdIsa active_simd_isa();
+
+    // Per-core L2 size in bytes as reported by the OS, or 1 MiB when it cannot be determined.
+    // Resolved once; used to size work chunks so each stays cache-resident.
+    std::size_t l2_cache_bytes();
+
+    const char *to_string(SimdIsa isa);
+    std::optional<SimdIsa> parse_simd_isa(std::string_view name);
+
+} // namespace platform
@@ -0,0 +1,85 @@
+// cpu_kernels.hpp - SIMD, cache-blocked, multi-threaded CPU compute kernels with naive references.
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+
+#include "platform/cpu_features.hpp"
+#include "platform/parallel_for.hpp"
+
+namespace platform {
+
+    // How a kernel runs. The defaults use the dispatched ISA on the calling thread only.
+    struct KernelOptions {
+        // Workers that share the kernel with the calling thread; null runs single-threaded.
+        ThreadPool *pool{nullptr};
+        ParallelOptions parallel{};
+        // Forces an instruction set (benchmarks, parity tests); ignored when this CPU lacks it.
+        std::optional<SimdIsa> isa{};
+    };
+
+    // One `x * scale + bias` step of fused_affine().
+    struct AffineStep {
+        float scale{1.0f};
+        float bias{0.0f};
+    };
+
+    // Weights of the 5-point stencil used by stencil5().
+    struct Stencil5 {
+        float center{0.0f};
+        float north{0.0f};
+        float south{0.0f};
+        float west{0.0f};
+        float east{0.0f};
+    };
+
+    // Reductions. Partial sums are combined per lane and per chunk, so results can differ from
+    // a sequential loop by float reassociation; reduce_max() of an empty span is -infinity.
+    float reduce_sum(std::span<const float> x, const KernelOptions &options = {});
+    float reduce_max(std::span<const float> x, const KernelOptions &options = {});
+    float dot(std::span<const float> a, std::span<const float> b, const KernelOptions &options = {});
+
+    // out[i] = x[0] + ... + x[i]. `out` may alias `in` exactly. False when `out` is too short.
+    bool inclusive_scan(std::span<const float> in, std::span<float> out, const KernelOptions &options = {});
+
+    // y = alpha * x + y over x.size() elements. False when `y` is shorter than `x`.
+    bool saxpy(float alpha, std::span<const float> x, std::span<float> y, const KernelOptions &options = {});
+
+    // Valid-mode cross-correlation (the image-processing convention, taps are not flipped):
+    // out[i] = sum_t taps[t] * in[i + t] for i < in.size() - taps.size() + 1.
+    bool conv1d(std::span<const float> in, std::span<const float> taps, std::span<float> out,
+                const KernelOptions &options = {});
+
+    // Valid-mode 2D cross-correlation of a row-major image `width` columns wide with a row-major
+    // kernel `kernel_width` columns wide. `out` is dense, (width - kernel_width + 1) columns wide.
+    bool conv2d(std::span<const float> in, std::size_t width, std::span<const float> kernel, std::size_t kernel_width,
+                std::span<float> out, const KernelOptions &options = {});
+
+    // One Jacobi sweep of a 5-point stencil over a row-major image; border cells are copied.
+    // `out` must not overlap `in`.
+    bool stencil5(std::span<const float> in, std::size_t width, const Stencil5 &weights, std::span<float> out,
+                  const KernelOptions &options = {});
+
+    // Applies every step to each element in registers, in a single pass over memory (a chain of
+    // multiply-adds such as calibration gain/offset followed by normalisation).
+    bool fused_affine(std::span<const float> in, std::span<const AffineStep> steps, std::span<float> out,
+                      const KernelOptions &options = {});
+
+    // Naive single-threaded implementations that define the expected results for parity checks.
+    // Reductions and scans accumulate in double.
+    namespace reference {
+        float reduce_sum(std::span<const float> x);
+        float reduce_max(std::span<const float> x);
+        float dot(std::span<const float> a, std::span<const float> b);
+        bool inclusive_scan(std::span<const float> in, std::span<float> out);
+        bool saxpy(float alpha, std::span<const float> x, std::span<float> y);
+        bool conv1d(std::span<const float> in, std::span<const float> taps, std::span<float> out);
+        bool conv2d(std::span<const float> in, std::size_t width, std::span<const float> kernel,
+                    std::size_t kernel_width, std::span<float> out);
+        bool stencil5(std::span<const float> in, std::size_t width, const Stencil5 &weights, std::span<float> out);
+        // Applies each step as its own pass over `out`, as chained stages would.
+        bool fused_affine(std::span<const float> in, std::span<const AffineStep> steps, std::span<float> out);
+    } // namespace reference
+
+} // namespace platform
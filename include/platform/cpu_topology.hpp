@@ -0,0 +1,49 @@
+// cpu_topology.hpp - usable/isolated CPUs, NUMA nodes, and thread pinning and naming (Linux).
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace platform {
+
+    struct CpuTopology {
+        // CPUs this process may run on (its affinity mask at first use), ascending.
+        std::vector<int> usable;
+        // CPUs the kernel keeps out of general scheduling (isolcpus=), ascending. Placement leaves
+        // them to threads that are pinned there explicitly.
+        std::vector<int> isolated;
+        // Usable CPUs grouped by NUMA node; nodes without usable CPUs are omitted. Always at least one
+        // node, holding every usable CPU, when the OS reports no NUMA layout.
+        std::vector<std::vector<int>> nodes;
+
+        // Index into `nodes` of the node holding `cpu`, or 0 when it is not usable.
+        std::size_t node_of(int cpu) const;
+    };
+
+    // Read once from sched_getaffinity and /sys/devices/system/{cpu,node}. Elsewhere one node with
+    // CPUs 0 .. hardware_concurrency()-1 and none isolated.
+    const CpuTopology &cpu_topology();
+
+    // Parses a kernel CPU list such as "0-3,8,10-11" (empty text is an empty list). Returns nullopt
+    // on malformed input or a CPU id beyond what the OS can address (CPU_SETSIZE on Linux). The
+    // result is sorted and free of duplicates.
+    std::optional<std::vector<int>> parse_cpu_list(std::string_view text);
+
+    // CPUs present in both sorted lists, ascending.
+    std::vector<int> intersect_cpus(std::span<const int> a, std::span<const int> b);
+
+    // Restricts the calling thread to `cpus`. Returns false, leaving the affinity unchanged, when
+    // the list is empty, the OS refuses, or pinning is unsupported.
+    bool pin_current_thread(std::span<const int> cpus);
+
+    // CPU the calling thread is running on, or -1 when unknown.
+    int current_cpu();
+
+    // Names the calling thread for top, perf and debuggers. Linux keeps at most 15 characters, so
+    // longer names are truncated. No-op where unsupported.
+    void name_current_thread(std::string_view name);
+
+} // namespace platform
@@ -7,6 +7,15 @@
 
 #include <vector>
 
+#ifndef __CUDACC__
+// The host-side kernel API below is C++20; nvcc builds this header as C++17 and only needs the
+// buffer and the std::vector entry points.
+#include <span>
+
+#include "platform/cpu_features.hpp"
+#include "platform/parallel_for.hpp"
+#endif
+
 namespace platform {
 
     struct CudaBuffer {
@@ -35,9 +44,25 @@ namespace platform {
         std::size_t bytes_{0};
     };
 
-    // CPU reference implementation.
+    // CPU reference implementation. `out` is only resized when its size differs from the input,
+    // so a reused vector does not allocate.
     void vector_add_cpu(const std::vector<float> &a, const std::vector<float> &b, std::vector<float> &out);
 
+#ifndef __CUDACC__
+    // Non-allocating kernel dispatched on active_simd_isa(). Adds min(a.size(), b.size()) elements
+    // and returns false without writing when `out` is shorter. Any alignment works; AlignedBuffer
+    // storage avoids loads that split cache lines. `out` may alias `a` or `b` exactly.
+    bool vector_add_cpu(std::span<const float> a, std::span<const float> b, std::span<float> out);
+    // As above with an explicit ISA; returns false when the running CPU cannot execute it.
+    bool vector_add_cpu(std::span<const float> a, std::span<const float> b, std::span<float> out, SimdIsa isa);
+
+    // Multi-core variant for CPU-only nodes: splits the arrays with parallel_for() so `pool`
+    // workers and the calling thread share the work. Same contract as the span overload above;
+    // safe to call from a pool job.
+    bool vector_add_cpu(ThreadPool &pool, std::span<const float> a, std::span<const float> b, std::span<float> out,
+                        const ParallelOptions &options = {});
+#endif
+
 #ifdef PLATFORM_ENABLE_CUDA
     // GPU implementation. Returns false on CUDA error.
     bool vector_add_cuda(const std::vector<float> &a, const std::vector<float> &b, std::vector<float> &out);
@@ -0,0 +1,133 @@
+// deadline_executor.hpp - earliest-deadline-first worker pool for deadline-tagged jobs.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace platform {
+
+    class MetricsRegistry;
+    class Counter;
+    class Gauge;
+    class Histogram;
+
+    // What a worker does with a job whose deadline passed before it could start.
+    enum class LatePolicy {
+        // Discard it unrun.
+        kDrop,
+        // Run it anyway and count the late start.
+        kRun,
+    };
+
+    struct DeadlineExecutorOptions {
+        std::size_t threads{1};
+        // Independent min-heaps; 0 selects one per thread. More shards spread submit contention at
+        // the cost of a looser ordering between jobs that arrive together.
+        std::size_t shards{0};
+        // Bounds the jobs queued across all shards.
+        std::size_t capacity{1024};
+    };
+
+    // Runs jobs on its own worker threads, earliest absolute deadline first (FIFO among equal
+    // deadlines). Submitters spread jobs round robin over mutex-guarded binary heaps; each shard
+    // also publishes its earliest deadline in an atomic, so a worker picks the shard to pop from
+    // without taking any lock. Ordering is exact with one shard and EDF up to jobs submitted while
+    // a worker is choosing otherwise.
+    class DeadlineExecutor {
+      public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit DeadlineExecutor(DeadlineExecutorOptions options = {});
+        ~DeadlineExecutor();
+
+        DeadlineExecutor(const DeadlineExecutor &)            = delete;
+        DeadlineExecutor &operator=(const DeadlineExecutor &) = delete;
+
+        // Never blocks. Returns false, counting `<prefix>_rejected_total`, when `capacity` jobs are
+        // already queued or the executor is shutting down.
+        bool submit(Clock::time_point deadline, std::function<void()> job, LatePolicy late = LatePolicy::kDrop);
+        // Joins the workers; jobs still queued are discarded.
+        void shutdown();
+
+        std::size_t thread_count() const {
+            return workers_.size();
+        }
+        std::size_t queue_depth() const {
+            return depth_.load(std::memory_order_relaxed);
+        }
+
+        // Publishes `<prefix>_jobs_total` (jobs run), `<prefix>_rejected_total`,
+        // `<prefix>_late_dropped_total` and `<prefix>_late_started_total` (by LatePolicy),
+        // `<prefix>_deadline_miss_total` (jobs dropped or finished after their deadline),
+        // `<prefix>_queue_depth`, `<prefix>_slack_ns` (deadline minus start, on-time starts) and
+        // `<prefix>_lateness_ns` (finish minus deadline, misses that ran). Only the first call takes
+        // effect.
+        void bind_metrics(MetricsRegistry &registry, std::string_view prefix);
+
+      private:
+        static constexpr std::int64_t kNoDeadline = std::numeric_limits<std::int64_t>::max();
+
+        struct Job {
+            Clock::time_point deadline;
+            std::uint64_t sequence{0};
+            LatePolicy late{LatePolicy::kDrop};
+            std::function<void()> fn;
+        };
+
+        struct alignas(64) Shard {
+            std::mutex mutex;
+            // Min-heap on (deadline, sequence).
+            std::vector<Job> heap;
+            // Deadline of heap.front() in steady-clock ticks (see earliest_ticks), kNoDeadline when
+            // empty; read unlocked.
+            std::atomic<std::int64_t> earliest{kNoDeadline};
+        };
+
+        struct Metrics {
+            Counter *jobs{nullptr};
+            Counter *rejected{nullptr};
+            Counter *late_dropped{nullptr};
+            Counter *late_started{nullptr};
+            Counter *misses{nullptr};
+            Gauge *depth{nullptr};
+            Histogram *slack_ns{nullptr};
+            Histogram *lateness_ns{nullptr};
+        };
+
+        // Clamps `deadline` below kNoDeadline, so a job due at Clock::time_point::max() still marks
+        // its shard as non-empty.
+        static std::int64_t earliest_ticks(Clock::time_point deadline);
+        // Requires a token from ready_, which guarantees a queued job for this worker until shutdown;
+        // returns nullopt once shutting down with nothing left to pop.
+        std::optional<Job> pop();
+        void run(Job &job);
+        void worker();
+
+        const std::size_t capacity_;
+        const std::size_t shard_count_;
+        std::unique_ptr<Shard[]> shards_;
+        std::atomic<std::size_t> next_shard_{0};
+        std::atomic<std::uint64_t> sequence_{0};
+        std::atomic<std::size_t> depth_{0};
+        // One token per queued job, plus one per worker at shutdown.
+        std::counting_semaphore<> ready_{0};
+        std::atomic<bool> shutting_down_{false};
+        std::vector<std::jthread> workers_;
+
+        std::once_flag metrics_once_;
+        Metrics metrics_storage_;
+        std::atomic<const Metrics *> metrics_{nullptr};
+    };
+
+} // namespace platform
@@ -0,0 +1,91 @@
+// device_stream.hpp - asynchronous copy/compute streams with CUDA and CPU stand-in backends.
+#pragma once
+
+// Kept C++17-clean: src/cuda implements the CUDA backend against this header.
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "platform/memory_pool.hpp"
+
+namespace platform {
+
+    enum class StreamBackend { kCpu, kCuda };
+
+    // In-order queue of asynchronous operations on "device" memory. On the CUDA backend device
+    // pointers come from cudaMalloc and host pointers should be pinned for copies to overlap; the
+    // CPU backend runs the same operations on a worker thread over host memory, so code written
+    // against this interface builds and tests on GPU-less machines.
+    class Stream {
+      public:
+        virtual ~Stream() = default;
+
+        virtual void copy_to_device(void *device_dst, const void *host_src, std::size_t bytes) = 0;
+        virtual void copy_to_host(void *host_dst, const void *device_src, std::size_t bytes) = 0;
+        // out[i] = a[i] + b[i] over device pointers.
+        virtual void vector_add(const float *a, const float *b, float *out, std::size_t n) = 0;
+        // Blocks until every operation submitted so far has finished. Returns false when any of
+        // them failed; on CUDA the error is sticky for the stream.
+        virtual bool synchronize() = 0;
+
+        virtual StreamBackend backend() const = 0;
+    };
+
+    std::unique_ptr<Stream> make_cpu_stream();
+
+#ifdef PLATFORM_ENABLE_CUDA
+    // Defined in src/cuda. Returns nullptr when no device is available.
+    std::unique_ptr<Stream> make_cuda_stream();
+    MemoryUpstream cuda_device_upstream();
+    MemoryUpstream cuda_pinned_upstream();
+#endif
+
+    // kCuda falls back to kCpu when CUDA is not compiled in or no device is present.
+    std::unique_ptr<Stream> make_stream(StreamBackend backend);
+
+    struct StreamedOptions {
+        // Independent streams; two are enough to overlap one batch's copies with another's kernel.
+        std::size_t streams{2};
+        std::size_t batch_elements{std::size_t{1} << 18};
+    };
+
+    // Batched vector add that overlaps H2D copies, kernels and D2H copies across streams. Each
+    // batch is staged through pinned host memory and runs on device buffers; both come from
+    // caching pools, so after the first call steady-state runs allocate nothing.
+    class StreamedVectorAdd {
+      public:
+        explicit StreamedVectorAdd(StreamBackend backend = StreamBackend::kCuda, StreamedOptions options = {});
+        ~StreamedVectorAdd();
+        StreamedVectorAdd(const StreamedVectorAdd &)            = delete;
+        StreamedVectorAdd &operator=(const StreamedVectorAdd &) = delete;
+
+        // out[i] = a[i] + b[i] for i < n. Blocks until `out` is complete; false on a stream error
+        // or failed allocation. Serialised by an internal mutex.
+        bool run(const float *a, const float *b, float *out, std::size_t n);
+
+        // Backend actually in use after any fallback.
+        StreamBackend backend() const {
+            return backend_;
+        }
+        const CachingMemoryPool &device_pool() const {
+            return device_pool_;
+        }
+        const CachingMemoryPool &staging_pool() const {
+            return staging_pool_;
+        }
+
+        // Publishes the pools as `<prefix>_device_pool_*` and `<prefix>_staging_pool_*`.
+        void bind_metrics(MetricsRegistry &registry, std::string_view prefix);
+
+      private:
+        StreamedOptions options_;
+        StreamBackend backend_;
+        CachingMemoryPool device_pool_;
+        CachingMemoryPool staging_pool_;
+        std::vector<std::unique_ptr<Stream>> streams_;
+        std::mutex mutex_;
+    };
+
+} // namespace platform
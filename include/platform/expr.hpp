@@ -0,0 +1,269 @@
+// expr.hpp - expression templates that fuse chains of elementwise float operations into one pass.
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "platform/cpu_features.hpp"
+#include "platform/cpu_kernels.hpp"
+#include "platform/parallel_for.hpp"
+
+// Usage:
+//   using namespace platform::expr;
+//   auto e = view(a) + view(b) * view(c);  // builds a tree of small value nodes; no work yet
+//   eval(e, out);                          // one vectorized pass: out[i] = a[i] + b[i] * c[i]
+//
+// Nodes hold spans and scalars by value, so an expression can outlive the temporaries used to
+// build it but not the arrays it refers to. The fused loop is instantiated once per instruction
+// set and picked at run time like the other CPU kernels.
+
+namespace platform::expr {
+
+    // Size of an expression with no array operands (it broadcasts to any length).
+    inline constexpr std::size_t kBroadcast = std::numeric_limits<std::size_t>::max();
+
+    struct NodeBase {};
+
+    template <class T>
+    concept Node = std::derived_from<std::remove_cvref_t<T>, NodeBase>;
+
+    template <class T>
+    concept Operand = Node<T> || std::is_arithmetic_v<std::remove_cvref_t<T>>;
+
+    // Array leaf.
+    struct View : NodeBase {
+        static constexpr std::size_t kStreams = 1;
+
+        std::span<const float> values;
+
+        float operator[](std::size_t i) const {
+            return values[i];
+        }
+        std::size_t size() const {
+            return values.size();
+        }
+    };
+
+    // Scalar leaf, broadcast to every element.
+    struct Scalar : NodeBase {
+        static constexpr std::size_t kStreams = 0;
+
+        float value{0.0f};
+
+        float operator[](std::size_t) const {
+            return value;
+        }
+        std::size_t size() const {
+            return kBroadcast;
+        }
+    };
+
+    template <class Op, class A> struct Unary : NodeBase {
+        static constexpr std::size_t kStreams = A::kStreams;
+
+        A a;
+
+        float operator[](std::size_t i) const {
+            return Op::apply(a[i]);
+        }
+        std::size_t size() const {
+            return a.size();
+        }
+    };
+
+    // Mismatched operand lengths evaluate over the shortest one, as vector_add_cpu() does.
+    template <class Op, class L, class R> struct Binary : NodeBase {
+        static constexpr std::size_t kStreams = L::kStreams + R::kStreams;
+
+        L l;
+        R r;
+
+        float operator[](std::size_t i) const {
+            return Op::apply(l[i], r[i]);
+        }
+        std::size_t size() const {
+            const std::size_t a = l.size();
+            const std::size_t b = r.size();
+            return a < b ? a : b;
+        }
+    };
+
+    namespace ops {
+        struct Add {
+            static float apply(float a, float b) {
+                return a + b;
+            }
+        };
+        struct Sub {
+            static float apply(float a, float b) {
+                return a - b;
+            }
+        };
+        struct Mul {
+            static float apply(float a, float b) {
+                return a * b;
+            }
+        };
+        struct Div {
+            static float apply(float a, float b) {
+                return a / b;
+            }
+        };
+        // Written as selects so they map onto minps/maxps; NaN handling follows those.
+        struct Min {
+            static float apply(float a, float b) {
+                return b < a ? b : a;
+            }
+        };
+        struct Max {
+            static float apply(float a, float b) {
+                return a < b ? b : a;
+            }
+        };
+        struct Neg {
+            static float apply(float a) {
+                return -a;
+            }
+        };
+        struct Abs {
+            static float apply(float a) {
+                return std::fabs(a);
+            }
+        };
+    } // namespace ops
+
+    inline View view(std::span<const float> values) {
+        return View{{}, values};
+    }
+
+    template <Operand T> auto as_node(const T &x) {
+        if constexpr (Node<T>) {
+            return x;
+        } else {
+            return Scalar{{}, static_cast<float>(x)};
+        }
+    }
+
+    template <class Op, class L, class R> auto make_binary(const L &l, const R &r) {
+        using LN = decltype(as_node(l));
+        using RN = decltype(as_node(r));
+        return Binary<Op, LN, RN>{{}, as_node(l), as_node(r)};
+    }
+
+    // Operators only participate when at least one side is already an expression, so they never
+    // capture arithmetic on plain floats.
+    template <Operand L, Operand R>
+        requires(Node<L> || Node<R>)
+    auto operator+(const L &l, const R &r) {
+        return make_binary<ops::Add>(l, r);
+    }
+    template <Operand L, Operand R>
+        requires(Node<L> || Node<R>)
+    auto operator-(const L &l, const R &r) {
+        return make_binary<ops::Sub>(l, r);
+    }
+    template <Operand L, Operand R>
+        requires(Node<L> || Node<R>)
+    auto operator*(const L &l, const R &r) {
+        return make_binary<ops::Mul>(l, r);
+    }
+    template <Operand L, Operand R>
+        requires(Node<L> || Node<R>)
+    auto operator/(const L &l, const R &r) {
+        return make_binary<ops::Div>(l, r);
+    }
+    template <Operand L, Operand R>
+        requires(Node<L> || Node<R>)
+    auto min(const L &l, const R &r) {
+        return make_binary<ops::Min>(l, r);
+    }
+    template <Operand L, Operand R>
+        requires(Node<L> || Node<R>)
+    auto max(const L &l, const R &r) {
+        return make_binary<ops::Max>(l, r);
+    }
+    template <Node A> auto operator-(const A &a) {
+        return Unary<ops::Neg, A>{{}, a};
+    }
+    template <Node A> auto abs(const A &a) {
+        return Unary<ops::Abs, A>{{}, a};
+    }
+    template <Node A, Operand Lo, Operand Hi> auto clamp(const A &a, const Lo &lo, const Hi &hi) {
+        return min(max(a, lo), hi);
+    }
+
+    namespace detail {
+        template <class E> using RangeKernel = void (*)(const E &, float *, std::size_t, std::size_t);
+
+        // The same loop compiled for each target; node accessors inline into it and the
+        // compiler vectorizes the whole tree. `out` may alias an operand exactly (each element is
+        // read before it is written), so the loop carries no dependence.
+#if defined(__clang__)
+#define PLATFORM_EXPR_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define PLATFORM_EXPR_IVDEP _Pragma("GCC ivdep")
+#else
+#define PLATFORM_EXPR_IVDEP
+#endif
+#define PLATFORM_EXPR_LOOP                                                                                             \
+    PLATFORM_EXPR_IVDEP for (std::size_t i = begin; i < end; ++i) {                                                   \
+        out[i] = e[i];                                                                                                 \
+    }
+
+        template <class E> void eval_range_baseline(const E &e, float *out, std::size_t begin, std::size_t end) {
+            PLATFORM_EXPR_LOOP
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PLATFORM_EXPR_X86 1
+        template <class E>
+        __attribute__((target("avx2,fma"))) void eval_range_avx2(const E &e, float *out, std::size_t begin,
+                                                                 std::size_t end) {
+            PLATFORM_EXPR_LOOP
+        }
+
+        template <class E>
+        __attribute__((target("avx512f"))) void eval_range_avx512(const E &e, float *out, std::size_t begin,
+                                                                  std::size_t end) {
+            PLATFORM_EXPR_LOOP
+        }
+#endif
+#undef PLATFORM_EXPR_LOOP
+#undef PLATFORM_EXPR_IVDEP
+
+        // SSE2 and NEON are the baseline of their architectures, so they share the default build.
+        template <class E> RangeKernel<E> range_kernel(const KernelOptions &options) {
+            const SimdIsa isa =
+                options.isa.has_value() && simd_isa_supported(*options.isa) ? *options.isa : active_simd_isa();
+            switch (isa) {
+#ifdef PLATFORM_EXPR_X86
+                case SimdIsa::kAvx2:
+                    return &eval_range_avx2<E>;
+                case SimdIsa::kAvx512:
+                    return &eval_range_avx512<E>;
+#endif
+                default:
+                    return &eval_range_baseline<E>;
+            }
+        }
+    } // namespace detail
+
+    // out[i] = e[i] for every i < e.size(), in a single pass over memory with no temporaries. Runs
+    // across options.pool when set. False when `out` is too short or `e` has no array operand.
+    template <Node E> bool eval(const E &e, std::span<float> out, const KernelOptions &options = {}) {
+        const std::size_t n = e.size();
+        if (n == kBroadcast || out.size() < n) {
+            return false;
+        }
+        const auto kernel = detail::range_kernel<E>(options);
+        float *dst        = out.data();
+        parallel_for(options.pool, n, (E::kStreams + 1) * sizeof(float), options.parallel,
+                     [&](std::size_t begin, std::size_t end) { kernel(e, dst, begin, end); });
+        return true;
+    }
+
+} // namespace platform::expr
@@ -0,0 +1,117 @@
+// latency_histogram.hpp - HDR-style fixed-memory latency histogram with O(1) record.
+#pragma once
+
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace platform {
+
+    namespace detail {
+        // Log-linear bucket layout shared by LatencyHistogram and the metrics Histogram. Values
+        // below 2^sub_bits map 1:1; every higher power-of-two range is split into 2^sub_bits
+        // linear buckets, bounding relative error by 2^-sub_bits.
+        constexpr std::size_t log_linear_index(std::uint64_t value, unsigned sub_bits) noexcept {
+            const std::uint64_t sub_count = std::uint64_t{1} << sub_bits;
+            if (value < sub_count) {
+                return static_cast<std::size_t>(value);
+            }
+            const auto shift = static_cast<unsigned>(std::bit_width(value) - 1) - sub_bits;
+            return (static_cast<std::size_t>(shift + 1) << sub_bits) |
+                   static_cast<std::size_t>((value >> shift) & (sub_count - 1));
+        }
+
+        // Largest value mapping to bucket `index`.
+        constexpr std::uint64_t log_linear_upper_bound(std::size_t index, unsigned sub_bits) noexcept {
+            const std::size_t sub_count = std::size_t{1} << sub_bits;
+            if (index < sub_count) {
+                return index;
+            }
+            const auto shift = static_cast<unsigned>((index >> sub_bits) - 1);
+            const auto lower = static_cast<std::uint64_t>(sub_count + (index & (sub_count - 1))) << shift;
+            return lower + ((std::uint64_t{1} << shift) - 1);
+        }
+
+        constexpr std::size_t log_linear_bucket_count(std::uint64_t highest, unsigned sub_bits) noexcept {
+            return log_linear_index(highest, sub_bits) + 1;
+        }
+    } // namespace detail
+
+    // Single-writer histogram for latency values (nanoseconds by convention). Memory is allocated
+    // once at construction and never grows; per-thread instances are combined with merge().
+    class LatencyHistogram {
+      public:
+        // Default covers one hour in nanoseconds at two significant decimal digits (~36 KiB).
+        static constexpr std::uint64_t kDefaultHighest = 3'600'000'000'000ULL;
+
+        // `significant_digits` (1..4) sets relative precision; values above `highest_trackable`
+        // are clamped into the top bucket and counted in saturated().
+        explicit LatencyHistogram(std::uint64_t highest_trackable = kDefaultHighest, int significant_digits = 2);
+
+        void record(std::uint64_t value) noexcept {
+            if (value > highest_) {
+                value = highest_;
+                ++saturated_;
+            }
+            ++counts_[detail::log_linear_index(value, sub_bits_)];
+            ++count_;
+            sum_ += value;
+            min_ = value < min_ ? value : min_;
+            max_ = value > max_ ? value : max_;
+        }
+
+        template <class Rep, class Period> void record(std::chrono::duration<Rep, Period> d) noexcept {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+            record(ns < 0 ? std::uint64_t{0} : static_cast<std::uint64_t>(ns));
+        }
+
+        // Adds `other` into this histogram. Returns false (and leaves this unchanged) when the
+        // two were built with different range or precision.
+        bool merge(const LatencyHistogram &other) noexcept;
+        void reset() noexcept;
+
+        std::uint64_t count() const noexcept {
+            return count_;
+        }
+        std::uint64_t saturated() const noexcept {
+            return saturated_;
+        }
+        std::uint64_t min() const noexcept {
+            return count_ == 0 ? 0 : min_;
+        }
+        std::uint64_t max() const noexcept {
+            return max_;
+        }
+        double mean() const noexcept {
+            return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+        }
+        // Value at percentile p (0..100): the upper bound of the bucket holding that rank, clamped
+        // to the observed [min, max].
+        std::uint64_t percentile(double p) const noexcept;
+
+        std::uint64_t highest_trackable() const noexcept {
+            return highest_;
+        }
+        unsigned sub_bucket_bits() const noexcept {
+            return sub_bits_;
+        }
+        std::size_t bucket_count() const noexcept {
+            return counts_.size();
+        }
+        std::size_t memory_bytes() const noexcept {
+            return sizeof(*this) + counts_.capacity() * sizeof(std::uint64_t);
+        }
+
+      private:
+        std::uint64_t highest_;
+        unsigned sub_bits_;
+        std::vector<std::uint64_t> counts_;
+        std::uint64_t count_{0};
+        std::uint64_t saturated_{0};
+        std::uint64_t sum_{0};
+        std::uint64_t min_{UINT64_MAX};
+        std::uint64_t max_{0};
+    };
+
+} // namespace platform
@@ -12,6 +12,8 @@ namespace platform {
 enum class LogLevel { kInfo, kWarn, kError, kDebug };
 
 void set_log_level(LogLevel level);
+// True when log(level, ...) would print; lets callers skip building or queueing a message.
+bool log_enabled(LogLevel level);
 void log(LogLevel level, const std::string& msg);
 
 }  // namespace platform
@@ -0,0 +1,123 @@
+// memory_pool.hpp - size-class caching allocator for device and pinned host staging memory.
+#pragma once
+
+// Kept C++17-clean: the CUDA translation units include this header through device_stream.hpp.
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace platform {
+
+    class MetricsRegistry;
+    class Counter;
+    class Gauge;
+
+    // Where a pool gets memory from when its cache has no block of the right size class:
+    // cudaMalloc, cudaMallocHost, or page-aligned host memory for the CPU backend and tests.
+    struct MemoryUpstream {
+        void *(*allocate)(std::size_t bytes){nullptr};
+        void (*deallocate)(void *ptr, std::size_t bytes){nullptr};
+        const char *name{"unknown"};
+    };
+
+    // Page-aligned operator new; stands in for device and pinned memory on GPU-less nodes.
+    MemoryUpstream host_upstream();
+
+    struct MemoryPoolStats {
+        std::uint64_t requests{0};
+        // Requests served from the cache without touching the upstream.
+        std::uint64_t hits{0};
+        std::uint64_t upstream_allocations{0};
+        std::uint64_t upstream_bytes{0};
+        std::size_t bytes_in_use{0};
+        std::size_t bytes_cached{0};
+    };
+
+    class CachingMemoryPool;
+
+    // RAII handle for one pooled block; returns it to the pool cache on destruction. The pool must
+    // outlive every block it hands out.
+    class PoolBlock {
+      public:
+        PoolBlock() = default;
+        PoolBlock(PoolBlock &&other) noexcept;
+        PoolBlock &operator=(PoolBlock &&other) noexcept;
+        PoolBlock(const PoolBlock &)            = delete;
+        PoolBlock &operator=(const PoolBlock &) = delete;
+        ~PoolBlock();
+
+        void *data() const {
+            return ptr_;
+        }
+        // Usable size: the request rounded up to its size class.
+        std::size_t size() const {
+            return bytes_;
+        }
+        explicit operator bool() const {
+            return ptr_ != nullptr;
+        }
+        template <class T> T *as() const {
+            return static_cast<T *>(ptr_);
+        }
+        void reset();
+
+      private:
+        friend class CachingMemoryPool;
+        PoolBlock(CachingMemoryPool *pool, void *ptr, std::size_t bytes) : pool_(pool), ptr_(ptr), bytes_(bytes) {}
+
+        CachingMemoryPool *pool_{nullptr};
+        void *ptr_{nullptr};
+        std::size_t bytes_{0};
+    };
+
+    // Caches released blocks by size class (powers of two up to 1 MiB, then whole MiB) so steady
+    // state batches never reach cudaMalloc/cudaMallocHost, which synchronise the device and cost
+    // tens of microseconds to milliseconds. Blocks are never split or coalesced. Thread-safe.
+    class CachingMemoryPool {
+      public:
+        explicit CachingMemoryPool(MemoryUpstream upstream);
+        ~CachingMemoryPool();
+        CachingMemoryPool(const CachingMemoryPool &)            = delete;
+        CachingMemoryPool &operator=(const CachingMemoryPool &) = delete;
+
+        // Returns an empty block when `bytes` is 0 or the upstream allocation fails.
+        PoolBlock acquire(std::size_t bytes);
+
+        // Returns every cached (not in-use) block to the upstream.
+        void trim();
+
+        MemoryPoolStats stats() const;
+        const char *upstream_name() const {
+            return upstream_.name;
+        }
+
+        // Publishes `<prefix>_requests_total`, `_hits_total`, `_upstream_allocations_total` and the
+        // `_bytes_in_use` / `_bytes_cached` gauges.
+        void bind_metrics(MetricsRegistry &registry, std::string_view prefix);
+
+        static std::size_t size_class(std::size_t bytes);
+
+      private:
+        friend class PoolBlock;
+        void release(void *ptr, std::size_t bytes);
+        void update_gauges();
+
+        struct Metrics {
+            Counter *requests{nullptr};
+            Counter *hits{nullptr};
+            Counter *upstream_allocations{nullptr};
+            Gauge *bytes_in_use{nullptr};
+            Gauge *bytes_cached{nullptr};
+        };
+
+        MemoryUpstream upstream_;
+        mutable std::mutex mutex_;
+        std::map<std::size_t, std::vector<void *>> free_;
+        MemoryPoolStats stats_;
+        Metrics metrics_;
+    };
+
+} // namespace platform
@@ -13,6 +13,10 @@
 
 namespace platform {
 
+class MetricsRegistry;
+class Counter;
+class Gauge;
+
 struct Message {
     std::string topic;
     std::string payload;
@@ -31,15 +35,32 @@ public:
 
     std::size_t subscriber_count(const std::string& topic) const;
 
+    // Publishes per-topic `<prefix>_published_total`, `<prefix>_deliveries_total` and
+    // `<prefix>_subscribers` labelled with `topic`; fan-out is deliveries / published.
+    // Only topics that have (or had) a subscriber are tracked.
+    void bind_metrics(MetricsRegistry& registry, std::string_view prefix);
+
 private:
     struct Entry {
         SubscriptionId id;
         Subscriber cb;
     };
 
+    struct Topic {
+        std::vector<Entry> entries;
+        Counter* published{nullptr};
+        Counter* deliveries{nullptr};
+        Gauge* subscribers{nullptr};
+    };
+
+    // Requires mutex_ held exclusively.
+    void bind_topic_metrics(const std::string& name, Topic& topic);
+
     SubscriptionId next_id_{1};
     mutable std::shared_mutex mutex_;
-    std::unordered_map<std::string, std::vector<Entry>> subscribers_;
+    std::unordered_map<std::string, Topic> subscribers_;
+    MetricsRegistry* metrics_{nullptr};
+    std::string metrics_prefix_;
     static std::mutex deadlock_mutex_;
 };
 
@@ -0,0 +1,189 @@
+// metrics.hpp - lock-free runtime metrics: sharded counters, gauges and log-linear histograms.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "platform/latency_histogram.hpp"
+
+namespace platform {
+
+    namespace detail {
+        inline constexpr std::size_t kCacheLine = 64;
+
+        // Each thread is assigned a stable shard index the first time it touches a sharded metric.
+        inline std::size_t this_thread_shard(std::size_t shard_count) noexcept {
+            static std::atomic<std::size_t> next{0};
+            static thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+            return index % shard_count;
+        }
+    } // namespace detail
+
+    // Monotonic counter. Writers increment their own cache-line shard; readers merge all shards.
+    class Counter {
+      public:
+        static constexpr std::size_t kShards = 16;
+
+        void add(std::uint64_t delta = 1) noexcept {
+            shards_[detail::this_thread_shard(kShards)].value.fetch_add(delta, std::memory_order_relaxed);
+        }
+
+        std::uint64_t value() const noexcept {
+            std::uint64_t total = 0;
+            for (const auto &shard : shards_) {
+                total += shard.value.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+      private:
+        struct alignas(detail::kCacheLine) Shard {
+            std::atomic<std::uint64_t> value{0};
+        };
+        std::array<Shard, kShards> shards_{};
+    };
+
+    // Point-in-time value (queue depth, worker count, ...).
+    class Gauge {
+      public:
+        void set(std::int64_t value) noexcept {
+            value_.store(value, std::memory_order_relaxed);
+        }
+        void add(std::int64_t delta) noexcept {
+            value_.fetch_add(delta, std::memory_order_relaxed);
+        }
+        std::int64_t value() const noexcept {
+            return value_.load(std::memory_order_relaxed);
+        }
+
+      private:
+        alignas(detail::kCacheLine) std::atomic<std::int64_t> value_{0};
+    };
+
+    struct HistogramSnapshot {
+        std::uint64_t count{0};
+        std::uint64_t sum{0};
+        std::uint64_t min{0};
+        std::uint64_t max{0};
+        std::vector<std::uint64_t> buckets;
+
+        double mean() const {
+            return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+        }
+        // Upper bound of the bucket holding quantile q (0..1), clamped to the observed max.
+        std::uint64_t quantile(double q) const;
+    };
+
+    // Concurrent log-linear histogram of non-negative integers (typically nanoseconds), using the
+    // LatencyHistogram bucket layout with kSubBuckets linear buckets per power of two.
+    class Histogram {
+      public:
+        static constexpr unsigned kSubBucketBits = 3;
+        static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+        static constexpr std::size_t kBucketCount = detail::log_linear_bucket_count(UINT64_MAX, kSubBucketBits);
+
+        void record(std::uint64_t value) noexcept {
+            buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+            count_.fetch_add(1, std::memory_order_relaxed);
+            sum_.fetch_add(value, std::memory_order_relaxed);
+            auto seen = max_.load(std::memory_order_relaxed);
+            while (value > seen && !max_.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+            }
+            seen = min_.load(std::memory_order_relaxed);
+            while (value < seen && !min_.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        template <class Rep, class Period> void record(std::chrono::duration<Rep, Period> d) noexcept {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+            record(ns < 0 ? std::uint64_t{0} : static_cast<std::uint64_t>(ns));
+        }
+
+        HistogramSnapshot snapshot() const;
+
+        static std::size_t bucket_index(std::uint64_t value) noexcept {
+            return detail::log_linear_index(value, kSubBucketBits);
+        }
+        // Largest value that maps to bucket `index`.
+        static std::uint64_t bucket_upper_bound(std::size_t index) noexcept {
+            return detail::log_linear_upper_bound(index, kSubBucketBits);
+        }
+
+      private:
+        std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_{};
+        std::atomic<std::uint64_t> count_{0};
+        std::atomic<std::uint64_t> sum_{0};
+        std::atomic<std::uint64_t> min_{UINT64_MAX};
+        std::atomic<std::uint64_t> max_{0};
+    };
+
+    struct CounterSample {
+        std::string name;
+        std::uint64_t value{0};
+    };
+
+    struct GaugeSample {
+        std::string name;
+        std::int64_t value{0};
+    };
+
+    struct HistogramSample {
+        std::string name;
+        HistogramSnapshot data;
+    };
+
+    struct MetricsSnapshot {
+        std::chrono::steady_clock::time_point taken_at{};
+        std::vector<CounterSample> counters;
+        std::vector<GaugeSample> gauges;
+        std::vector<HistogramSample> histograms;
+
+        const CounterSample *find_counter(std::string_view name) const;
+        const GaugeSample *find_gauge(std::string_view name) const;
+        const HistogramSample *find_histogram(std::string_view name) const;
+    };
+
+    // Per-second rate of a counter between two snapshots; 0 when absent or no time elapsed.
+    double counter_rate(const MetricsSnapshot &before, const MetricsSnapshot &after, std::string_view name);
+
+    // Owns named metrics. Registration takes a mutex (cold path); returned references stay valid
+    // for the registry's lifetime and are updated without locks. Names may carry a Prometheus
+    // label suffix, e.g. `bus_published_total{topic="sensor.raw"}`.
+    class MetricsRegistry {
+      public:
+        MetricsRegistry()                                   = default;
+        MetricsRegistry(const MetricsRegistry &)            = delete;
+        MetricsRegistry &operator=(const MetricsRegistry &) = delete;
+
+        Counter &counter(std::string_view name);
+        Gauge &gauge(std::string_view name);
+        Histogram &histogram(std::string_view name);
+
+        MetricsSnapshot snapshot() const;
+
+        // Prometheus text exposition format; histograms are rendered as summaries.
+        void write_text(std::ostream &os) const;
+        std::string render_text() const;
+        // Writes to `path` via a temporary file and rename so readers never see a partial dump.
+        bool write_text_file(const std::string &path) const;
+
+      private:
+        template <class T> using Map = std::map<std::string, std::unique_ptr<T>, std::less<>>;
+
+        mutable std::mutex mutex_;
+        Map<Counter> counters_;
+        Map<Gauge> gauges_;
+        Map<Histogram> histograms_;
+    };
+
+} // namespace platform
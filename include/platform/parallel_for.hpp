@@ -0,0 +1,66 @@
+// parallel_for.hpp - cache-aware chunked data-parallel loops over a ThreadPool.
+#pragma once
+
+#include <cstddef>
+
+#include "platform/thread_pool.hpp"
+
+namespace platform {
+
+    struct ParallelOptions {
+        // Inputs shorter than this run on the calling thread; below it task hand-off costs more
+        // than the extra cores save.
+        std::size_t min_parallel_elements{std::size_t{1} << 16};
+        // Elements per task; 0 sizes chunks so the data one task touches fits in half of L2.
+        std::size_t chunk_elements{0};
+    };
+
+    // Elements per task when `n` elements are shared by `participants` threads and each element
+    // touches `bytes_per_element` bytes across all streams (12 for `out = a + b` on floats).
+    // Automatic sizes are whole multiples of 1024 elements (a page of floats) so, with
+    // first-touch NUMA placement, tasks never share a page or a cache line.
+    std::size_t parallel_chunk_elements(std::size_t n, std::size_t participants, std::size_t bytes_per_element,
+                                        const ParallelOptions &options);
+
+    namespace detail {
+        void run_chunks(ThreadPool &pool, std::size_t chunks, void (*invoke)(const void *, std::size_t),
+                        const void *fn);
+    } // namespace detail
+
+    // Calls fn(chunk) once for every chunk in [0, chunks) and returns when all have finished.
+    // Pool workers and the calling thread claim chunks from a shared cursor, so the call is safe
+    // from inside a pool job: the caller never waits on a task that has not started, and helpers
+    // are only queued where try_enqueue() finds room (refusals count in the pool's rejected total).
+    // `fn` must not throw. Runs serially when `pool` is null.
+    template <class Fn> void parallel_for_chunks(ThreadPool *pool, std::size_t chunks, const Fn &fn) {
+        if (pool == nullptr || pool->thread_count() == 0 || chunks <= 1) {
+            for (std::size_t c = 0; c < chunks; ++c) {
+                fn(c);
+            }
+            return;
+        }
+        detail::run_chunks(
+            *pool, chunks, [](const void *f, std::size_t c) { (*static_cast<const Fn *>(f))(c); }, &fn);
+    }
+
+    // Splits [0, n) into parallel_chunk_elements() ranges and calls fn(begin, end) for each.
+    // Small inputs (below options.min_parallel_elements) become a single inline call.
+    template <class Fn>
+    void parallel_for(ThreadPool *pool, std::size_t n, std::size_t bytes_per_element, const ParallelOptions &options,
+                      const Fn &fn) {
+        if (n == 0) {
+            return;
+        }
+        if (pool == nullptr || pool->thread_count() == 0 || n < options.min_parallel_elements) {
+            fn(std::size_t{0}, n);
+            return;
+        }
+        const std::size_t chunk  = parallel_chunk_elements(n, pool->thread_count() + 1, bytes_per_element, options);
+        const std::size_t chunks = (n + chunk - 1) / chunk;
+        parallel_for_chunks(pool, chunks, [&](std::size_t c) {
+            const std::size_t begin = c * chunk;
+            fn(begin, begin + chunk < n ? begin + chunk : n);
+        });
+    }
+
+} // namespace platform
@@ -0,0 +1,108 @@
+// perf_counters.hpp - in-process hardware counter sampling via perf_event_open (Linux only).
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "platform/metrics.hpp"
+
+namespace platform {
+
+    struct PerfSample {
+        std::uint64_t cycles{0};
+        std::uint64_t instructions{0};
+        std::uint64_t cache_misses{0};
+        std::uint64_t branch_misses{0};
+
+        double ipc() const {
+            return cycles == 0 ? 0.0 : static_cast<double>(instructions) / static_cast<double>(cycles);
+        }
+        // Cache misses per thousand instructions (MPKI).
+        double cache_mpki() const {
+            return instructions == 0 ? 0.0 : 1000.0 * static_cast<double>(cache_misses) / static_cast<double>(instructions);
+        }
+
+        PerfSample &operator+=(const PerfSample &other) {
+            cycles += other.cycles;
+            instructions += other.instructions;
+            cache_misses += other.cache_misses;
+            branch_misses += other.branch_misses;
+            return *this;
+        }
+        // Saturating difference; counters are monotonic but multiplex scaling can jitter.
+        friend PerfSample operator-(const PerfSample &a, const PerfSample &b);
+    };
+
+    // Counter group bound to the constructing thread (user-space events only). When the kernel
+    // refuses access (perf_event_paranoid, containers, non-Linux) available() is false and read()
+    // returns zeros, so callers never need a separate code path.
+    class PerfCounters {
+      public:
+        PerfCounters();
+        ~PerfCounters();
+        PerfCounters(const PerfCounters &)            = delete;
+        PerfCounters &operator=(const PerfCounters &) = delete;
+
+        bool available() const {
+            return leader_fd_ >= 0;
+        }
+        const std::string &unavailable_reason() const {
+            return reason_;
+        }
+        // Cumulative counts since construction, scaled for multiplexing.
+        PerfSample read() const;
+
+        // Lazily opened per-thread instance; counters must be read on the thread that opened them.
+        static PerfCounters &this_thread();
+
+      private:
+        static constexpr int kEvents = 4;
+
+        int leader_fd_{-1};
+        int fds_[kEvents]{-1, -1, -1, -1};
+        // Index of each opened event within the group read, or -1 when that event is missing.
+        int slot_[kEvents]{-1, -1, -1, -1};
+        std::string reason_;
+    };
+
+    // Registry counters for one code region; IPC and MPKI are derived from the totals.
+    struct PerfMetrics {
+        Counter *cycles{nullptr};
+        Counter *instructions{nullptr};
+        Counter *cache_misses{nullptr};
+        Counter *branch_misses{nullptr};
+
+        // Registers `<prefix>_cycles_total`, `_instructions_total`, `_cache_misses_total` and
+        // `_branch_misses_total`.
+        static PerfMetrics bind(MetricsRegistry &registry, std::string_view prefix);
+        void add(const PerfSample &sample) const;
+    };
+
+    // RAII region: samples this thread's counters on entry and adds the delta to `sink` on exit.
+    class PerfScope {
+      public:
+        explicit PerfScope(const PerfMetrics *sink = nullptr)
+            : counters_(PerfCounters::this_thread()), sink_(sink), start_(counters_.read()) {}
+        ~PerfScope() {
+            if (sink_ != nullptr && counters_.available()) {
+                sink_->add(elapsed());
+            }
+        }
+        PerfScope(const PerfScope &)            = delete;
+        PerfScope &operator=(const PerfScope &) = delete;
+
+        PerfSample elapsed() const {
+            return counters_.read() - start_;
+        }
+        bool available() const {
+            return counters_.available();
+        }
+
+      private:
+        PerfCounters &counters_;
+        const PerfMetrics *sink_;
+        PerfSample start_;
+    };
+
+} // namespace platform
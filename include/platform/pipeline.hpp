@@ -1,17 +1,29 @@
-// pipeline.hpp - skeleton perception/control pipeline with pub/sub bus.
+// pipeline.hpp - configurable sensor/perception/control pipeline over the pub/sub bus.
 #pragma once
 
 #include <atomic>
 #include <functional>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stop_token>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "platform/bounded_queue.hpp"
+#include "platform/deadline_executor.hpp"
 #include "platform/message_bus.hpp"
-#include "platform/scheduler.hpp"
+#include "platform/metrics.hpp"
+#include "platform/perf_counters.hpp"
+#include "platform/pipeline_config.hpp"
 #include "platform/thread_pool.hpp"
+#include "platform/topic_synchronizer.hpp"
+#include "platform/triple_buffer.hpp"
 
 namespace platform {
 
@@ -28,28 +40,124 @@ struct ControlCommand {
 
 class Pipeline {
 public:
-    Pipeline();
+    // Validates the configuration (validate_pipeline_options) first; an invalid one builds no
+    // pool, executor, stage or thread.
+    explicit Pipeline(PipelineOptions options = {});
     ~Pipeline();
 
-    void start();
+    // Starts sensors and stages. Logs every configuration problem and returns false, starting
+    // nothing, when the configuration is invalid.
+    bool start();
     void stop();
 
     // Hooks for tests/benchmarks.
     std::size_t processed_samples() const { return processed_samples_.load(); }
 
     MessageBus& bus() { return bus_; }
+    MetricsRegistry& metrics() { return metrics_; }
+    // Resolved configuration, default sensor and stages included.
+    const PipelineOptions& options() const { return options_; }
+
+    // Samples hardware counters around each stage job into
+    // `pipeline_<stage>_{cycles,instructions,cache_misses,branch_misses}_total`. Call before start().
+    void enable_perf_sampling();
 
 private:
-    void start_sensor();
-    void start_perception();
-    void start_control();
+    // Structure-of-arrays sample buffer for batched perception; reserved once, then reused.
+    struct SampleBatch {
+        std::vector<std::int64_t> timestamps_ns;
+        std::vector<double> values;
+
+        std::size_t size() const { return values.size(); }
+        void reserve(std::size_t n) { timestamps_ns.reserve(n); values.reserve(n); }
+        void clear() { timestamps_ns.clear(); values.clear(); }
+    };
+
+    // What control hands to the actuator thread.
+    struct ActuatorCommand {
+        double effort{0.0};
+        std::int64_t source_ns{0};
+    };
+
+    struct Stage {
+        StageConfig config;
+        PerfMetrics perf;
+        // kDedicated only: the stage's inbox and the thread draining it.
+        std::unique_ptr<BoundedQueue<Message>> inbox;
+        std::jthread thread;
+        Counter* shed{nullptr};
+        // kPool with ShedPolicy::kCoalesce: the newest message not yet handled, and whether a pool
+        // job to handle it is queued.
+        std::mutex pending_mutex;
+        std::optional<Message> pending;
+        bool drain_queued{false};
+        // kFusion only. The synchronizer is single-threaded, so pool placement serialises on the mutex.
+        std::mutex fusion_mutex;
+        std::unique_ptr<TopicSynchronizer> sync;
+        std::uint32_t fused_sequence{0};
+        Counter* fused{nullptr};
+        Counter* unmatched{nullptr};
+        // Batched perception only (batch_size > 1): arrivals fill `filling` under the mutex; the
+        // stage thread swaps it with `draining` and processes that without the lock.
+        std::mutex batch_mutex;
+        std::condition_variable_any batch_ready;
+        SampleBatch filling;
+        SampleBatch draining;
+        std::vector<double> efforts;
+        std::size_t batch_limit{0};
+        std::chrono::steady_clock::time_point first_arrival;
+        Histogram* batch_sizes{nullptr};
+        Counter* batch_timeouts{nullptr};
+        Counter* batch_dropped{nullptr};
+    };
+
+    void start_sensors();
+    void start_stages();
     void start_io();
+    void start_actuator();
+    void run_actuator(std::stop_token st);
+    void run_sensors(std::stop_token st);
+    void offer_to_pool(Stage& stage, const Message& msg);
+    void offer_to_inbox(Stage& stage, const Message& msg);
+    void offer_to_deadline(Stage& stage, const Message& msg);
+    void coalesce(Stage& stage, const Message& msg);
+    void handle(Stage& stage, const Message& msg);
+    void perceive(const Stage& stage, const Message& msg);
+    void actuate(const Message& msg);
+    void fuse(Stage& stage, const Message& msg);
+    void collect(Stage& stage, const Message& msg);
+    void run_batches(Stage& stage, std::stop_token st);
+    void perceive_batch(Stage& stage);
+    void publish_fused(Stage& stage, std::span<const StampedValue> tuple);
 
-    Scheduler sensor_scheduler_;
-    ThreadPool worker_pool_;
+    PipelineOptions options_;
+    MetricsRegistry metrics_;
+    Histogram& sensor_to_actuator_ns_;
+    Counter& malformed_payloads_;
+    Counter& log_shed_;
+    Counter& actuator_writes_;
+    // Commands replaced before the actuator applied them, or older than one already handed over.
+    Counter& actuator_superseded_;
+    // What validate_pipeline_options found; when non-empty, nothing below is built.
+    const std::vector<std::string> config_errors_;
+    // Null when the configuration is invalid.
+    std::unique_ptr<ThreadPool> worker_pool_;
+    // Runs the jobs of stages with a deadline; null when no stage sets one.
+    std::unique_ptr<DeadlineExecutor> deadline_executor_;
     MessageBus bus_;
+    std::vector<std::unique_ptr<Stage>> stages_;
+    // One per sensor, in options_.sensors order.
+    std::vector<Counter*> sensor_samples_;
+    std::jthread sensor_thread_;
+    // Control -> actuator handoff when options_.actuator_period > 0. The buffer itself is
+    // lock-free; the mutex only orders control stages that run on more than one thread.
+    TripleBuffer<ActuatorCommand> actuator_command_;
+    std::mutex actuator_write_mutex_;
+    std::int64_t actuator_newest_ns_{0};
+    std::jthread actuator_thread_;
     std::atomic<bool> running_{false};
     std::atomic<std::size_t> processed_samples_{0};
+    std::atomic<bool> perf_sampling_{false};
 };
 
 }  // namespace platform
@@ -0,0 +1,166 @@
+// pipeline_config.hpp - data-driven Pipeline description: sensors, stages, placement and validation.
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "platform/deadline_executor.hpp"
+#include "platform/thread_pool.hpp"
+
+namespace platform {
+
+    // Encoding of sensor.raw and control.cmd payloads (docs/topic_contract.md). Consumers detect the
+    // format of each message, so mixed producers interoperate.
+    enum class PayloadFormat { kText, kBinary };
+
+    enum class StageKind {
+        // Decodes sensor samples and publishes a control command (effort = value * gain).
+        kPerception,
+        // Decodes control commands, drives the (simulated) actuator and records end-to-end latency.
+        kControl,
+        // Time-aligns one sample from each input topic (TopicSynchronizer) and publishes a sensor
+        // sample named after the stage whose value is their mean and whose timestamp is the oldest.
+        kFusion,
+    };
+
+    // Where a stage handles each message from its input topic.
+    enum class StagePlacement {
+        // On the publishing thread, inside MessageBus::publish. No hand-off cost, but it delays the
+        // publisher and every later subscriber.
+        kInline,
+        // As a job on the pipeline's shared worker pool.
+        kPool,
+        // On a thread owned by the stage, fed through its own bounded queue in arrival order.
+        kDedicated,
+    };
+
+    // What a pool or dedicated stage does with a message that arrives while it is saturated.
+    enum class ShedPolicy {
+        // Wait for room (ThreadPool::enqueue, or the inbox push); backpressure reaches the publisher.
+        kBlock,
+        // Drop the arriving message.
+        kDropNewest,
+        // Drop the oldest queued message to make room. Dedicated stages only.
+        kDropOldest,
+        // Keep only the newest message not yet handled; the stage never has more than one queued.
+        kCoalesce,
+    };
+
+    struct SensorConfig {
+        std::string name{};
+        std::chrono::milliseconds period{50};
+        std::string topic{"sensor.raw"};
+    };
+
+    struct StageConfig {
+        std::string name{};
+        StageKind kind{StageKind::kPerception};
+        // Perception and control stages handle each topic independently; fusion aligns them.
+        std::vector<std::string> input_topics{};
+        // Perception and fusion only.
+        std::string output_topic{};
+        StagePlacement placement{StagePlacement::kPool};
+        // Inline stages always block. Every message a stage sheds counts in
+        // `pipeline_shed_total{stage="<name>"}`.
+        ShedPolicy shed{ShedPolicy::kBlock};
+        // Pool lane, and admission class when shed is not kBlock (ThreadPool::try_enqueue).
+        JobPriority priority{JobPriority::kNormal};
+        // Pool stages with shed=kDropNewest only: above zero, each message is handled on the
+        // pipeline's EDF executor (DeadlineExecutor) instead of the pool, due `deadline` after its
+        // sensor timestamp; `late` decides whether a job that cannot start in time still runs.
+        std::chrono::microseconds deadline{0};
+        LatePolicy late{LatePolicy::kDrop};
+        double gain{0.5};
+        // Fusion only: matching window and per-topic buffer size.
+        std::chrono::milliseconds tolerance{5};
+        std::size_t buffer_capacity{64};
+        // Perception with kDedicated only: above 1, samples are decoded on arrival into
+        // structure-of-arrays buffers, and the stage thread processes everything buffered once
+        // batch_size samples are waiting or the oldest has waited batch_flush.
+        std::size_t batch_size{1};
+        std::chrono::microseconds batch_flush{1000};
+        // Unbatched kDedicated only: how the stage thread waits on its empty inbox.
+        WaitStrategy wait{};
+    };
+
+    struct PipelineOptions {
+        // Period of the default sensor; configured sensors carry their own.
+        std::chrono::milliseconds sensor_period{50};
+        // 0 selects std::thread::hardware_concurrency(), or 1 when the pool is elastic.
+        std::size_t worker_threads{0};
+        std::size_t queue_capacity{256};
+        // Lane selection, aging and reserved high-priority workers of the shared pool.
+        PoolPriorities pool{};
+        // CPU placement and thread names of the shared pool's workers.
+        ThreadPlacement pool_placement{.name = "pipe-pool"};
+        // Elastic pool when max_threads exceeds worker_threads: grows while queued jobs wait longer
+        // than target_wait and retires workers idle for idle_timeout.
+        PoolScaling pool_scaling{};
+        // How idle pool workers wait for jobs.
+        WaitStrategy pool_wait{};
+        // Threads of the EDF executor, which exists only when a stage sets a deadline.
+        std::size_t deadline_workers{1};
+        PayloadFormat payload_format{PayloadFormat::kText};
+        // 0 applies each control command as it arrives. Otherwise control stages only hand the
+        // newest command to a dedicated actuator thread that applies it once per period.
+        std::chrono::microseconds actuator_period{0};
+        // Empty selects one "imu" sensor publishing sensor.raw every sensor_period.
+        std::vector<SensorConfig> sensors{};
+        // Empty selects "perception" (sensor.raw -> control.cmd, dropping newest at normal priority)
+        // and "control" (control.cmd, coalescing at high priority), both on the pool.
+        std::vector<StageConfig> stages{};
+    };
+
+    // Returns `options` with the default sensor and stages filled in where it leaves them empty.
+    PipelineOptions with_default_graph(PipelineOptions options);
+
+    // Checks the resolved graph: unique non-empty names, positive periods, sensor names that fit
+    // the payload format, every stage input produced by a sensor or a publishing stage, at least
+    // two distinct inputs per fusion stage, batching only on dedicated perception stages, deadlines
+    // only on dropping pool stages, wait strategies only on unbatched dedicated stages, and no
+    // publishing cycles. Returns one message per problem; empty means valid.
+    std::vector<std::string> validate_pipeline_options(const PipelineOptions &options);
+
+    // Line-based config; `#` starts a comment, and keys may appear in any order. `in` takes a
+    // comma-separated topic list:
+    //
+    //   worker_threads = 4
+    //   queue_capacity = 256
+    //   pool_lanes = weighted           # or strict
+    //   pool_aging_us = 20000
+    //   pool_reserved_workers = 1
+    //   pool_pin = core                 # none, core or node
+    //   pool_numa_groups = on
+    //   pool_exclude_cpus = 0           # kernel CPU list, e.g. 0-1,4
+    //   pool_max_threads = 8            # elastic pool, from worker_threads up to 8
+    //   pool_target_wait_us = 1000
+    //   pool_idle_ms = 1000
+    //   pool_wait = spin_park           # block, spin_park or spin
+    //   pool_spin_us = 50
+    //   deadline_workers = 1
+    //   payload_format = binary
+    //   actuator_period_us = 1000
+    //   sensor imu   period_ms=10  topic=imu.raw
+    //   sensor wheel period_ms=20  topic=wheel.raw
+    //   sensor gps   period_ms=100
+    //   stage fused      kind=fusion     in=imu.raw,wheel.raw out=sensor.raw tolerance_ms=5 buffer=64
+    //   stage perception kind=perception in=sensor.raw out=control.cmd placement=pool gain=0.5
+    //   stage batched    kind=perception in=lidar.raw  out=control.cmd placement=dedicated batch=64 flush_us=500
+    //   stage control    kind=control    in=control.cmd placement=dedicated shed=coalesce wait=spin_park spin_us=100
+    //   stage steering   kind=control    in=steer.cmd   shed=drop_newest deadline_us=2000 late=drop
+    //   stage monitor    kind=perception in=wheel.raw  out=monitor.cmd shed=drop_newest priority=low
+    //
+    // Returns nullopt with `error` set to "line N: ..." on a syntax error. The result is not
+    // validated: call validate_pipeline_options() (after with_default_graph()) to check it, as the
+    // Pipeline constructor does.
+    std::optional<PipelineOptions> parse_pipeline_config(std::string_view text, std::string &error);
+    std::optional<PipelineOptions> load_pipeline_config(const std::string &path, std::string &error);
+
+    const char *to_string(StagePlacement placement);
+    const char *to_string(ShedPolicy policy);
+
+} // namespace platform
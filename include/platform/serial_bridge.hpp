@@ -0,0 +1,148 @@
+// serial_bridge.hpp - bridges COBS-framed MCU serial traffic onto MessageBus topics (Linux only).
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "platform/message_bus.hpp"
+#include "platform/serial_framing.hpp"
+
+namespace platform {
+
+    class MetricsRegistry;
+    class Counter;
+
+    // Owning handle for a tty or PTY file descriptor, configured raw (no echo, no line editing,
+    // no CR/LF translation) so frames pass through byte-exact.
+    class SerialPort {
+      public:
+        SerialPort() = default;
+        explicit SerialPort(int fd, std::string name = {}) : fd_(fd), name_(std::move(name)) {}
+        ~SerialPort();
+        SerialPort(SerialPort &&other) noexcept;
+        SerialPort &operator=(SerialPort &&other) noexcept;
+        SerialPort(const SerialPort &)            = delete;
+        SerialPort &operator=(const SerialPort &) = delete;
+
+        // Opens a tty (e.g. /dev/ttyUSB0) in raw 8N1 mode at `baud`; nullopt on failure or on an
+        // unsupported baud rate.
+        static std::optional<SerialPort> open(const std::string &path, int baud = 115200);
+
+        // Pseudo-terminal pair standing in for an MCU link: bytes written to one end are read from
+        // the other. `first` is the master (the "MCU" side), `second` the raw-mode slave.
+        static std::optional<std::pair<SerialPort, SerialPort>> open_pty_pair();
+
+        int fd() const {
+            return fd_;
+        }
+        bool is_open() const {
+            return fd_ >= 0;
+        }
+        const std::string &name() const {
+            return name_;
+        }
+
+      private:
+        int fd_{-1};
+        std::string name_;
+    };
+
+    struct SerialBridgeOptions {
+        // Frames decoded from the port are published here...
+        std::string inbound_topic{"sensor.raw"};
+        // ...and messages on this topic are framed and written to the port.
+        std::string outbound_topic{"control.cmd"};
+        std::size_t max_payload{256};
+        // Bytes requested per read(); every frame completed by one read is published in that batch.
+        std::size_t read_chunk{4096};
+        // Outbound frames beyond this many queued bytes are dropped rather than blocking publishers.
+        std::size_t max_pending_bytes{64 * 1024};
+    };
+
+    struct SerialBridgeStats {
+        std::uint64_t frames_in{0};
+        // Frames accepted into the outbound queue.
+        std::uint64_t frames_out{0};
+        std::uint64_t bytes_in{0};
+        std::uint64_t bytes_out{0};
+        // CRC, framing and overrun errors reported by the decoder.
+        std::uint64_t decode_errors{0};
+        std::uint64_t dropped_out{0};
+    };
+
+    // One epoll thread services the port: readable bytes go through a FrameDecoder and out onto
+    // the bus, and outbound frames queued by the bus subscription are flushed whenever the port
+    // accepts them. An eventfd wakes the loop for new outbound data and for stop().
+    class SerialBridge {
+      public:
+        SerialBridge(MessageBus &bus, SerialPort port, SerialBridgeOptions options = {});
+        ~SerialBridge();
+
+        SerialBridge(const SerialBridge &)            = delete;
+        SerialBridge &operator=(const SerialBridge &) = delete;
+
+        // Returns false when the port is not open or epoll/eventfd setup fails (and on non-Linux).
+        bool start();
+        void stop();
+
+        SerialBridgeStats stats() const;
+
+        // Registers `<prefix>_frames_in_total`, `_frames_out_total`, `_bytes_in_total`,
+        // `_bytes_out_total`, `_decode_errors_total` and `_dropped_out_total`. Call before start().
+        void bind_metrics(MetricsRegistry &registry, std::string_view prefix);
+
+      private:
+        void run(std::stop_token st);
+        bool read_port(serial::FrameDecoder &decoder, Message &message);
+        bool flush_outbound();
+        void queue_outbound(std::string_view payload);
+        void wake() const;
+        void update_write_interest(bool want_write);
+
+        struct Counters {
+            std::atomic<std::uint64_t> frames_in{0};
+            std::atomic<std::uint64_t> frames_out{0};
+            std::atomic<std::uint64_t> bytes_in{0};
+            std::atomic<std::uint64_t> bytes_out{0};
+            std::atomic<std::uint64_t> decode_errors{0};
+            std::atomic<std::uint64_t> dropped_out{0};
+        };
+        struct BoundMetrics {
+            Counter *frames_in{nullptr};
+            Counter *frames_out{nullptr};
+            Counter *bytes_in{nullptr};
+            Counter *bytes_out{nullptr};
+            Counter *decode_errors{nullptr};
+            Counter *dropped_out{nullptr};
+        };
+
+        MessageBus &bus_;
+        SerialPort port_;
+        SerialBridgeOptions options_;
+        int epoll_fd_{-1};
+        int wake_fd_{-1};
+        bool write_interest_{false};
+        SubscriptionId subscription_{0};
+
+        std::mutex out_mutex_;
+        // Encoded frames queued by publishers; the I/O thread swaps them into `writing_`.
+        std::string out_pending_;
+        // I/O thread only: bytes being written and how many of them the port has taken.
+        std::string writing_;
+        std::size_t written_{0};
+        std::string read_buffer_;
+
+        Counters counters_;
+        BoundMetrics metrics_;
+        std::jthread thread_;
+    };
+
+} // namespace platform
@@ -0,0 +1,82 @@
+// serial_framing.hpp - COBS + CRC-32 framing for the MCU<->SBC serial link, with a streaming decoder.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace platform::serial {
+
+    // Frame on the wire: COBS(payload || CRC-32(payload) little-endian) followed by one 0x00
+    // delimiter. COBS removes every zero from the body, so a receiver that loses bytes or joins
+    // mid-stream resynchronises at the next delimiter, and the CRC rejects whatever garbage it
+    // assembled before that.
+
+    // CRC-32/ISO-HDLC (the zlib/Ethernet CRC), slice-by-8. `crc` continues a previous call.
+    std::uint32_t crc32(std::span<const char> bytes, std::uint32_t crc = 0);
+
+    inline constexpr std::size_t kCrcBytes = 4;
+
+    // Worst-case encoded size of a frame carrying `payload` bytes, delimiter included.
+    constexpr std::size_t max_frame_size(std::size_t payload) {
+        const std::size_t body = payload + kCrcBytes;
+        return body + body / 254 + 2;
+    }
+
+    // Writes one frame into `out` and returns its length, or 0 when `out` is smaller than
+    // max_frame_size(payload.size()). Never allocates.
+    std::size_t encode_frame(std::span<const char> payload, std::span<char> out);
+
+    struct DecoderStats {
+        std::uint64_t frames{0};
+        std::uint64_t crc_errors{0};
+        // Delimiter inside a COBS block, or a body too short to hold the CRC.
+        std::uint64_t framing_errors{0};
+        // Frames longer than the decoder's max_payload.
+        std::uint64_t overruns{0};
+        // Bytes thrown away while resynchronising after an error.
+        std::uint64_t bytes_discarded{0};
+    };
+
+    // Incremental decoder: feed it whatever chunks the UART driver returns. The frame buffer is
+    // sized once at construction, so decoding never allocates. Not thread-safe.
+    //
+    //   std::span<const char> in = chunk;
+    //   while (auto payload = decoder.next(in)) handle(*payload);
+    class FrameDecoder {
+      public:
+        explicit FrameDecoder(std::size_t max_payload = 1024);
+
+        // Consumes bytes from the front of `input` until a valid frame completes, and returns its
+        // payload (valid until the next call), or nullopt once `input` is exhausted. Corrupt frames
+        // are counted and skipped.
+        std::optional<std::span<const char>> next(std::span<const char> &input);
+
+        // Drops any partially received frame.
+        void reset();
+
+        const DecoderStats &stats() const {
+            return stats_;
+        }
+        std::size_t max_payload() const {
+            return buffer_.size() - kCrcBytes;
+        }
+
+      private:
+        std::optional<std::span<const char>> finish_frame();
+        void fail(std::uint64_t &counter);
+
+        std::vector<char> buffer_;
+        std::size_t length_{0};
+        // Data bytes left in the current COBS block; 0 means the next byte is a code byte.
+        std::size_t remaining_{0};
+        // The previous block ended short of 254 bytes, so a zero precedes the next block's data.
+        bool pending_zero_{false};
+        // Skipping to the next delimiter after an error.
+        bool discarding_{false};
+        DecoderStats stats_;
+    };
+
+} // namespace platform::serial
@@ -0,0 +1,200 @@
+// simt.hpp - CPU-side SIMT warp simulator for divergence and occupancy analysis of kernel designs.
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "platform/cpu_features.hpp"
+
+namespace platform::simt {
+
+    inline constexpr std::uint32_t kWarpSize = 32;
+    inline constexpr std::uint32_t kFullMask = 0xFFFFFFFFu;
+
+    // Lane totals over a set of 32-lane active masks.
+    struct MaskStats {
+        std::uint64_t masks{0};
+        std::uint64_t active_lanes{0};
+        // Masks with all 32 lanes active.
+        std::uint64_t full_masks{0};
+
+        // Mean fraction of lanes doing useful work per issued warp instruction (0 for no masks).
+        double simd_efficiency() const {
+            return masks == 0 ? 0.0 : static_cast<double>(active_lanes) / (static_cast<double>(masks) * kWarpSize);
+        }
+        double average_active_lanes() const {
+            return masks == 0 ? 0.0 : static_cast<double>(active_lanes) / static_cast<double>(masks);
+        }
+    };
+
+    // Popcounts every mask with the widest available instructions (AVX-512 VPOPCNTDQ, an AVX2
+    // nibble table, NEON vcnt, or the scalar popcnt instruction). `isa` forces a path for parity tests and
+    // benchmarks; unsupported requests fall back to the dispatched one.
+    MaskStats summarize_masks(std::span<const std::uint32_t> masks, std::optional<SimdIsa> isa = {});
+
+    // Result of simulate(). `masks` holds one entry per issued warp instruction in issue order.
+    struct SimtReport {
+        std::size_t threads{0};
+        std::size_t warps{0};
+        std::uint64_t branches{0};
+        // Branches where some active lanes took each side, so the warp ran both paths.
+        std::uint64_t divergent_branches{0};
+        MaskStats lanes{};
+        std::vector<std::uint32_t> masks;
+
+        double divergence_rate() const {
+            return branches == 0 ? 0.0 : static_cast<double>(divergent_branches) / static_cast<double>(branches);
+        }
+    };
+
+    // Handle a kernel functor uses to express per-lane work. Every step(), branch predicate and
+    // loop test issues one warp instruction and records the mask of lanes active for it. Lane
+    // callbacks receive the global thread index.
+    class Warp {
+      public:
+        Warp(std::size_t first_thread, std::uint32_t active, SimtReport &report)
+            : first_thread_(first_thread), active_(active), report_(&report) {}
+
+        std::size_t first_thread() const {
+            return first_thread_;
+        }
+        std::uint32_t active_mask() const {
+            return active_;
+        }
+
+        // One instruction: fn(thread) for every active lane.
+        template <class Fn> void step(Fn &&fn) {
+            issue();
+            for_each_active(active_, fn);
+        }
+
+        // if (pred(thread)) then_fn(warp) else else_fn(warp). Each side runs with only the lanes
+        // that took it and issues its own steps; a divergent branch issues both sides.
+        template <class Pred, class Then, class Else> void branch(Pred &&pred, Then &&then_fn, Else &&else_fn) {
+            const std::uint32_t taken = evaluate(pred);
+            const std::uint32_t entry = active_;
+            ++report_->branches;
+            if (taken != 0 && taken != entry) {
+                ++report_->divergent_branches;
+            }
+            run_masked(taken, then_fn);
+            run_masked(entry & ~taken, else_fn);
+            active_ = entry;
+        }
+
+        template <class Pred, class Then> void branch(Pred &&pred, Then &&then_fn) {
+            branch(pred, then_fn, [](Warp &) {});
+        }
+
+        // while (pred(thread)) body(warp). The warp keeps iterating until no lane's predicate holds;
+        // finished lanes idle, which is how data-dependent trip counts cost SIMD efficiency.
+        template <class Pred, class Body> void loop(Pred &&pred, Body &&body) {
+            const std::uint32_t entry = active_;
+            std::uint32_t live        = entry;
+            while (live != 0) {
+                active_                   = live;
+                const std::uint32_t still = evaluate(pred);
+                ++report_->branches;
+                if (still != 0 && still != live) {
+                    ++report_->divergent_branches;
+                }
+                live = still;
+                run_masked(live, body);
+            }
+            active_ = entry;
+        }
+
+      private:
+        void issue() {
+            report_->masks.push_back(active_);
+        }
+
+        template <class Fn> void for_each_active(std::uint32_t mask, Fn &&fn) const {
+            while (mask != 0) {
+                const auto lane = static_cast<std::uint32_t>(std::countr_zero(mask));
+                fn(first_thread_ + lane);
+                mask &= mask - 1;
+            }
+        }
+
+        template <class Pred> std::uint32_t evaluate(Pred &pred) {
+            issue();
+            std::uint32_t taken = 0;
+            for_each_active(active_, [&](std::size_t thread) {
+                if (pred(thread)) {
+                    taken |= std::uint32_t{1} << (thread - first_thread_);
+                }
+            });
+            return taken;
+        }
+
+        template <class Fn> void run_masked(std::uint32_t mask, Fn &fn) {
+            if (mask == 0) {
+                return;
+            }
+            active_ = mask;
+            fn(*this);
+        }
+
+        std::size_t first_thread_;
+        std::uint32_t active_;
+        SimtReport *report_;
+    };
+
+    // Runs kernel(warp) for each 32-thread warp covering [0, threads) in order; the last warp's
+    // missing lanes start inactive. Masks are summarised once at the end.
+    template <class Kernel> SimtReport simulate(std::size_t threads, Kernel &&kernel) {
+        SimtReport report;
+        report.threads = threads;
+        report.warps   = (threads + kWarpSize - 1) / kWarpSize;
+        for (std::size_t w = 0; w < report.warps; ++w) {
+            const std::size_t first  = w * kWarpSize;
+            const std::size_t lanes  = threads - first < kWarpSize ? threads - first : kWarpSize;
+            const std::uint32_t mask = lanes == kWarpSize ? kFullMask : (std::uint32_t{1} << lanes) - 1;
+            Warp warp(first, mask, report);
+            kernel(warp);
+        }
+        report.lanes = summarize_masks(report.masks);
+        return report;
+    }
+
+    // Per-SM resource limits; the defaults are those of compute capability 8.6 (Ampere GA10x).
+    struct SmLimits {
+        std::uint32_t max_threads{1536};
+        std::uint32_t max_warps{48};
+        std::uint32_t max_blocks{16};
+        std::uint32_t registers{65536};
+        // Registers are allocated per warp in units of this many.
+        std::uint32_t register_allocation_unit{256};
+        std::uint32_t shared_memory_bytes{102400};
+        std::uint32_t max_registers_per_thread{255};
+    };
+
+    struct LaunchResources {
+        std::uint32_t block_threads{256};
+        std::uint32_t registers_per_thread{32};
+        std::uint32_t shared_bytes_per_block{0};
+    };
+
+    enum class OccupancyLimiter { kWarps, kBlocks, kRegisters, kSharedMemory, kInvalid };
+
+    struct Occupancy {
+        std::uint32_t blocks_per_sm{0};
+        std::uint32_t warps_per_sm{0};
+        // Resident warps over the SM's warp slots.
+        double occupancy{0.0};
+        OccupancyLimiter limiter{OccupancyLimiter::kInvalid};
+    };
+
+    // Theoretical occupancy as computed by the CUDA occupancy calculator: the block count is the
+    // tightest of the warp, block, register and shared-memory limits, and `limiter` names it. A
+    // block that does not fit at all gets zero blocks; kInvalid means an empty or oversized block.
+    Occupancy estimate_occupancy(const LaunchResources &launch, const SmLimits &sm = {});
+
+    const char *to_string(OccupancyLimiter limiter);
+
+} // namespace platform::simt
@@ -1,33 +1,224 @@
-// thread_pool.hpp - Minimal RAII thread pool with bounded work queue.
+// thread_pool.hpp - RAII thread pool with bounded priority lanes and CPU placement.
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
-#include "platform/bounded_queue.hpp"
+#include "platform/wait_strategy.hpp"
 
 namespace platform {
 
+class MetricsRegistry;
+class Counter;
+class Gauge;
+class Histogram;
+
+// Job class. Each has its own FIFO lane; try_enqueue() also refuses lower classes while the queue
+// still has room for higher ones, so under overload low-priority work is shed first.
+enum class JobPriority { kLow, kNormal, kHigh };
+
+inline constexpr std::size_t kJobPriorities = 3;
+
+enum class LaneSelection {
+    // Always serve the highest non-empty lane.
+    kStrict,
+    // Serve non-empty lanes in rounds of `weights[priority]` jobs each, highest lane first.
+    kWeighted,
+};
+
+struct PoolPriorities {
+    LaneSelection selection{LaneSelection::kStrict};
+    // Jobs per round for kWeighted, indexed by JobPriority.
+    std::array<unsigned, kJobPriorities> weights{1, 2, 4};
+    // Anti-starvation: a kLow or kNormal job queued at least this long is served before any lane
+    // selection, oldest first. Zero disables aging.
+    std::chrono::microseconds aging{0};
+    // Workers that only run kHigh jobs, so high-priority work never waits for a long job from a
+    // lower lane to finish. Clamped to leave at least one general worker.
+    std::size_t reserved_workers{0};
+};
+
+enum class PinPolicy {
+    // Workers float over the allowed CPUs (see ThreadPlacement), unpinned if that is all of them.
+    kNone,
+    // One CPU per worker, taken in order from the allowed CPUs of its group.
+    kCore,
+    // Each worker may run on any allowed CPU of its group's NUMA node.
+    kNode,
+};
+
+// Where workers run. The allowed CPUs are CpuTopology::usable minus `exclude` and, with
+// `avoid_isolated`, the isolated ones; if that leaves nothing, all usable CPUs.
+struct ThreadPlacement {
+    PinPolicy pin{PinPolicy::kNone};
+    // Explicit CPU set per worker (worker i gets cpu_sets[i % size]); overrides `pin` when set.
+    std::vector<std::vector<int>> cpu_sets{};
+    // CPUs to leave to other threads, such as a Scheduler or the pipeline's sensor thread.
+    std::vector<int> exclude{};
+    bool avoid_isolated{true};
+    // One worker group per NUMA node (up to thread_count), each with its own queue and at least
+    // node-level pinning. Jobs go to the group of the submitting thread's node and are not stolen
+    // across groups; capacity and reserved_workers apply per group.
+    bool numa_groups{false};
+    // Names workers "<name>-<index>" (Linux keeps 15 characters); empty leaves them unnamed.
+    std::string name{};
+};
+
+// Elastic sizing, enabled when max_threads exceeds the constructor's thread_count. The pool then
+// starts thread_count workers (at least one) and a controller thread checks, every `interval`, how
+// long the oldest queued job has waited; while that exceeds `target_wait` it adds a worker, up to
+// max_threads. A worker that finds no job for `idle_timeout` retires, down to the initial count.
+struct PoolScaling {
+    std::size_t max_threads{0};
+    std::chrono::microseconds target_wait{1000};
+    std::chrono::milliseconds idle_timeout{1000};
+    std::chrono::milliseconds interval{10};
+};
+
 class ThreadPool {
 public:
-    explicit ThreadPool(std::size_t thread_count, std::size_t queue_capacity = 1024);
+    // `queue_capacity` bounds the jobs queued across all lanes (split evenly between NUMA groups).
+    // `wait` decides how idle workers wait for jobs; kSpin workers never park, so they never retire
+    // from an elastic pool either.
+    explicit ThreadPool(std::size_t thread_count, std::size_t queue_capacity = 1024, PoolPriorities priorities = {},
+                        ThreadPlacement placement = {}, PoolScaling scaling = {}, WaitStrategy wait = {});
     ~ThreadPool();
 
     ThreadPool(const ThreadPool&) = delete;
     ThreadPool& operator=(const ThreadPool&) = delete;
 
-    bool enqueue(std::function<void()> job);
+    // Blocks while the queue is full. Returns false once the pool is shutting down.
+    bool enqueue(std::function<void()> job, JobPriority priority = JobPriority::kNormal);
+    // Never blocks. Admits the job only while the queue is below its priority's watermark:
+    // half the capacity for kLow, three quarters for kNormal, all of it for kHigh. Returns false,
+    // counting `<prefix>_rejected_total`, when the job is refused or the pool is shutting down.
+    bool try_enqueue(std::function<void()> job, JobPriority priority = JobPriority::kNormal);
     void shutdown();
 
+    // Running workers; with PoolScaling this moves between the initial count and max_threads().
+    std::size_t thread_count() const { return live_.load(std::memory_order_relaxed); }
+    std::size_t max_threads() const { return slots_.size(); }
+    std::size_t queue_capacity() const { return capacity_; }
+    std::size_t queue_depth() const { return total_depth_.load(std::memory_order_relaxed); }
+    std::size_t group_count() const { return groups_.size(); }
+    // CPUs worker `index` (below max_threads()) is restricted to; empty when it is left unpinned.
+    const std::vector<int>& worker_cpus(std::size_t index) const { return slots_[index].cpus; }
+    // Workers whose pinning the OS accepted, once they have started.
+    std::size_t pinned_workers() const { return pinned_.load(std::memory_order_relaxed); }
+
+    // Publishes `<prefix>_jobs_total`, `<prefix>_rejected_total`, `<prefix>_idle_ns_total`,
+    // `<prefix>_busy_ns_total`, `<prefix>_aged_total`, `<prefix>_queue_depth`,
+    // `<prefix>_queue_push_wait_ns`, `<prefix>_queue_pop_wait_ns` and, per lane,
+    // `<prefix>_queue_wait_ns{priority="low|normal|high"}` (enqueue to start). Jobs/sec and
+    // utilisation are derived from successive snapshots. Elastic pools add the controller's view:
+    // `<prefix>_workers`, `<prefix>_utilization_pct` and `<prefix>_oldest_wait_ns` gauges, and
+    // `<prefix>_scale_up_total` / `<prefix>_scale_down_total`. Safe to call while workers run; only
+    // the first call takes effect.
+    void bind_metrics(MetricsRegistry& registry, std::string_view prefix);
+
 private:
-    void worker(std::stop_token st);
+    using Clock = std::chrono::steady_clock;
+
+    struct Job {
+        std::function<void()> fn;
+        Clock::time_point enqueued;
+    };
+
+    struct Metrics {
+        Counter* jobs{nullptr};
+        Counter* rejected{nullptr};
+        Counter* idle_ns{nullptr};
+        Counter* busy_ns{nullptr};
+        Counter* aged{nullptr};
+        Gauge* depth{nullptr};
+        Histogram* push_wait_ns{nullptr};
+        Histogram* pop_wait_ns{nullptr};
+        std::array<Histogram*, kJobPriorities> queue_wait_ns{};
+        Gauge* workers{nullptr};
+        Gauge* utilization_pct{nullptr};
+        Gauge* oldest_wait_ns{nullptr};
+        Counter* scale_ups{nullptr};
+        Counter* scale_downs{nullptr};
+    };
+
+    // A queue and the workers that serve it; one per NUMA node with numa_groups, else just one.
+    struct Group {
+        std::size_t capacity{0};
+        std::mutex mutex;
+        std::condition_variable_any not_full;
+        std::condition_variable_any work_ready;
+        std::condition_variable_any high_ready;
+        std::array<std::deque<Job>, kJobPriorities> lanes;
+        // kWeighted: jobs each lane may still take this round.
+        std::array<unsigned, kJobPriorities> credits{};
+        std::size_t depth{0};
+        // Mirrors of depth and of the kHigh lane's size that spinning workers poll without the lock.
+        std::atomic<std::size_t> queued{0};
+        std::atomic<std::size_t> queued_high{0};
+        bool closed{false};
+        // Running workers, the floor elastic retirement stops at, and the group's worker slots.
+        std::size_t live{0};
+        std::size_t min_live{0};
+        std::size_t slots{0};
+    };
 
+    struct WorkerSlot {
+        Group* group{nullptr};
+        bool reserved{false};
+        std::vector<int> cpus;
+        // Whether a worker runs in this slot; guarded by the group mutex.
+        bool active{false};
+    };
+
+    enum class Popped { kJob, kClosed, kRetired };
+
+    void place_workers(std::size_t slot_count, std::size_t initial, const ThreadPlacement& placement);
+    void start_worker(std::size_t index);
+    Group& submit_group();
+    bool push(Group& group, std::function<void()>& job, JobPriority priority, std::size_t limit, bool block);
+    Popped pop(WorkerSlot& slot, Job& out, std::stop_token st);
+    // Polls the slot's group per wait_ without its lock. Returns when polling started, if it did.
+    std::optional<Clock::time_point> spin(const WorkerSlot& slot, std::stop_token st);
+    // Picks the lane to serve next; requires the group lock and a non-empty queue.
+    std::size_t select_lane(Group& group, Clock::time_point now);
+    void worker(std::stop_token st, std::size_t index);
+    // Elastic controller loop.
+    void scale(std::stop_token st);
+
+    const std::size_t capacity_;
+    const PoolPriorities priorities_;
+    const PoolScaling scaling_;
+    const WaitStrategy wait_;
+    const bool elastic_;
+    const std::string name_;
+    std::vector<std::unique_ptr<Group>> groups_;
+    std::atomic<std::size_t> total_depth_{0};
+    std::vector<WorkerSlot> slots_;
+    std::atomic<std::size_t> pinned_{0};
+    std::atomic<std::size_t> live_{0};
+    // Elastic only: job run time, for the controller's utilisation figure.
+    std::atomic<std::uint64_t> busy_ns_{0};
+
+    // One per slot; a retired worker's thread has returned and is joined before the slot restarts.
     std::vector<std::jthread> workers_;
-    BoundedQueue<std::function<void()>> queue_;
+    std::jthread scaler_;
     std::atomic<bool> shutting_down_{false};
+    std::once_flag metrics_once_;
+    Metrics metrics_storage_;
+    std::atomic<const Metrics*> metrics_{nullptr};
 };
 
 }  // namespace platform
-
@@ -0,0 +1,94 @@
+// topic_synchronizer.hpp - approximate-time alignment of samples from several topics.
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace platform {
+
+    struct StampedValue {
+        std::int64_t timestamp_ns{0};
+        double value{0.0};
+    };
+
+    struct SyncOptions {
+        // Largest allowed distance between the newest sample and each partner it is matched with.
+        std::chrono::nanoseconds tolerance{std::chrono::milliseconds(5)};
+        // Samples kept per topic (rounded up to a power of two); the oldest is dropped when full.
+        std::size_t capacity{64};
+    };
+
+    struct SyncStats {
+        std::uint64_t matched{0};
+        // Samples evicted unmatched because their topic's buffer was full.
+        std::uint64_t overflowed{0};
+        // Samples older than the newest one already buffered for their topic.
+        std::uint64_t out_of_order{0};
+    };
+
+    // Buffers each topic in a fixed ring ordered by timestamp. Every push uses the new sample as
+    // the pivot: it binary-searches each other topic for the sample nearest in time and, when all
+    // of them fall within the tolerance, emits one sample per topic and discards everything up to
+    // the matched samples, so each sample is used at most once. All storage is allocated at
+    // construction; push() never allocates. Not thread-safe.
+    class TopicSynchronizer {
+      public:
+        // Receives one sample per topic, indexed like push(); valid only during the call.
+        using Callback = std::function<void(std::span<const StampedValue>)>;
+
+        TopicSynchronizer(std::size_t topics, SyncOptions options, Callback on_match);
+
+        // O(topics * log capacity). Returns true when this sample completed a tuple.
+        bool push(std::size_t topic, StampedValue sample);
+
+        std::size_t topic_count() const {
+            return rings_.size();
+        }
+        std::size_t buffered(std::size_t topic) const {
+            return rings_[topic].size();
+        }
+        const SyncStats &stats() const {
+            return stats_;
+        }
+
+      private:
+        class Ring {
+          public:
+            explicit Ring(std::size_t capacity) : slots_(capacity), mask_(capacity - 1) {}
+
+            std::size_t size() const {
+                return size_;
+            }
+            const StampedValue &operator[](std::size_t i) const {
+                return slots_[(head_ + i) & mask_];
+            }
+            const StampedValue &back() const {
+                return (*this)[size_ - 1];
+            }
+            // Returns false when the oldest sample had to be evicted.
+            bool push_back(StampedValue sample);
+            void pop_front(std::size_t count);
+            // Index of the sample closest to `timestamp_ns`; requires size() > 0.
+            std::size_t nearest(std::int64_t timestamp_ns) const;
+
+          private:
+            std::vector<StampedValue> slots_;
+            std::size_t mask_;
+            std::size_t head_{0};
+            std::size_t size_{0};
+        };
+
+        std::int64_t tolerance_ns_;
+        std::vector<Ring> rings_;
+        // Scratch for the tuple being matched and the index picked in each ring.
+        std::vector<StampedValue> tuple_;
+        std::vector<std::size_t> picks_;
+        Callback on_match_;
+        SyncStats stats_;
+    };
+
+} // namespace platform
@@ -0,0 +1,79 @@
+// triple_buffer.hpp - lock-free latest-value handoff between one writer and one reader.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace platform {
+
+    // Three slots: the writer owns one, the reader owns one, and the third ("middle") holds the
+    // newest complete value. Publishing and fetching each swap their own slot with the middle in
+    // a single atomic exchange, so neither side ever waits for the other, the reader always gets
+    // the most recent publish, and a slot is never written while the reader holds it (no torn
+    // reads). Values published faster than the reader fetches them are overwritten, not queued.
+    //
+    // Single writer, single reader. T must be copy- or move-assignable.
+    template <typename T> class TripleBuffer {
+      public:
+        explicit TripleBuffer(const T &initial = T{}) {
+            for (auto &slot : slots_) {
+                slot.value = initial;
+            }
+        }
+
+        TripleBuffer(const TripleBuffer &)            = delete;
+        TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+        // Writer side. Returns false when the previous value was overwritten before the reader
+        // fetched it.
+        bool write(const T &value) {
+            slots_[back_].value = value;
+            return publish();
+        }
+        bool write(T &&value) {
+            slots_[back_].value = std::move(value);
+            return publish();
+        }
+
+        // Reader side. Makes the newest published value current; returns false, keeping the
+        // current value, when nothing was published since the last fetch.
+        bool fetch() {
+            if ((middle_.load(std::memory_order_relaxed) & kFresh) == 0) {
+                return false;
+            }
+            front_ = static_cast<std::uint8_t>(middle_.exchange(front_, std::memory_order_acq_rel) & kIndexMask);
+            return true;
+        }
+        // The value made current by the last successful fetch(), or the initial value.
+        const T &current() const {
+            return slots_[front_].value;
+        }
+
+      private:
+        static constexpr std::uint8_t kIndexMask = 0x3;
+        static constexpr std::uint8_t kFresh     = 0x4;
+
+        bool publish() {
+            const std::uint8_t previous =
+                middle_.exchange(static_cast<std::uint8_t>(back_ | kFresh), std::memory_order_acq_rel);
+            back_ = static_cast<std::uint8_t>(previous & kIndexMask);
+            return (previous & kFresh) == 0;
+        }
+
+        // Each slot on its own cache line, so the writer filling one does not invalidate the line
+        // the reader is copying from.
+        struct alignas(64) Slot {
+            T value;
+        };
+
+        std::array<Slot, 3> slots_;
+        // Writer-owned and reader-owned slot indices; each is touched by one thread only.
+        alignas(64) std::uint8_t back_{0};
+        alignas(64) std::uint8_t front_{1};
+        // Index of the middle slot, plus kFresh while it holds a value the reader has not fetched.
+        alignas(64) std::atomic<std::uint8_t> middle_{2};
+    };
+
+} // namespace platform
@@ -0,0 +1,98 @@
+// wait_strategy.hpp - how a consumer waits for work: park, spin briefly then park, or spin.
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+
+namespace platform {
+
+    enum class WaitMode {
+        // Park on the condition variable at once: no CPU while idle, but every wake-up pays the
+        // futex sleep/wake round trip and the scheduler's latency to run the woken thread.
+        kBlock,
+        // Poll for up to `spin` first and park only if nothing arrived. Bursts are picked up without
+        // a wake-up; an idle consumer costs at most `spin` of CPU per wait.
+        kSpinThenPark,
+        // Never park: poll until work arrives, close or stop. Lowest latency and a full core per
+        // waiting consumer, so only for consumers with a CPU of their own.
+        kSpin,
+    };
+
+    struct WaitStrategy {
+        WaitMode mode{WaitMode::kBlock};
+        // kSpinThenPark: how long to poll before parking.
+        std::chrono::microseconds spin{50};
+    };
+
+    // Hints the CPU that the caller is in a spin loop (x86 `pause`, Arm `yield`), which saves power
+    // and frees the core's shared resources for a sibling hyperthread.
+    inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    // Polls `ready` without blocking until it returns true (result true), or until the spin budget
+    // of `strategy` runs out or `st` is stopped (result false). kBlock returns false at once and kSpin
+    // has no budget. Every 64 polls the thread also yields to the OS scheduler, so a spinning
+    // consumer cannot starve the producer it waits for when they share a CPU.
+    template <class Ready> bool spin_until(const WaitStrategy &strategy, std::stop_token st, Ready &&ready) {
+        if (strategy.mode == WaitMode::kBlock) {
+            return false;
+        }
+        using Clock = std::chrono::steady_clock;
+        const auto deadline =
+            strategy.mode == WaitMode::kSpin ? Clock::time_point::max() : Clock::now() + strategy.spin;
+        for (std::uint32_t polls = 1;; ++polls) {
+            if (ready()) {
+                return true;
+            }
+            if (st.stop_requested()) {
+                return false;
+            }
+            if (polls % 64 == 0) {
+                if (Clock::now() >= deadline) {
+                    return false;
+                }
+                std::this_thread::yield();
+            } else {
+                cpu_relax();
+            }
+        }
+    }
+
+    // Parses "block", "spin_park" or "spin".
+    inline std::optional<WaitMode> parse_wait_mode(std::string_view text) {
+        if (text == "block") {
+            return WaitMode::kBlock;
+        }
+        if (text == "spin_park") {
+            return WaitMode::kSpinThenPark;
+        }
+        if (text == "spin") {
+            return WaitMode::kSpin;
+        }
+        return std::nullopt;
+    }
+
+    inline const char *to_string(WaitMode mode) {
+        switch (mode) {
+            case WaitMode::kBlock:
+                return "block";
+            case WaitMode::kSpinThenPark:
+                return "spin_park";
+            case WaitMode::kSpin:
+                return "spin";
+        }
+        return "block";
+    }
+
+} // namespace platform
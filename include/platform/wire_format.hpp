@@ -0,0 +1,186 @@
+// wire_format.hpp - versioned fixed-layout binary payloads for sensor.raw and control.cmd.
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace platform::wire {
+
+    // Every record starts with this header. The first magic byte is outside ASCII, so a reader can
+    // tell a binary payload from the text ones ("imu:1.0", "0.5") by its first byte.
+    inline constexpr std::array<std::uint8_t, 2> kMagic{0xB7, 0x57};
+    inline constexpr std::uint8_t kVersion = 1;
+
+    enum class RecordType : std::uint8_t { kSensorSample = 1, kControlCommand = 2 };
+
+    // All multi-byte fields are little-endian and naturally aligned, so on little-endian hosts the
+    // structs below are the wire bytes; records are read in place through the *View classes.
+    // Newer versions may only append fields: `size` covers the whole record, and readers accept any
+    // version whose size includes the fields they know.
+    struct Header {
+        std::uint8_t magic[2];
+        std::uint8_t version;
+        RecordType type;
+        std::uint32_t size;
+    };
+
+    inline constexpr std::size_t kMaxNameLength = 15;
+
+    struct SensorSampleRecord {
+        Header header;
+        std::uint32_t sequence;
+        std::uint32_t reserved;
+        // steady_clock nanoseconds of the producing host.
+        std::int64_t timestamp_ns;
+        double value;
+        // NUL-padded sensor name.
+        char name[kMaxNameLength + 1];
+    };
+
+    struct ControlCommandRecord {
+        Header header;
+        std::uint32_t sequence;
+        std::uint32_t reserved;
+        // Timestamp of the originating sensor sample.
+        std::int64_t timestamp_ns;
+        double effort;
+    };
+
+    // The layout is the contract in docs/topic_contract.md; any change here is a new version.
+    static_assert(sizeof(Header) == 8 && offsetof(Header, size) == 4);
+    static_assert(sizeof(SensorSampleRecord) == 48 && offsetof(SensorSampleRecord, timestamp_ns) == 16 &&
+                  offsetof(SensorSampleRecord, value) == 24 && offsetof(SensorSampleRecord, name) == 32);
+    static_assert(sizeof(ControlCommandRecord) == 32 && offsetof(ControlCommandRecord, timestamp_ns) == 16 &&
+                  offsetof(ControlCommandRecord, effort) == 24);
+    static_assert(std::is_trivially_copyable_v<SensorSampleRecord> &&
+                  std::is_trivially_copyable_v<ControlCommandRecord>);
+    static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+                  "mixed-endian hosts are not supported");
+
+    namespace detail {
+        template <class T> T byteswap(T value) {
+            auto bytes = std::bit_cast<std::array<std::uint8_t, sizeof(T)>>(value);
+            for (std::size_t i = 0; i < sizeof(T) / 2; ++i) {
+                std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+            }
+            return std::bit_cast<T>(bytes);
+        }
+
+        // One unaligned load (a plain mov on little-endian targets); payload strings carry no
+        // alignment guarantee.
+        template <class T> T load_le(const char *p) {
+            T value;
+            std::memcpy(&value, p, sizeof(T));
+            if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+                value = byteswap(value);
+            }
+            return value;
+        }
+
+        template <class T> void store_le(char *p, T value) {
+            if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+                value = byteswap(value);
+            }
+            std::memcpy(p, &value, sizeof(T));
+        }
+
+        // Validates magic, type, version and size; returns the record size on success.
+        std::optional<std::size_t> check_header(std::string_view bytes, RecordType type, std::size_t v1_size);
+    } // namespace detail
+
+// Generates a const accessor for one scalar field of `record`, read in place at its offset.
+#define PLATFORM_WIRE_FIELD(record, field)                                                                             \
+    std::remove_cvref_t<decltype(record::field)> field() const {                                                       \
+        return detail::load_le<std::remove_cvref_t<decltype(record::field)>>(data_ + offsetof(record, field));         \
+    }
+
+    // True when `payload` starts with the binary magic (as opposed to a text payload).
+    inline bool is_binary(std::string_view payload) {
+        return payload.size() >= 2 && static_cast<std::uint8_t>(payload[0]) == kMagic[0] &&
+               static_cast<std::uint8_t>(payload[1]) == kMagic[1];
+    }
+
+    // Zero-copy reader over a sensor.raw payload; valid while the underlying bytes are.
+    class SensorSampleView {
+      public:
+        static std::optional<SensorSampleView> from(std::string_view bytes);
+
+        PLATFORM_WIRE_FIELD(SensorSampleRecord, sequence)
+        PLATFORM_WIRE_FIELD(SensorSampleRecord, timestamp_ns)
+        PLATFORM_WIRE_FIELD(SensorSampleRecord, value)
+
+        std::uint8_t version() const {
+            return static_cast<std::uint8_t>(data_[offsetof(Header, version)]);
+        }
+        std::string_view name() const;
+
+      private:
+        explicit SensorSampleView(const char *data) : data_(data) {}
+        const char *data_;
+    };
+
+    class ControlCommandView {
+      public:
+        static std::optional<ControlCommandView> from(std::string_view bytes);
+
+        PLATFORM_WIRE_FIELD(ControlCommandRecord, sequence)
+        PLATFORM_WIRE_FIELD(ControlCommandRecord, timestamp_ns)
+        PLATFORM_WIRE_FIELD(ControlCommandRecord, effort)
+
+        std::uint8_t version() const {
+            return static_cast<std::uint8_t>(data_[offsetof(Header, version)]);
+        }
+
+      private:
+        explicit ControlCommandView(const char *data) : data_(data) {}
+        const char *data_;
+    };
+
+#undef PLATFORM_WIRE_FIELD
+
+    // Writers fill exactly sizeof(record) bytes of `out` and return the count, or 0 when `out` is
+    // too small or the name is longer than kMaxNameLength. They never allocate, so they can target
+    // a bus payload, a shared-memory slot or a UART frame buffer alike.
+    std::size_t encode_sensor_sample(std::span<char> out, std::string_view name, double value,
+                                     std::int64_t timestamp_ns, std::uint32_t sequence = 0);
+    std::size_t encode_control_command(std::span<char> out, double effort, std::int64_t timestamp_ns,
+                                       std::uint32_t sequence = 0);
+
+    // Convenience wrappers returning a bus payload; empty on failure.
+    std::string sensor_sample_payload(std::string_view name, double value, std::int64_t timestamp_ns,
+                                      std::uint32_t sequence = 0);
+    std::string control_command_payload(double effort, std::int64_t timestamp_ns, std::uint32_t sequence = 0);
+
+    // Text payloads: `"<name>:<value>"` for sensor.raw and `"<value>"` for control.cmd. Numbers use
+    // std::to_chars/std::from_chars: locale-independent, allocation-free, and formatted as the
+    // shortest string that parses back to the same double.
+
+    // Longest shortest-round-trip double ("-2.2250738585072014e-308") plus slack, and a buffer that
+    // fits any sensor text payload whose name is at most kMaxNameLength.
+    inline constexpr std::size_t kMaxNumberChars     = 32;
+    inline constexpr std::size_t kMaxSensorTextChars = kMaxNameLength + 1 + kMaxNumberChars;
+
+    struct SensorText {
+        std::string_view name;
+        double value{0.0};
+    };
+
+    // Whole-string parse; trailing characters, whitespace and a leading '+' are rejected.
+    std::optional<double> parse_number(std::string_view text);
+    std::optional<SensorText> parse_sensor_text(std::string_view payload);
+
+    // Write into `out` and return the character count, or 0 when `out` is too small (or the name
+    // contains ':').
+    std::size_t format_number(std::span<char> out, double value);
+    std::size_t format_sensor_text(std::span<char> out, std::string_view name, double value);
+
+} // namespace platform::wire
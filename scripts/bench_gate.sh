@@ -0,0 +1,39 @@
+#!/usr/bin/env bash
+# Benchmark regression gate.
+#   ./scripts/bench_gate.sh --record   # store a baseline for this host from the current build
+#   ./scripts/bench_gate.sh            # compare the current build against the stored baseline
+# Env: BUILD_DIR, BENCH_FILTER, BENCH_REPETITIONS, BENCH_THRESHOLD, BENCH_ALPHA, BASELINE_DIR
+set -euo pipefail
+
+BUILD_DIR=${BUILD_DIR:-build/release}
+BENCH_FILTER=${BENCH_FILTER:-'BM_BoundedQueue_PushPop|BM_LatencyHistogram_Record/'}
+BENCH_REPETITIONS=${BENCH_REPETITIONS:-10}
+BENCH_THRESHOLD=${BENCH_THRESHOLD:-0.05}
+BENCH_ALPHA=${BENCH_ALPHA:-0.05}
+BASELINE_DIR=${BASELINE_DIR:-benchmarks/baselines}
+BASELINE="${BASELINE_DIR}/$(hostname)-$(uname -m).json"
+
+cmake --build "${BUILD_DIR}" --target platform_core_bench platform_bench_compare
+
+candidate=$(mktemp --suffix=.json)
+trap 'rm -f "${candidate}"' EXIT
+"${BUILD_DIR}/platform_core_bench" \
+  --benchmark_filter="${BENCH_FILTER}" \
+  --benchmark_repetitions="${BENCH_REPETITIONS}" \
+  --benchmark_out="${candidate}" \
+  --benchmark_out_format=json >/dev/null
+
+if [[ "${1:-}" == "--record" ]]; then
+  mkdir -p "${BASELINE_DIR}"
+  cp "${candidate}" "${BASELINE}"
+  echo "Recorded baseline ${BASELINE}"
+  exit 0
+fi
+
+if [[ ! -f "${BASELINE}" ]]; then
+  echo "No baseline at ${BASELINE}; run '$0 --record' on a known-good build first." >&2
+  exit 2
+fi
+
+"${BUILD_DIR}/platform_bench_compare" --threshold "${BENCH_THRESHOLD}" --alpha "${BENCH_ALPHA}" \
+  "${BASELINE}" "${candidate}"
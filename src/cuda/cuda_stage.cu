@@ -3,7 +3,9 @@
 #include <cuda_runtime.h>
 
 #include <iostream>
+#include <memory>
 
+#include "platform/device_stream.hpp"
 #include "platform/logging.hpp"
 
 namespace platform {
@@ -23,8 +25,77 @@ bool check_cuda(const char* where, cudaError_t err) {
     }
     return true;
 }
+
+void* cuda_device_allocate(std::size_t bytes) {
+    void* ptr = nullptr;
+    return check_cuda("cudaMalloc", cudaMalloc(&ptr, bytes)) ? ptr : nullptr;
+}
+
+void cuda_device_deallocate(void* ptr, std::size_t) { cudaFree(ptr); }
+
+void* cuda_pinned_allocate(std::size_t bytes) {
+    void* ptr = nullptr;
+    return check_cuda("cudaMallocHost", cudaMallocHost(&ptr, bytes)) ? ptr : nullptr;
+}
+
+void cuda_pinned_deallocate(void* ptr, std::size_t) { cudaFreeHost(ptr); }
+
+// Errors are sticky: once an operation fails every later synchronize() reports it, matching the
+// CPU stream.
+class CudaStream final : public Stream {
+public:
+    explicit CudaStream(cudaStream_t stream) : stream_(stream) {}
+    ~CudaStream() override {
+        cudaStreamSynchronize(stream_);
+        cudaStreamDestroy(stream_);
+    }
+
+    void copy_to_device(void* device_dst, const void* host_src, std::size_t bytes) override {
+        record("cudaMemcpyAsync H2D",
+               cudaMemcpyAsync(device_dst, host_src, bytes, cudaMemcpyHostToDevice, stream_));
+    }
+
+    void copy_to_host(void* host_dst, const void* device_src, std::size_t bytes) override {
+        record("cudaMemcpyAsync D2H",
+               cudaMemcpyAsync(host_dst, device_src, bytes, cudaMemcpyDeviceToHost, stream_));
+    }
+
+    void vector_add(const float* a, const float* b, float* out, std::size_t n) override {
+        if (n == 0) return;
+        const int threads = 256;
+        const int blocks = static_cast<int>((n + threads - 1) / threads);
+        vec_add_kernel<<<blocks, threads, 0, stream_>>>(a, b, out, static_cast<int>(n));
+        record("kernel", cudaGetLastError());
+    }
+
+    bool synchronize() override {
+        record("cudaStreamSynchronize", cudaStreamSynchronize(stream_));
+        return !failed_;
+    }
+
+    StreamBackend backend() const override { return StreamBackend::kCuda; }
+
+private:
+    void record(const char* where, cudaError_t err) {
+        if (!check_cuda(where, err)) failed_ = true;
+    }
+
+    cudaStream_t stream_;
+    bool failed_{false};
+};
 }  // namespace
 
+std::unique_ptr<Stream> make_cuda_stream() {
+    if (!check_cuda_available()) return nullptr;
+    cudaStream_t stream = nullptr;
+    if (!check_cuda("cudaStreamCreate", cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking))) return nullptr;
+    return std::make_unique<CudaStream>(stream);
+}
+
+MemoryUpstream cuda_device_upstream() { return {cuda_device_allocate, cuda_device_deallocate, "cuda_device"}; }
+
+MemoryUpstream cuda_pinned_upstream() { return {cuda_pinned_allocate, cuda_pinned_deallocate, "cuda_pinned"}; }
+
 CudaBuffer::CudaBuffer(CudaBuffer&& other) noexcept {
     device_ptr_ = other.device_ptr_;
     bytes_ = other.bytes_;
@@ -88,24 +159,10 @@ bool vector_add_cuda(const std::vector<float>& a, const std::vector<float>& b, s
 
     const std::size_t n = std::min(a.size(), b.size());
     out.resize(n);
-    CudaBuffer d_a, d_b, d_out;
-    if (!d_a.allocate(n * sizeof(float)) || !d_b.allocate(n * sizeof(float)) || !d_out.allocate(n * sizeof(float))) {
-        return false;
-    }
-
-    if (!check_cuda("copy a", cudaMemcpy(d_a.data(), a.data(), n * sizeof(float), cudaMemcpyHostToDevice))) return false;
-    if (!check_cuda("copy b", cudaMemcpy(d_b.data(), b.data(), n * sizeof(float), cudaMemcpyHostToDevice))) return false;
-
-    const int threads = 256;
-    const int blocks = static_cast<int>((n + threads - 1) / threads);
-    vec_add_kernel<<<blocks, threads>>>(static_cast<float*>(d_a.data()), static_cast<float*>(d_b.data()),
-                                        static_cast<float*>(d_out.data()), static_cast<int>(n));
-    if (!check_cuda("kernel", cudaGetLastError())) return false;
-    if (!check_cuda("sync", cudaDeviceSynchronize())) return false;
-
-    if (!check_cuda("copy out", cudaMemcpy(out.data(), d_out.data(), n * sizeof(float), cudaMemcpyDeviceToHost)))
-        return false;
-    return true;
+    // Buffers come from the runner's caching pools, so repeated calls reuse device and pinned
+    // memory instead of paying cudaMalloc and pageable copies every time.
+    static StreamedVectorAdd runner(StreamBackend::kCuda);
+    return runner.run(a.data(), b.data(), out.data(), n);
 #endif
 }
 
@@ -1,9 +1,15 @@
 #include "platform/logging.hpp"
 #include "platform/pipeline.hpp"
+#include "platform/scheduler.hpp"
+#include "platform/serial_bridge.hpp"
 
 #include <atomic>
 #include <csignal>
+#include <cstdlib>
 #include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <thread>
 
 namespace {
@@ -19,14 +25,62 @@ int main() {
     std::signal(SIGTERM, handle_signal);
 
     platform::set_log_level(platform::LogLevel::kInfo);
-    platform::Pipeline pipeline;
-    pipeline.start();
+    platform::PipelineOptions options;
+    if (const char *config = std::getenv("PLATFORM_PIPELINE_CONFIG"); config != nullptr && *config != '\0') {
+        std::string error;
+        auto loaded = platform::load_pipeline_config(config, error);
+        if (!loaded) {
+            LOG_ERROR(error);
+            return 1;
+        }
+        options = std::move(*loaded);
+    }
+    if (const char *format = std::getenv("PLATFORM_WIRE_FORMAT");
+        format != nullptr && std::string_view(format) == "binary") {
+        options.payload_format = platform::PayloadFormat::kBinary;
+    }
+    platform::Pipeline pipeline(options);
+    if (const char *perf = std::getenv("PLATFORM_PERF_COUNTERS"); perf != nullptr && *perf == '1') {
+        pipeline.enable_perf_sampling();
+    }
+    if (!pipeline.start()) {
+        return 1;
+    }
+
+    // Optional periodic metrics dump in Prometheus text format.
+    platform::Scheduler metrics_dump;
+    if (const char *path = std::getenv("PLATFORM_METRICS_FILE"); path != nullptr && *path != '\0') {
+        metrics_dump.start(std::chrono::milliseconds(1000), [&pipeline, file = std::string(path)]() {
+            if (!pipeline.metrics().write_text_file(file)) {
+                LOG_WARN("Failed to write metrics to " + file);
+            }
+        });
+        LOG_INFO(std::string("Writing metrics to ") + path);
+    }
+
+    // Optional MCU link: COBS frames from the port go to sensor.raw, control.cmd goes back out.
+    std::optional<platform::SerialBridge> serial_bridge;
+    if (const char *port_path = std::getenv("PLATFORM_SERIAL_PORT"); port_path != nullptr && *port_path != '\0') {
+        if (auto port = platform::SerialPort::open(port_path)) {
+            serial_bridge.emplace(pipeline.bus(), std::move(*port));
+            serial_bridge->bind_metrics(pipeline.metrics(), "serial");
+        }
+        if (serial_bridge && serial_bridge->start()) {
+            LOG_INFO(std::string("Bridging serial port ") + port_path);
+        } else {
+            LOG_WARN(std::string("Failed to open serial port ") + port_path);
+        }
+    }
 
     LOG_INFO("Platform core running. Press Ctrl+C to exit.");
     while (running.load()) {
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 
+    metrics_dump.stop();
+    if (serial_bridge) {
+        serial_bridge->stop();
+    }
     pipeline.stop();
     LOG_INFO("Shutdown complete.");
     return 0;
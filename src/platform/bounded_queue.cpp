@@ -0,0 +1,24 @@
+#include "platform/bounded_queue.hpp"
+
+#include <string>
+
+#include "platform/metrics.hpp"
+
+namespace platform::detail {
+
+    QueueMetrics bind_queue_metrics(MetricsRegistry &registry, std::string_view prefix) {
+        const std::string base(prefix);
+        return {.depth        = &registry.gauge(base + "_depth"),
+                .push_wait_ns = &registry.histogram(base + "_push_wait_ns"),
+                .pop_wait_ns  = &registry.histogram(base + "_pop_wait_ns")};
+    }
+
+    void set_depth(Gauge &depth, std::size_t size) {
+        depth.set(static_cast<std::int64_t>(size));
+    }
+
+    void record_wait(Histogram &hist, std::chrono::steady_clock::duration waited) {
+        hist.record(waited);
+    }
+
+} // namespace platform::detail
@@ -0,0 +1,94 @@
+#include "platform/cpu_features.hpp"
+
+#include <cstdlib>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace platform {
+
+    bool simd_isa_supported(SimdIsa isa) {
+        switch (isa) {
+            case SimdIsa::kScalar:
+                return true;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            case SimdIsa::kSse2:
+                return __builtin_cpu_supports("sse2");
+            case SimdIsa::kAvx2:
+                // The AVX2 kernels also use FMA, which every AVX2 CPU we target provides.
+                return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            case SimdIsa::kAvx512:
+                return __builtin_cpu_supports("avx512f");
+#endif
+#if defined(__aarch64__)
+            // Advanced SIMD is mandatory on AArch64.
+            case SimdIsa::kNeon:
+                return true;
+#endif
+            default:
+                return false;
+        }
+    }
+
+    SimdIsa detect_simd_isa() {
+        for (SimdIsa isa : {SimdIsa::kAvx512, SimdIsa::kAvx2, SimdIsa::kSse2, SimdIsa::kNeon}) {
+            if (simd_isa_supported(isa)) {
+                return isa;
+            }
+        }
+        return SimdIsa::kScalar;
+    }
+
+    SimdIsa active_simd_isa() {
+        static const SimdIsa isa = [] {
+            if (const char *env = std::getenv("PLATFORM_SIMD")) {
+                if (auto requested = parse_simd_isa(env); requested && simd_isa_supported(*requested)) {
+                    return *requested;
+                }
+            }
+            return detect_simd_isa();
+        }();
+        return isa;
+    }
+
+    std::size_t l2_cache_bytes() {
+        static const std::size_t bytes = [] {
+            constexpr std::size_t kFallback = std::size_t{1} << 20;
+#if defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+            const long reported = sysconf(_SC_LEVEL2_CACHE_SIZE);
+            if (reported > 0) {
+                return static_cast<std::size_t>(reported);
+            }
+#endif
+            return kFallback;
+        }();
+        return bytes;
+    }
+
+    const char *to_string(SimdIsa isa) {
+        switch (isa) {
+            case SimdIsa::kScalar:
+                return "scalar";
+            case SimdIsa::kSse2:
+                return "sse2";
+            case SimdIsa::kAvx2:
+                return "avx2";
+            case SimdIsa::kAvx512:
+                return "avx512";
+            case SimdIsa::kNeon:
+                return "neon";
+        }
+        return "unknown";
+    }
+
+    std::optional<SimdIsa> parse_simd_isa(std::string_view name) {
+        for (SimdIsa isa : {SimdIsa::kScalar, SimdIsa::kSse2, SimdIsa::kAvx2, SimdIsa::kAvx512, SimdIsa::kNeon}) {
+            if (name == to_string(isa)) {
+                return isa;
+            }
+        }
+        return std::nullopt;
+    }
+
+} // namespace platform
@@ -0,0 +1,744 @@
+#include "platform/cpu_kernels.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Kernels are written once against a vector type V and stamped out per ISA. With GCC/Clang
+// vector extensions the arithmetic lowers to whatever the enclosing function's target allows, so
+// a kernel instantiated inside a target("avx2,fma") wrapper uses 256-bit registers and FMA while
+// the rest of the library stays at the baseline ISA. V = float is the portable fallback.
+#if defined(__GNUC__)
+#define PLATFORM_VECTOR_EXT 1
+#define PLATFORM_KERNEL_INLINE __attribute__((always_inline)) inline
+// Helpers that take or return wide vectors are always inlined into a wrapper of the matching
+// target, so no call ever crosses the ABI the warning is about.
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+#else
+#define PLATFORM_KERNEL_INLINE inline
+#endif
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_shufflevector)
+#define PLATFORM_HAS_SHUFFLEVECTOR 1
+#endif
+#endif
+
+namespace platform {
+
+    namespace {
+#ifdef PLATFORM_VECTOR_EXT
+        typedef float F32x4 __attribute__((vector_size(16)));
+        typedef float F32x8 __attribute__((vector_size(32)));
+        typedef float F32x16 __attribute__((vector_size(64)));
+#endif
+
+        template <class V> constexpr std::size_t kLanes = sizeof(V) / sizeof(float);
+
+        template <class V> PLATFORM_KERNEL_INLINE V load(const float *p) {
+            V v;
+            std::memcpy(&v, p, sizeof(V));
+            return v;
+        }
+        template <class V> PLATFORM_KERNEL_INLINE void store(float *p, const V &v) {
+            std::memcpy(p, &v, sizeof(V));
+        }
+        template <class V> PLATFORM_KERNEL_INLINE V splat(float s) {
+            return V{} + s;
+        }
+        template <class V> PLATFORM_KERNEL_INLINE V vmax(const V &a, const V &b) {
+            return a > b ? a : b;
+        }
+        template <class V> PLATFORM_KERNEL_INLINE float lane_sum(const V &v) {
+            if constexpr (kLanes<V> == 1) {
+                return v;
+            } else {
+                float s = 0.0f;
+                for (std::size_t i = 0; i < kLanes<V>; ++i) {
+                    s += v[i];
+                }
+                return s;
+            }
+        }
+        template <class V> PLATFORM_KERNEL_INLINE float lane_max(const V &v) {
+            if constexpr (kLanes<V> == 1) {
+                return v;
+            } else {
+                float m = v[0];
+                for (std::size_t i = 1; i < kLanes<V>; ++i) {
+                    m = v[i] > m ? v[i] : m;
+                }
+                return m;
+            }
+        }
+
+        struct Conv2dArgs {
+            const float *in;
+            std::size_t width;
+            const float *kernel;
+            std::size_t kernel_width;
+            std::size_t kernel_height;
+            float *out;
+            std::size_t out_width;
+        };
+
+        struct StencilArgs {
+            const float *in;
+            std::size_t width;
+            std::size_t height;
+            Stencil5 weights;
+            float *out;
+        };
+
+        // Four independent accumulators hide the add latency.
+        template <class V> PLATFORM_KERNEL_INLINE float sum_impl(const float *x, std::size_t n) {
+            constexpr std::size_t W = kLanes<V>;
+            V acc0{}, acc1{}, acc2{}, acc3{};
+            std::size_t i = 0;
+            for (; i + 4 * W <= n; i += 4 * W) {
+                acc0 += load<V>(x + i);
+                acc1 += load<V>(x + i + W);
+                acc2 += load<V>(x + i + 2 * W);
+                acc3 += load<V>(x + i + 3 * W);
+            }
+            for (; i + W <= n; i += W) {
+                acc0 += load<V>(x + i);
+            }
+            float s = lane_sum<V>((acc0 + acc1) + (acc2 + acc3));
+            for (; i < n; ++i) {
+                s += x[i];
+            }
+            return s;
+        }
+
+        template <class V> PLATFORM_KERNEL_INLINE float max_impl(const float *x, std::size_t n) {
+            constexpr std::size_t W = kLanes<V>;
+            constexpr float kLowest = -std::numeric_limits<float>::infinity();
+            V acc0 = splat<V>(kLowest), acc1 = acc0;
+            std::size_t i = 0;
+            for (; i + 2 * W <= n; i += 2 * W) {
+                acc0 = vmax<V>(acc0, load<V>(x + i));
+                acc1 = vmax<V>(acc1, load<V>(x + i + W));
+            }
+            for (; i + W <= n; i += W) {
+                acc0 = vmax<V>(acc0, load<V>(x + i));
+            }
+            float m = lane_max<V>(vmax<V>(acc0, acc1));
+            for (; i < n; ++i) {
+                m = x[i] > m ? x[i] : m;
+            }
+            return m;
+        }
+
+        template <class V> PLATFORM_KERNEL_INLINE float dot_impl(const float *a, const float *b, std::size_t n) {
+            constexpr std::size_t W = kLanes<V>;
+            V acc0{}, acc1{}, acc2{}, acc3{};
+            std::size_t i = 0;
+            for (; i + 4 * W <= n; i += 4 * W) {
+                acc0 += load<V>(a + i) * load<V>(b + i);
+                acc1 += load<V>(a + i + W) * load<V>(b + i + W);
+                acc2 += load<V>(a + i + 2 * W) * load<V>(b + i + 2 * W);
+                acc3 += load<V>(a + i + 3 * W) * load<V>(b + i + 3 * W);
+            }
+            for (; i + W <= n; i += W) {
+                acc0 += load<V>(a + i) * load<V>(b + i);
+            }
+            float s = lane_sum<V>((acc0 + acc1) + (acc2 + acc3));
+            for (; i < n; ++i) {
+                s += a[i] * b[i];
+            }
+            return s;
+        }
+
+#ifdef PLATFORM_HAS_SHUFFLEVECTOR
+        // Lane i of the result is lane i - K of x, or zero for i < K.
+        template <class V, std::size_t K, std::size_t... I>
+        PLATFORM_KERNEL_INLINE V shift_lanes_up(const V &x, std::index_sequence<I...>) {
+            return __builtin_shufflevector(x, V{}, (I >= K ? I - K : kLanes<V> + I)...);
+        }
+        template <class V, std::size_t... I>
+        PLATFORM_KERNEL_INLINE V broadcast_last(const V &x, std::index_sequence<I...>) {
+            return __builtin_shufflevector(x, x, (I * 0 + kLanes<V> - 1)...);
+        }
+        // Log-step (Hillis-Steele) prefix sum across the lanes of one register.
+        template <class V, std::size_t K = 1> PLATFORM_KERNEL_INLINE V prefix_lanes(V x) {
+            if constexpr (K < kLanes<V>) {
+                x += shift_lanes_up<V, K>(x, std::make_index_sequence<kLanes<V>>{});
+                return prefix_lanes<V, 2 * K>(x);
+            } else {
+                return x;
+            }
+        }
+#endif
+
+        // Each block's local prefix is independent of the running total, so only one add per
+        // block sits on the loop-carried dependency chain. Returns carry + sum of the range.
+        template <class V>
+        PLATFORM_KERNEL_INLINE float scan_impl(const float *in, float *out, std::size_t n, float carry) {
+            constexpr std::size_t W = kLanes<V>;
+            std::size_t i           = 0;
+#ifdef PLATFORM_HAS_SHUFFLEVECTOR
+            if constexpr (W > 1) {
+                V running = splat<V>(carry);
+                for (; i + W <= n; i += W) {
+                    const V local = prefix_lanes<V>(load<V>(in + i));
+                    store<V>(out + i, local + running);
+                    running += broadcast_last<V>(local, std::make_index_sequence<W>{});
+                }
+                carry = running[0];
+            }
+#endif
+            constexpr std::size_t kBlock = 8;
+            for (; i + kBlock <= n; i += kBlock) {
+                float local[kBlock];
+                local[0] = in[i];
+                for (std::size_t j = 1; j < kBlock; ++j) {
+                    local[j] = local[j - 1] + in[i + j];
+                }
+                for (std::size_t j = 0; j < kBlock; ++j) {
+                    out[i + j] = local[j] + carry;
+                }
+                carry += local[kBlock - 1];
+            }
+            for (; i < n; ++i) {
+                carry += in[i];
+                out[i] = carry;
+            }
+            return carry;
+        }
+
+        template <class V>
+        PLATFORM_KERNEL_INLINE void saxpy_impl(float alpha, const float *x, float *y, std::size_t n) {
+            constexpr std::size_t W = kLanes<V>;
+            const V a = splat<V>(alpha);
+            std::size_t i = 0;
+            for (; i + W <= n; i += W) {
+                store<V>(y + i, a * load<V>(x + i) + load<V>(y + i));
+            }
+            for (; i < n; ++i) {
+                y[i] = alpha * x[i] + y[i];
+            }
+        }
+
+        // Two output vectors per iteration keep two independent FMA chains over the taps.
+        template <class V>
+        PLATFORM_KERNEL_INLINE void conv1d_impl(const float *in, const float *taps, std::size_t k, float *out,
+                                                std::size_t begin, std::size_t end) {
+            constexpr std::size_t W = kLanes<V>;
+            std::size_t i = begin;
+            for (; i + 2 * W <= end; i += 2 * W) {
+                V acc0{}, acc1{};
+                for (std::size_t t = 0; t < k; ++t) {
+                    const V w = splat<V>(taps[t]);
+                    acc0 += w * load<V>(in + i + t);
+                    acc1 += w * load<V>(in + i + W + t);
+                }
+                store<V>(out + i, acc0);
+                store<V>(out + i + W, acc1);
+            }
+            for (; i + W <= end; i += W) {
+                V acc{};
+                for (std::size_t t = 0; t < k; ++t) {
+                    acc += splat<V>(taps[t]) * load<V>(in + i + t);
+                }
+                store<V>(out + i, acc);
+            }
+            for (; i < end; ++i) {
+                float s = 0.0f;
+                for (std::size_t t = 0; t < k; ++t) {
+                    s += taps[t] * in[i + t];
+                }
+                out[i] = s;
+            }
+        }
+
+        template <class V>
+        PLATFORM_KERNEL_INLINE void conv2d_impl(const Conv2dArgs &a, std::size_t row_begin, std::size_t row_end) {
+            constexpr std::size_t W = kLanes<V>;
+            for (std::size_t r = row_begin; r < row_end; ++r) {
+                float *o      = a.out + r * a.out_width;
+                std::size_t c = 0;
+                for (; c + W <= a.out_width; c += W) {
+                    V acc{};
+                    for (std::size_t kr = 0; kr < a.kernel_height; ++kr) {
+                        const float *row  = a.in + (r + kr) * a.width + c;
+                        const float *krow = a.kernel + kr * a.kernel_width;
+                        for (std::size_t kc = 0; kc < a.kernel_width; ++kc) {
+                            acc += splat<V>(krow[kc]) * load<V>(row + kc);
+                        }
+                    }
+                    store<V>(o + c, acc);
+                }
+                for (; c < a.out_width; ++c) {
+                    float s = 0.0f;
+                    for (std::size_t kr = 0; kr < a.kernel_height; ++kr) {
+                        for (std::size_t kc = 0; kc < a.kernel_width; ++kc) {
+                            s += a.kernel[kr * a.kernel_width + kc] * a.in[(r + kr) * a.width + c + kc];
+                        }
+                    }
+                    o[c] = s;
+                }
+            }
+        }
+
+        template <class V>
+        PLATFORM_KERNEL_INLINE void stencil5_impl(const StencilArgs &a, std::size_t row_begin, std::size_t row_end) {
+            constexpr std::size_t W = kLanes<V>;
+            const Stencil5 &w       = a.weights;
+            for (std::size_t r = row_begin; r < row_end; ++r) {
+                const float *x = a.in + r * a.width;
+                float *o       = a.out + r * a.width;
+                if (r == 0 || r + 1 == a.height || a.width < 3) {
+                    std::memcpy(o, x, a.width * sizeof(float));
+                    continue;
+                }
+                const float *up   = x - a.width;
+                const float *down = x + a.width;
+                o[0]              = x[0];
+                o[a.width - 1]    = x[a.width - 1];
+                const V vc = splat<V>(w.center), vn = splat<V>(w.north), vs = splat<V>(w.south);
+                const V vw = splat<V>(w.west), ve = splat<V>(w.east);
+                std::size_t c = 1;
+                for (; c + W <= a.width - 1; c += W) {
+                    store<V>(o + c, vc * load<V>(x + c) + vn * load<V>(up + c) + vs * load<V>(down + c) +
+                                        vw * load<V>(x + c - 1) + ve * load<V>(x + c + 1));
+                }
+                for (; c < a.width - 1; ++c) {
+                    o[c] = w.center * x[c] + w.north * up[c] + w.south * down[c] + w.west * x[c - 1] + w.east * x[c + 1];
+                }
+            }
+        }
+
+        // Four vectors in flight give the step chain four independent multiply-add streams.
+        template <class V>
+        PLATFORM_KERNEL_INLINE void affine_impl(const float *in, const AffineStep *steps, std::size_t k, float *out,
+                                                std::size_t n) {
+            constexpr std::size_t W = kLanes<V>;
+            std::size_t i = 0;
+            for (; i + 4 * W <= n; i += 4 * W) {
+                V x0 = load<V>(in + i), x1 = load<V>(in + i + W);
+                V x2 = load<V>(in + i + 2 * W), x3 = load<V>(in + i + 3 * W);
+                for (std::size_t s = 0; s < k; ++s) {
+                    const V scale = splat<V>(steps[s].scale);
+                    const V bias  = splat<V>(steps[s].bias);
+                    x0 = x0 * scale + bias;
+                    x1 = x1 * scale + bias;
+                    x2 = x2 * scale + bias;
+                    x3 = x3 * scale + bias;
+                }
+                store<V>(out + i, x0);
+                store<V>(out + i + W, x1);
+                store<V>(out + i + 2 * W, x2);
+                store<V>(out + i + 3 * W, x3);
+            }
+            for (; i + W <= n; i += W) {
+                V x = load<V>(in + i);
+                for (std::size_t s = 0; s < k; ++s) {
+                    x = x * splat<V>(steps[s].scale) + splat<V>(steps[s].bias);
+                }
+                store<V>(out + i, x);
+            }
+            for (; i < n; ++i) {
+                float x = in[i];
+                for (std::size_t s = 0; s < k; ++s) {
+                    x = x * steps[s].scale + steps[s].bias;
+                }
+                out[i] = x;
+            }
+        }
+
+        struct KernelTable {
+            float (*sum)(const float *, std::size_t);
+            float (*max)(const float *, std::size_t);
+            float (*dot)(const float *, const float *, std::size_t);
+            float (*scan)(const float *, float *, std::size_t, float);
+            void (*saxpy)(float, const float *, float *, std::size_t);
+            void (*conv1d)(const float *, const float *, std::size_t, float *, std::size_t, std::size_t);
+            void (*conv2d)(const Conv2dArgs &, std::size_t, std::size_t);
+            void (*stencil5)(const StencilArgs &, std::size_t, std::size_t);
+            void (*affine)(const float *, const AffineStep *, std::size_t, float *, std::size_t);
+        };
+
+#define PLATFORM_DEFINE_KERNELS(suffix, V, TARGET)                                                                     \
+    TARGET float sum_##suffix(const float *x, std::size_t n) {                                                         \
+        return sum_impl<V>(x, n);                                                                                      \
+    }                                                                                                                  \
+    TARGET float max_##suffix(const float *x, std::size_t n) {                                                         \
+        return max_impl<V>(x, n);                                                                                      \
+    }                                                                                                                  \
+    TARGET float dot_##suffix(const float *a, const float *b, std::size_t n) {                                         \
+        return dot_impl<V>(a, b, n);                                                                                   \
+    }                                                                                                                  \
+    TARGET float scan_##suffix(const float *in, float *out, std::size_t n, float carry) {                              \
+        return scan_impl<V>(in, out, n, carry);                                                                        \
+    }                                                                                                                  \
+    TARGET void saxpy_##suffix(float alpha, const float *x, float *y, std::size_t n) {                                 \
+        saxpy_impl<V>(alpha, x, y, n);                                                                                 \
+    }                                                                                                                  \
+    TARGET void conv1d_##suffix(const float *in, const float *taps, std::size_t k, float *out, std::size_t begin,      \
+                                std::size_t end) {                                                                     \
+        conv1d_impl<V>(in, taps, k, out, begin, end);                                                                  \
+    }                                                                                                                  \
+    TARGET void conv2d_##suffix(const Conv2dArgs &a, std::size_t row_begin, std::size_t row_end) {                     \
+        conv2d_impl<V>(a, row_begin, row_end);                                                                         \
+    }                                                                                                                  \
+    TARGET void stencil5_##suffix(const StencilArgs &a, std::size_t row_begin, std::size_t row_end) {                  \
+        stencil5_impl<V>(a, row_begin, row_end);                                                                       \
+    }                                                                                                                  \
+    TARGET void affine_##suffix(const float *in, const AffineStep *steps, std::size_t k, float *out, std::size_t n) {  \
+        affine_impl<V>(in, steps, k, out, n);                                                                          \
+    }                                                                                                                  \
+    constexpr KernelTable kKernels_##suffix{sum_##suffix,   max_##suffix,    dot_##suffix,      scan_##suffix,         \
+                                            saxpy_##suffix, conv1d_##suffix, conv2d_##suffix,   stencil5_##suffix,     \
+                                            affine_##suffix};
+
+        PLATFORM_DEFINE_KERNELS(scalar, float, )
+#if defined(PLATFORM_VECTOR_EXT) && (defined(__x86_64__) || defined(__i386__))
+#define PLATFORM_KERNELS_X86 1
+        PLATFORM_DEFINE_KERNELS(sse2, F32x4, __attribute__((target("sse2"))))
+        PLATFORM_DEFINE_KERNELS(avx2, F32x8, __attribute__((target("avx2,fma"))))
+        PLATFORM_DEFINE_KERNELS(avx512, F32x16, __attribute__((target("avx512f"))))
+#endif
+#if defined(PLATFORM_VECTOR_EXT) && defined(__aarch64__)
+#define PLATFORM_KERNELS_NEON 1
+        PLATFORM_DEFINE_KERNELS(neon, F32x4, )
+#endif
+
+        const KernelTable &kernels(const KernelOptions &options) {
+            const SimdIsa isa =
+                options.isa.has_value() && simd_isa_supported(*options.isa) ? *options.isa : active_simd_isa();
+            switch (isa) {
+#ifdef PLATFORM_KERNELS_X86
+                case SimdIsa::kSse2:
+                    return kKernels_sse2;
+                case SimdIsa::kAvx2:
+                    return kKernels_avx2;
+                case SimdIsa::kAvx512:
+                    return kKernels_avx512;
+#endif
+#ifdef PLATFORM_KERNELS_NEON
+                case SimdIsa::kNeon:
+                    return kKernels_neon;
+#endif
+                default:
+                    return kKernels_scalar;
+            }
+        }
+
+        std::size_t participants(const KernelOptions &options) {
+            return options.pool == nullptr ? 1 : options.pool->thread_count() + 1;
+        }
+
+        bool run_parallel(const KernelOptions &options, std::size_t n) {
+            return participants(options) > 1 && n >= options.parallel.min_parallel_elements;
+        }
+
+        // Per-chunk partial results combined in chunk order, so a given chunking is deterministic.
+        template <class Partial, class Combine>
+        float reduce_chunks(std::size_t n, std::size_t bytes_per_element, const KernelOptions &options, float init,
+                            const Partial &partial, const Combine &combine) {
+            if (!run_parallel(options, n)) {
+                return combine(init, partial(std::size_t{0}, n));
+            }
+            const std::size_t chunk = parallel_chunk_elements(n, participants(options), bytes_per_element,
+                                                              options.parallel);
+            const std::size_t chunks = (n + chunk - 1) / chunk;
+            std::vector<float> partials(chunks);
+            parallel_for_chunks(options.pool, chunks, [&](std::size_t c) {
+                partials[c] = partial(c * chunk, std::min(n, (c + 1) * chunk));
+            });
+            float result = init;
+            for (float p : partials) {
+                result = combine(result, p);
+            }
+            return result;
+        }
+
+        // Row bands for 2D kernels, sized like parallel_for() chunks but never splitting a row.
+        template <class Fn>
+        void for_rows(const KernelOptions &options, std::size_t rows, std::size_t row_elements,
+                      std::size_t bytes_per_element, const Fn &fn) {
+            if (rows == 0) {
+                return;
+            }
+            const std::size_t n = rows * row_elements;
+            if (!run_parallel(options, n)) {
+                fn(std::size_t{0}, rows);
+                return;
+            }
+            const std::size_t chunk =
+                parallel_chunk_elements(n, participants(options), bytes_per_element, options.parallel);
+            const std::size_t band  = std::max<std::size_t>(chunk / std::max<std::size_t>(row_elements, 1), 1);
+            const std::size_t bands = (rows + band - 1) / band;
+            parallel_for_chunks(options.pool, bands,
+                                [&](std::size_t b) { fn(b * band, std::min(rows, (b + 1) * band)); });
+        }
+    } // namespace
+
+    float reduce_sum(std::span<const float> x, const KernelOptions &options) {
+        const auto &k = kernels(options);
+        return reduce_chunks(
+            x.size(), sizeof(float), options, 0.0f,
+            [&](std::size_t begin, std::size_t end) { return k.sum(x.data() + begin, end - begin); },
+            [](float a, float b) { return a + b; });
+    }
+
+    float reduce_max(std::span<const float> x, const KernelOptions &options) {
+        const auto &k = kernels(options);
+        return reduce_chunks(
+            x.size(), sizeof(float), options, -std::numeric_limits<float>::infinity(),
+            [&](std::size_t begin, std::size_t end) { return k.max(x.data() + begin, end - begin); },
+            [](float a, float b) { return b > a ? b : a; });
+    }
+
+    float dot(std::span<const float> a, std::span<const float> b, const KernelOptions &options) {
+        const auto &k       = kernels(options);
+        const std::size_t n = std::min(a.size(), b.size());
+        return reduce_chunks(
+            n, 2 * sizeof(float), options, 0.0f,
+            [&](std::size_t begin, std::size_t end) { return k.dot(a.data() + begin, b.data() + begin, end - begin); },
+            [](float x, float y) { return x + y; });
+    }
+
+    bool inclusive_scan(std::span<const float> in, std::span<float> out, const KernelOptions &options) {
+        const std::size_t n = in.size();
+        if (out.size() < n) {
+            return false;
+        }
+        if (n == 0) {
+            return true;
+        }
+        const auto &k = kernels(options);
+        const std::size_t chunk =
+            parallel_chunk_elements(n, participants(options), 2 * sizeof(float), options.parallel);
+        const std::size_t chunks = (n + chunk - 1) / chunk;
+        auto length              = [&](std::size_t c) { return std::min(n, (c + 1) * chunk) - c * chunk; };
+
+        if (!run_parallel(options, n) || chunks == 1) {
+            float carry = 0.0f;
+            for (std::size_t c = 0; c < chunks; ++c) {
+                carry = k.scan(in.data() + c * chunk, out.data() + c * chunk, length(c), carry);
+            }
+            return true;
+        }
+        // Three phases: chunk totals in parallel, a short serial scan of the totals, then every
+        // chunk scanned in parallel from its carry-in.
+        std::vector<float> carries(chunks);
+        parallel_for_chunks(options.pool, chunks,
+                            [&](std::size_t c) { carries[c] = k.sum(in.data() + c * chunk, length(c)); });
+        float running = 0.0f;
+        for (float &c : carries) {
+            const float total = c;
+            c                 = running;
+            running += total;
+        }
+        parallel_for_chunks(options.pool, chunks, [&](std::size_t c) {
+            k.scan(in.data() + c * chunk, out.data() + c * chunk, length(c), carries[c]);
+        });
+        return true;
+    }
+
+    bool saxpy(float alpha, std::span<const float> x, std::span<float> y, const KernelOptions &options) {
+        if (y.size() < x.size()) {
+            return false;
+        }
+        const auto &k = kernels(options);
+        parallel_for(options.pool, x.size(), 3 * sizeof(float), options.parallel,
+                     [&](std::size_t begin, std::size_t end) {
+                         k.saxpy(alpha, x.data() + begin, y.data() + begin, end - begin);
+                     });
+        return true;
+    }
+
+    bool conv1d(std::span<const float> in, std::span<const float> taps, std::span<float> out,
+                const KernelOptions &options) {
+        if (taps.empty() || in.size() < taps.size()) {
+            return false;
+        }
+        const std::size_t m = in.size() - taps.size() + 1;
+        if (out.size() < m) {
+            return false;
+        }
+        const auto &k = kernels(options);
+        parallel_for(options.pool, m, 2 * sizeof(float), options.parallel, [&](std::size_t begin, std::size_t end) {
+            k.conv1d(in.data(), taps.data(), taps.size(), out.data(), begin, end);
+        });
+        return true;
+    }
+
+    bool conv2d(std::span<const float> in, std::size_t width, std::span<const float> kernel, std::size_t kernel_width,
+                std::span<float> out, const KernelOptions &options) {
+        if (width == 0 || kernel_width == 0 || in.size() % width != 0 || kernel.size() % kernel_width != 0) {
+            return false;
+        }
+        const std::size_t height        = in.size() / width;
+        const std::size_t kernel_height = kernel.size() / kernel_width;
+        if (kernel_height == 0 || kernel_width > width || kernel_height > height) {
+            return false;
+        }
+        const std::size_t out_width  = width - kernel_width + 1;
+        const std::size_t out_height = height - kernel_height + 1;
+        if (out.size() < out_width * out_height) {
+            return false;
+        }
+        const auto &k = kernels(options);
+        const Conv2dArgs args{in.data(), width, kernel.data(), kernel_width, kernel_height, out.data(), out_width};
+        for_rows(options, out_height, out_width, (kernel_height + 1) * sizeof(float),
+                 [&](std::size_t begin, std::size_t end) { k.conv2d(args, begin, end); });
+        return true;
+    }
+
+    bool stencil5(std::span<const float> in, std::size_t width, const Stencil5 &weights, std::span<float> out,
+                  const KernelOptions &options) {
+        if (width == 0 || in.size() % width != 0 || out.size() < in.size()) {
+            return false;
+        }
+        const auto &k = kernels(options);
+        const StencilArgs args{in.data(), width, in.size() / width, weights, out.data()};
+        for_rows(options, args.height, width, 4 * sizeof(float),
+                 [&](std::size_t begin, std::size_t end) { k.stencil5(args, begin, end); });
+        return true;
+    }
+
+    bool fused_affine(std::span<const float> in, std::span<const AffineStep> steps, std::span<float> out,
+                      const KernelOptions &options) {
+        if (out.size() < in.size()) {
+            return false;
+        }
+        const auto &k = kernels(options);
+        parallel_for(options.pool, in.size(), 2 * sizeof(float), options.parallel,
+                     [&](std::size_t begin, std::size_t end) {
+                         k.affine(in.data() + begin, steps.data(), steps.size(), out.data() + begin, end - begin);
+                     });
+        return true;
+    }
+
+    namespace reference {
+
+        float reduce_sum(std::span<const float> x) {
+            double s = 0.0;
+            for (float v : x) {
+                s += v;
+            }
+            return static_cast<float>(s);
+        }
+
+        float reduce_max(std::span<const float> x) {
+            float m = -std::numeric_limits<float>::infinity();
+            for (float v : x) {
+                m = std::max(m, v);
+            }
+            return m;
+        }
+
+        float dot(std::span<const float> a, std::span<const float> b) {
+            double s = 0.0;
+            for (std::size_t i = 0; i < std::min(a.size(), b.size()); ++i) {
+                s += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+            }
+            return static_cast<float>(s);
+        }
+
+        bool inclusive_scan(std::span<const float> in, std::span<float> out) {
+            if (out.size() < in.size()) {
+                return false;
+            }
+            double s = 0.0;
+            for (std::size_t i = 0; i < in.size(); ++i) {
+                s += in[i];
+                out[i] = static_cast<float>(s);
+            }
+            return true;
+        }
+
+        bool saxpy(float alpha, std::span<const float> x, std::span<float> y) {
+            if (y.size() < x.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                y[i] = alpha * x[i] + y[i];
+            }
+            return true;
+        }
+
+        bool conv1d(std::span<const float> in, std::span<const float> taps, std::span<float> out) {
+            if (taps.empty() || in.size() < taps.size() || out.size() < in.size() - taps.size() + 1) {
+                return false;
+            }
+            for (std::size_t i = 0; i + taps.size() <= in.size(); ++i) {
+                float s = 0.0f;
+                for (std::size_t t = 0; t < taps.size(); ++t) {
+                    s += taps[t] * in[i + t];
+                }
+                out[i] = s;
+            }
+            return true;
+        }
+
+        bool conv2d(std::span<const float> in, std::size_t width, std::span<const float> kernel,
+                    std::size_t kernel_width, std::span<float> out) {
+            if (width == 0 || kernel_width == 0 || in.size() % width != 0 || kernel.size() % kernel_width != 0) {
+                return false;
+            }
+            const std::size_t height        = in.size() / width;
+            const std::size_t kernel_height = kernel.size() / kernel_width;
+            if (kernel_height == 0 || kernel_width > width || kernel_height > height) {
+                return false;
+            }
+            const std::size_t out_width  = width - kernel_width + 1;
+            const std::size_t out_height = height - kernel_height + 1;
+            if (out.size() < out_width * out_height) {
+                return false;
+            }
+            for (std::size_t r = 0; r < out_height; ++r) {
+                for (std::size_t c = 0; c < out_width; ++c) {
+                    float s = 0.0f;
+                    for (std::size_t kr = 0; kr < kernel_height; ++kr) {
+                        for (std::size_t kc = 0; kc < kernel_width; ++kc) {
+                            s += kernel[kr * kernel_width + kc] * in[(r + kr) * width + c + kc];
+                        }
+                    }
+                    out[r * out_width + c] = s;
+                }
+            }
+            return true;
+        }
+
+        bool stencil5(std::span<const float> in, std::size_t width, const Stencil5 &weights, std::span<float> out) {
+            if (width == 0 || in.size() % width != 0 || out.size() < in.size()) {
+                return false;
+            }
+            const std::size_t height = in.size() / width;
+            for (std::size_t r = 0; r < height; ++r) {
+                for (std::size_t c = 0; c < width; ++c) {
+                    const std::size_t i = r * width + c;
+                    if (r == 0 || c == 0 || r + 1 == height || c + 1 == width) {
+                        out[i] = in[i];
+                        continue;
+                    }
+                    out[i] = weights.center * in[i] + weights.north * in[i - width] + weights.south * in[i + width] +
+                             weights.west * in[i - 1] + weights.east * in[i + 1];
+                }
+            }
+            return true;
+        }
+
+        bool fused_affine(std::span<const float> in, std::span<const AffineStep> steps, std::span<float> out) {
+            if (out.size() < in.size()) {
+                return false;
+            }
+            std::copy(in.begin(), in.end(), out.begin());
+            for (const auto &step : steps) {
+                for (std::size_t i = 0; i < in.size(); ++i) {
+                    out[i] = out[i] * step.scale + step.bias;
+                }
+            }
+            return true;
+        }
+
+    } // namespace reference
+
+} // namespace platform
@@ -0,0 +1,180 @@
+#include "platform/cpu_topology.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace platform {
+
+    namespace {
+        std::optional<std::string> read_first_line(const std::string &path) {
+            std::ifstream in(path);
+            if (!in) {
+                return std::nullopt;
+            }
+            std::string line;
+            std::getline(in, line);
+            return line;
+        }
+
+        // Highest CPU id plus one that a list may name: the kernel's cpu_set_t size, which also keeps
+        // a range from expanding into an unbounded vector or overflowing the loop that builds it.
+#ifdef __linux__
+        constexpr int kMaxCpus = CPU_SETSIZE;
+#else
+        constexpr int kMaxCpus = 1024;
+#endif
+
+        bool parse_cpu(std::string_view text, int &out) {
+            const auto *end = text.data() + text.size();
+            auto [ptr, ec]  = std::from_chars(text.data(), end, out);
+            return ec == std::errc{} && ptr == end && out >= 0 && out < kMaxCpus;
+        }
+
+        CpuTopology read_topology() {
+            CpuTopology topology;
+#ifdef __linux__
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+                for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &mask)) {
+                        topology.usable.push_back(cpu);
+                    }
+                }
+            }
+            if (const auto line = read_first_line("/sys/devices/system/cpu/isolated")) {
+                topology.isolated = parse_cpu_list(*line).value_or(std::vector<int>{});
+            }
+            std::vector<int> node_ids;
+            if (DIR *dir = opendir("/sys/devices/system/node")) {
+                while (const dirent *entry = readdir(dir)) {
+                    const std::string_view name(entry->d_name);
+                    int id = 0;
+                    if (name.starts_with("node") && parse_cpu(name.substr(4), id)) {
+                        node_ids.push_back(id);
+                    }
+                }
+                closedir(dir);
+            }
+            std::sort(node_ids.begin(), node_ids.end());
+            for (const int id : node_ids) {
+                const auto line = read_first_line("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist");
+                auto cpus       = line ? parse_cpu_list(*line) : std::nullopt;
+                if (cpus) {
+                    auto local = intersect_cpus(*cpus, topology.usable);
+                    if (!local.empty()) {
+                        topology.nodes.push_back(std::move(local));
+                    }
+                }
+            }
+#endif
+            if (topology.usable.empty()) {
+                const unsigned n = std::max(std::thread::hardware_concurrency(), 1u);
+                for (unsigned cpu = 0; cpu < n; ++cpu) {
+                    topology.usable.push_back(static_cast<int>(cpu));
+                }
+            }
+            if (topology.nodes.empty()) {
+                topology.nodes.push_back(topology.usable);
+            }
+            return topology;
+        }
+    } // namespace
+
+    std::size_t CpuTopology::node_of(int cpu) const {
+        for (std::size_t node = 0; node < nodes.size(); ++node) {
+            if (std::binary_search(nodes[node].begin(), nodes[node].end(), cpu)) {
+                return node;
+            }
+        }
+        return 0;
+    }
+
+    const CpuTopology &cpu_topology() {
+        static const CpuTopology topology = read_topology();
+        return topology;
+    }
+
+    std::optional<std::vector<int>> parse_cpu_list(std::string_view text) {
+        while (!text.empty() && (text.back() == '\n' || text.back() == ' ')) {
+            text.remove_suffix(1);
+        }
+        std::vector<int> cpus;
+        while (!text.empty()) {
+            const auto comma = text.find(',');
+            const auto item  = text.substr(0, comma);
+            text             = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+            const auto dash  = item.find('-');
+            int first        = 0;
+            int last         = 0;
+            if (dash == std::string_view::npos) {
+                if (!parse_cpu(item, first)) {
+                    return std::nullopt;
+                }
+                last = first;
+            } else if (!parse_cpu(item.substr(0, dash), first) || !parse_cpu(item.substr(dash + 1), last) ||
+                       last < first) {
+                return std::nullopt;
+            }
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+
+    std::vector<int> intersect_cpus(std::span<const int> a, std::span<const int> b) {
+        std::vector<int> out;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+        return out;
+    }
+
+    bool pin_current_thread(std::span<const int> cpus) {
+        if (cpus.empty()) {
+            return false;
+        }
+#ifdef __linux__
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        for (const int cpu : cpus) {
+            if (cpu < 0 || cpu >= CPU_SETSIZE) {
+                return false;
+            }
+            CPU_SET(cpu, &mask);
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+        return false;
+#endif
+    }
+
+    int current_cpu() {
+#ifdef __linux__
+        return sched_getcpu();
+#else
+        return -1;
+#endif
+    }
+
+    void name_current_thread(std::string_view name) {
+#ifdef __linux__
+        const std::string truncated(name.substr(0, 15));
+        pthread_setname_np(pthread_self(), truncated.c_str());
+#else
+        (void)name;
+#endif
+    }
+
+} // namespace platform
@@ -0,0 +1,183 @@
+#include "platform/deadline_executor.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "platform/metrics.hpp"
+
+namespace platform {
+
+    namespace {
+        // std::push_heap keeps the largest element on top, so "less" means "runs later".
+        template <class Job> bool runs_later(const Job &a, const Job &b) {
+            if (a.deadline != b.deadline) {
+                return a.deadline > b.deadline;
+            }
+            return a.sequence > b.sequence;
+        }
+
+        std::uint64_t elapsed_ns(std::chrono::steady_clock::duration d) {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+            return ns < 0 ? 0 : static_cast<std::uint64_t>(ns);
+        }
+    } // namespace
+
+    DeadlineExecutor::DeadlineExecutor(DeadlineExecutorOptions options)
+        : capacity_(std::max<std::size_t>(options.capacity, 1)),
+          shard_count_(std::max<std::size_t>(options.shards != 0 ? options.shards : options.threads, 1)),
+          shards_(std::make_unique<Shard[]>(shard_count_)) {
+        for (std::size_t i = 0; i < shard_count_; ++i) {
+            shards_[i].heap.reserve(capacity_ / shard_count_ + 1);
+        }
+        workers_.reserve(options.threads);
+        for (std::size_t i = 0; i < options.threads; ++i) {
+            workers_.emplace_back([this]() { worker(); });
+        }
+    }
+
+    DeadlineExecutor::~DeadlineExecutor() {
+        shutdown();
+    }
+
+    bool DeadlineExecutor::submit(Clock::time_point deadline, std::function<void()> job, LatePolicy late) {
+        const auto *metrics = metrics_.load(std::memory_order_acquire);
+        auto reject         = [metrics]() {
+            if (metrics != nullptr) {
+                metrics->rejected->add();
+            }
+            return false;
+        };
+        if (shutting_down_.load(std::memory_order_relaxed)) {
+            return reject();
+        }
+        if (depth_.fetch_add(1, std::memory_order_relaxed) >= capacity_) {
+            depth_.fetch_sub(1, std::memory_order_relaxed);
+            return reject();
+        }
+        Shard &shard = shards_[next_shard_.fetch_add(1, std::memory_order_relaxed) % shard_count_];
+        {
+            std::lock_guard lock(shard.mutex);
+            shard.heap.push_back({deadline, sequence_.fetch_add(1, std::memory_order_relaxed), late, std::move(job)});
+            std::push_heap(shard.heap.begin(), shard.heap.end(), runs_later<Job>);
+            shard.earliest.store(earliest_ticks(shard.heap.front().deadline), std::memory_order_release);
+        }
+        if (metrics != nullptr) {
+            metrics->depth->set(static_cast<std::int64_t>(depth_.load(std::memory_order_relaxed)));
+        }
+        ready_.release();
+        return true;
+    }
+
+    std::int64_t DeadlineExecutor::earliest_ticks(Clock::time_point deadline) {
+        return std::min<std::int64_t>(deadline.time_since_epoch().count(), kNoDeadline - 1);
+    }
+
+    std::optional<DeadlineExecutor::Job> DeadlineExecutor::pop() {
+        while (true) {
+            std::size_t best        = 0;
+            std::int64_t best_ticks = kNoDeadline;
+            for (std::size_t i = 0; i < shard_count_; ++i) {
+                const auto ticks = shards_[i].earliest.load(std::memory_order_acquire);
+                if (ticks < best_ticks) {
+                    best       = i;
+                    best_ticks = ticks;
+                }
+            }
+            if (best_ticks == kNoDeadline) {
+                if (shutting_down_.load(std::memory_order_acquire)) {
+                    return std::nullopt;
+                }
+                // Another worker took the job this one saw; ours is still being published.
+                std::this_thread::yield();
+                continue;
+            }
+            Shard &shard = shards_[best];
+            std::lock_guard lock(shard.mutex);
+            if (shard.heap.empty()) {
+                continue;
+            }
+            std::pop_heap(shard.heap.begin(), shard.heap.end(), runs_later<Job>);
+            Job job = std::move(shard.heap.back());
+            shard.heap.pop_back();
+            const auto next = shard.heap.empty() ? kNoDeadline : earliest_ticks(shard.heap.front().deadline);
+            shard.earliest.store(next, std::memory_order_release);
+            depth_.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    void DeadlineExecutor::run(Job &job) {
+        const auto *metrics = metrics_.load(std::memory_order_acquire);
+        if (metrics != nullptr) {
+            metrics->depth->set(static_cast<std::int64_t>(depth_.load(std::memory_order_relaxed)));
+        }
+        const auto started = Clock::now();
+        if (started > job.deadline) {
+            if (job.late == LatePolicy::kDrop) {
+                if (metrics != nullptr) {
+                    metrics->late_dropped->add();
+                    metrics->misses->add();
+                }
+                return;
+            }
+            if (metrics != nullptr) {
+                metrics->late_started->add();
+            }
+        } else if (metrics != nullptr) {
+            metrics->slack_ns->record(job.deadline - started);
+        }
+        job.fn();
+        if (metrics == nullptr) {
+            return;
+        }
+        const auto finished = Clock::now();
+        if (finished > job.deadline) {
+            metrics->misses->add();
+            metrics->lateness_ns->record(elapsed_ns(finished - job.deadline));
+        }
+        metrics->jobs->add();
+    }
+
+    void DeadlineExecutor::worker() {
+        while (true) {
+            ready_.acquire();
+            if (shutting_down_.load(std::memory_order_acquire)) {
+                return;
+            }
+            auto job = pop();
+            if (!job) {
+                return;
+            }
+            run(*job);
+        }
+    }
+
+    void DeadlineExecutor::shutdown() {
+        if (shutting_down_.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        ready_.release(static_cast<std::ptrdiff_t>(workers_.size()));
+        for (auto &t : workers_) {
+            if (t.joinable()) {
+                t.join();
+            }
+        }
+    }
+
+    void DeadlineExecutor::bind_metrics(MetricsRegistry &registry, std::string_view prefix) {
+        std::call_once(metrics_once_, [&]() {
+            const std::string base(prefix);
+            metrics_storage_.jobs         = &registry.counter(base + "_jobs_total");
+            metrics_storage_.rejected     = &registry.counter(base + "_rejected_total");
+            metrics_storage_.late_dropped = &registry.counter(base + "_late_dropped_total");
+            metrics_storage_.late_started = &registry.counter(base + "_late_started_total");
+            metrics_storage_.misses       = &registry.counter(base + "_deadline_miss_total");
+            metrics_storage_.depth        = &registry.gauge(base + "_queue_depth");
+            metrics_storage_.slack_ns     = &registry.histogram(base + "_slack_ns");
+            metrics_storage_.lateness_ns  = &registry.histogram(base + "_lateness_ns");
+            metrics_storage_.depth->set(static_cast<std::int64_t>(depth_.load(std::memory_order_relaxed)));
+            metrics_.store(&metrics_storage_, std::memory_order_release);
+        });
+    }
+
+} // namespace platform
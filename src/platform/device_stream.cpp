@@ -0,0 +1,242 @@
+#include "platform/device_stream.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "platform/bounded_queue.hpp"
+#include "platform/cuda_stage.hpp"
+
+namespace platform {
+
+    namespace {
+        // Runs operations in submission order on one worker thread, the way a CUDA stream runs
+        // them on the device, so callers see the same asynchrony and need the same synchronize().
+        class CpuStream final : public Stream {
+          public:
+            CpuStream() : worker_([this](std::stop_token st) { run(st); }) {}
+
+            ~CpuStream() override {
+                synchronize();
+                ops_.close();
+            }
+
+            void copy_to_device(void *device_dst, const void *host_src, std::size_t bytes) override {
+                submit([=] {
+                    std::memcpy(device_dst, host_src, bytes);
+                    return true;
+                });
+            }
+
+            void copy_to_host(void *host_dst, const void *device_src, std::size_t bytes) override {
+                submit([=] {
+                    std::memcpy(host_dst, device_src, bytes);
+                    return true;
+                });
+            }
+
+            void vector_add(const float *a, const float *b, float *out, std::size_t n) override {
+                submit([=] {
+                    return vector_add_cpu(std::span<const float>(a, n), std::span<const float>(b, n),
+                                          std::span<float>(out, n));
+                });
+            }
+
+            bool synchronize() override {
+                const std::uint64_t target = submitted_;
+                std::uint64_t done         = completed_.load(std::memory_order_acquire);
+                while (done < target) {
+                    completed_.wait(done, std::memory_order_acquire);
+                    done = completed_.load(std::memory_order_acquire);
+                }
+                return !failed_.load(std::memory_order_acquire);
+            }
+
+            StreamBackend backend() const override {
+                return StreamBackend::kCpu;
+            }
+
+          private:
+            void submit(std::function<bool()> op) {
+                ++submitted_;
+                ops_.push(std::move(op));
+            }
+
+            void run(std::stop_token st) {
+                while (auto op = ops_.pop(st)) {
+                    if (!(*op)()) {
+                        failed_.store(true, std::memory_order_release);
+                    }
+                    completed_.fetch_add(1, std::memory_order_acq_rel);
+                    completed_.notify_all();
+                }
+            }
+
+            // Only touched by the submitting thread; streams are not shared between submitters.
+            std::uint64_t submitted_{0};
+            std::atomic<std::uint64_t> completed_{0};
+            std::atomic<bool> failed_{false};
+            BoundedQueue<std::function<bool()>> ops_{256};
+            // Declared last so the worker stops before the queue it drains is destroyed.
+            std::jthread worker_;
+        };
+
+        MemoryUpstream device_upstream_for(StreamBackend backend) {
+#ifdef PLATFORM_ENABLE_CUDA
+            if (backend == StreamBackend::kCuda) {
+                return cuda_device_upstream();
+            }
+#else
+            (void)backend;
+#endif
+            return host_upstream();
+        }
+
+        MemoryUpstream staging_upstream_for(StreamBackend backend) {
+#ifdef PLATFORM_ENABLE_CUDA
+            if (backend == StreamBackend::kCuda) {
+                return cuda_pinned_upstream();
+            }
+#else
+            (void)backend;
+#endif
+            return host_upstream();
+        }
+
+        StreamBackend resolve_backend(StreamBackend requested) {
+#ifdef PLATFORM_ENABLE_CUDA
+            if (requested == StreamBackend::kCuda && check_cuda_available()) {
+                return StreamBackend::kCuda;
+            }
+#else
+            (void)requested;
+#endif
+            return StreamBackend::kCpu;
+        }
+    } // namespace
+
+    std::unique_ptr<Stream> make_cpu_stream() {
+        return std::make_unique<CpuStream>();
+    }
+
+    std::unique_ptr<Stream> make_stream(StreamBackend backend) {
+#ifdef PLATFORM_ENABLE_CUDA
+        if (backend == StreamBackend::kCuda) {
+            if (auto stream = make_cuda_stream()) {
+                return stream;
+            }
+        }
+#else
+        (void)backend;
+#endif
+        return make_cpu_stream();
+    }
+
+    StreamedVectorAdd::StreamedVectorAdd(StreamBackend backend, StreamedOptions options)
+        : options_(options), backend_(resolve_backend(backend)), device_pool_(device_upstream_for(backend_)),
+          staging_pool_(staging_upstream_for(backend_)) {
+        options_.streams        = std::max<std::size_t>(options_.streams, 1);
+        options_.batch_elements = std::max<std::size_t>(options_.batch_elements, 1);
+        streams_.reserve(options_.streams);
+        for (std::size_t i = 0; i < options_.streams; ++i) {
+            streams_.push_back(make_stream(backend_));
+        }
+    }
+
+    StreamedVectorAdd::~StreamedVectorAdd() {
+        // Streams may still reference pooled blocks; drain them before the pools go away.
+        for (auto &stream : streams_) {
+            stream->synchronize();
+        }
+        streams_.clear();
+    }
+
+    bool StreamedVectorAdd::run(const float *a, const float *b, float *out, std::size_t n) {
+        if (n == 0) {
+            return true;
+        }
+        std::lock_guard lock(mutex_);
+
+        // Each stream owns one staging and one device block laid out as [a | b | out]. Batch k runs
+        // on stream k % streams; before a stream takes a new batch its previous one is collected,
+        // so copies and kernels of neighbouring batches overlap on the other streams.
+        struct Slot {
+            PoolBlock staging;
+            PoolBlock device;
+            std::size_t offset{0};
+            std::size_t count{0};
+            bool pending{false};
+        };
+        const std::size_t batch  = std::min(options_.batch_elements, n);
+        const std::size_t slots  = std::min(streams_.size(), (n + batch - 1) / batch);
+        const std::size_t stride = batch * sizeof(float);
+        std::vector<Slot> slot(slots);
+        for (auto &s : slot) {
+            s.staging = staging_pool_.acquire(3 * stride);
+            s.device  = device_pool_.acquire(3 * stride);
+            if (!s.staging || !s.device) {
+                return false;
+            }
+        }
+
+        bool ok      = true;
+        auto collect = [&](std::size_t i) {
+            Slot &s = slot[i];
+            if (!s.pending) {
+                return;
+            }
+            s.pending = false;
+            if (!streams_[i]->synchronize()) {
+                ok = false;
+                return;
+            }
+            std::memcpy(out + s.offset, s.staging.as<float>() + 2 * batch, s.count * sizeof(float));
+        };
+
+        std::size_t k = 0;
+        for (std::size_t offset = 0; offset < n; offset += batch, ++k) {
+            const std::size_t i = k % slots;
+            collect(i);
+            if (!ok) {
+                break;
+            }
+            Slot &s              = slot[i];
+            Stream &stream       = *streams_[i];
+            const std::size_t m  = std::min(batch, n - offset);
+            const std::size_t nb = m * sizeof(float);
+            float *host          = s.staging.as<float>();
+            float *dev           = s.device.as<float>();
+            std::memcpy(host, a + offset, nb);
+            std::memcpy(host + batch, b + offset, nb);
+            stream.copy_to_device(dev, host, nb);
+            stream.copy_to_device(dev + batch, host + batch, nb);
+            stream.vector_add(dev, dev + batch, dev + 2 * batch, m);
+            stream.copy_to_host(host + 2 * batch, dev + 2 * batch, nb);
+            s.offset  = offset;
+            s.count   = m;
+            s.pending = true;
+        }
+        for (std::size_t i = 0; i < slots; ++i) {
+            if (ok) {
+                collect(i);
+            } else {
+                // Still wait: the blocks go back to the pools when `slot` is destroyed.
+                streams_[i]->synchronize();
+            }
+        }
+        return ok;
+    }
+
+    void StreamedVectorAdd::bind_metrics(MetricsRegistry &registry, std::string_view prefix) {
+        const std::string base(prefix);
+        device_pool_.bind_metrics(registry, base + "_device_pool");
+        staging_pool_.bind_metrics(registry, base + "_staging_pool");
+    }
+
+} // namespace platform
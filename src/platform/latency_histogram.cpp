@@ -0,0 +1,60 @@
+#include "platform/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace platform {
+
+    namespace {
+        // Smallest sub-bucket resolution whose relative error is below 10^-digits.
+        unsigned sub_bits_for_digits(int significant_digits) {
+            const int digits = std::clamp(significant_digits, 1, 4);
+            return static_cast<unsigned>(std::ceil(std::log2(std::pow(10.0, digits))));
+        }
+    } // namespace
+
+    LatencyHistogram::LatencyHistogram(std::uint64_t highest_trackable, int significant_digits)
+        : highest_(std::max<std::uint64_t>(highest_trackable, 1)), sub_bits_(sub_bits_for_digits(significant_digits)),
+          counts_(detail::log_linear_bucket_count(highest_, sub_bits_), 0) {}
+
+    bool LatencyHistogram::merge(const LatencyHistogram &other) noexcept {
+        if (other.highest_ != highest_ || other.sub_bits_ != sub_bits_) {
+            return false;
+        }
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        count_ += other.count_;
+        saturated_ += other.saturated_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        return true;
+    }
+
+    void LatencyHistogram::reset() noexcept {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        count_     = 0;
+        saturated_ = 0;
+        sum_       = 0;
+        min_       = UINT64_MAX;
+        max_       = 0;
+    }
+
+    std::uint64_t LatencyHistogram::percentile(double p) const noexcept {
+        if (count_ == 0) {
+            return 0;
+        }
+        const double q     = std::clamp(p, 0.0, 100.0) / 100.0;
+        const auto rank    = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count_))));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return std::clamp(detail::log_linear_upper_bound(i, sub_bits_), min_, max_);
+            }
+        }
+        return max_;
+    }
+
+} // namespace platform
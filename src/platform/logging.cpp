@@ -25,8 +25,10 @@ const char* level_to_string(LogLevel level) {
 
 void set_log_level(LogLevel level) { current_level = level; }
 
+bool log_enabled(LogLevel level) { return level >= current_level; }
+
 void log(LogLevel level, const std::string& msg) {
-    if (level < current_level) {
+    if (!log_enabled(level)) {
         return;
     }
     auto now = std::chrono::system_clock::now();
@@ -0,0 +1,165 @@
+#include "platform/memory_pool.hpp"
+
+#include <new>
+#include <string>
+#include <utility>
+
+#include "platform/metrics.hpp"
+
+namespace platform {
+
+    namespace {
+        constexpr std::size_t kMinClass  = 256;
+        constexpr std::size_t kMiB       = std::size_t{1} << 20;
+        constexpr std::size_t kPageAlign = 4096;
+
+        void *host_allocate(std::size_t bytes) {
+            return ::operator new(bytes, std::align_val_t{kPageAlign}, std::nothrow);
+        }
+        void host_deallocate(void *ptr, std::size_t) {
+            ::operator delete(ptr, std::align_val_t{kPageAlign});
+        }
+    } // namespace
+
+    MemoryUpstream host_upstream() {
+        return {host_allocate, host_deallocate, "host"};
+    }
+
+    PoolBlock::PoolBlock(PoolBlock &&other) noexcept
+        : pool_(std::exchange(other.pool_, nullptr)), ptr_(std::exchange(other.ptr_, nullptr)),
+          bytes_(std::exchange(other.bytes_, 0)) {}
+
+    PoolBlock &PoolBlock::operator=(PoolBlock &&other) noexcept {
+        if (this != &other) {
+            reset();
+            pool_  = std::exchange(other.pool_, nullptr);
+            ptr_   = std::exchange(other.ptr_, nullptr);
+            bytes_ = std::exchange(other.bytes_, 0);
+        }
+        return *this;
+    }
+
+    PoolBlock::~PoolBlock() {
+        reset();
+    }
+
+    void PoolBlock::reset() {
+        if (pool_ != nullptr && ptr_ != nullptr) {
+            pool_->release(ptr_, bytes_);
+        }
+        pool_  = nullptr;
+        ptr_   = nullptr;
+        bytes_ = 0;
+    }
+
+    CachingMemoryPool::CachingMemoryPool(MemoryUpstream upstream) : upstream_(upstream) {}
+
+    CachingMemoryPool::~CachingMemoryPool() {
+        trim();
+    }
+
+    std::size_t CachingMemoryPool::size_class(std::size_t bytes) {
+        if (bytes <= kMinClass) {
+            return kMinClass;
+        }
+        if (bytes <= kMiB) {
+            std::size_t c = kMinClass;
+            while (c < bytes) {
+                c <<= 1;
+            }
+            return c;
+        }
+        return (bytes + kMiB - 1) / kMiB * kMiB;
+    }
+
+    PoolBlock CachingMemoryPool::acquire(std::size_t bytes) {
+        if (bytes == 0) {
+            return {};
+        }
+        const std::size_t cls = size_class(bytes);
+        {
+            std::lock_guard lock(mutex_);
+            ++stats_.requests;
+            if (metrics_.requests != nullptr) {
+                metrics_.requests->add();
+            }
+            auto it = free_.find(cls);
+            if (it != free_.end() && !it->second.empty()) {
+                void *ptr = it->second.back();
+                it->second.pop_back();
+                ++stats_.hits;
+                stats_.bytes_cached -= cls;
+                stats_.bytes_in_use += cls;
+                if (metrics_.hits != nullptr) {
+                    metrics_.hits->add();
+                }
+                update_gauges();
+                return PoolBlock(this, ptr, cls);
+            }
+        }
+        // Upstream allocation happens outside the lock; cudaMalloc can take milliseconds.
+        void *ptr = upstream_.allocate(cls);
+        if (ptr == nullptr) {
+            return {};
+        }
+        std::lock_guard lock(mutex_);
+        ++stats_.upstream_allocations;
+        stats_.upstream_bytes += cls;
+        stats_.bytes_in_use += cls;
+        if (metrics_.upstream_allocations != nullptr) {
+            metrics_.upstream_allocations->add();
+        }
+        update_gauges();
+        return PoolBlock(this, ptr, cls);
+    }
+
+    void CachingMemoryPool::release(void *ptr, std::size_t bytes) {
+        std::lock_guard lock(mutex_);
+        free_[bytes].push_back(ptr);
+        stats_.bytes_in_use -= bytes;
+        stats_.bytes_cached += bytes;
+        update_gauges();
+    }
+
+    void CachingMemoryPool::trim() {
+        std::map<std::size_t, std::vector<void *>> cached;
+        {
+            std::lock_guard lock(mutex_);
+            cached.swap(free_);
+            stats_.bytes_cached = 0;
+            update_gauges();
+        }
+        for (auto &[bytes, blocks] : cached) {
+            for (void *ptr : blocks) {
+                upstream_.deallocate(ptr, bytes);
+            }
+        }
+    }
+
+    MemoryPoolStats CachingMemoryPool::stats() const {
+        std::lock_guard lock(mutex_);
+        return stats_;
+    }
+
+    void CachingMemoryPool::bind_metrics(MetricsRegistry &registry, std::string_view prefix) {
+        const std::string base(prefix);
+        Metrics metrics{
+            .requests             = &registry.counter(base + "_requests_total"),
+            .hits                 = &registry.counter(base + "_hits_total"),
+            .upstream_allocations = &registry.counter(base + "_upstream_allocations_total"),
+            .bytes_in_use         = &registry.gauge(base + "_bytes_in_use"),
+            .bytes_cached         = &registry.gauge(base + "_bytes_cached"),
+        };
+        std::lock_guard lock(mutex_);
+        metrics_ = metrics;
+        update_gauges();
+    }
+
+    void CachingMemoryPool::update_gauges() {
+        if (metrics_.bytes_in_use != nullptr) {
+            metrics_.bytes_in_use->set(static_cast<std::int64_t>(stats_.bytes_in_use));
+            metrics_.bytes_cached->set(static_cast<std::int64_t>(stats_.bytes_cached));
+        }
+    }
+
+} // namespace platform
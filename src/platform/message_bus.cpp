@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <iostream>
 
+#include "platform/metrics.hpp"
+
 namespace platform {
 
 SubscriptionId MessageBus::subscribe(const std::string& topic, Subscriber cb) {
@@ -14,7 +16,9 @@ SubscriptionId MessageBus::subscribe(const std::string& topic, Subscriber cb) {
     std::unique_lock inner_lock(deadlock_mutex_);
     std::unique_lock lock(mutex_);
 #endif
-    subscribers_[topic].push_back({id, std::move(cb)});
+    auto& entry = subscribers_[topic];
+    entry.entries.push_back({id, std::move(cb)});
+    bind_topic_metrics(topic, entry);
     return id;
 }
 
@@ -25,10 +29,14 @@ void MessageBus::unsubscribe(SubscriptionId id) {
     std::unique_lock inner_lock(deadlock_mutex_);
     std::unique_lock lock(mutex_);
 #endif
-    for (auto& [topic, entries] : subscribers_) {
+    for (auto& [name, topic] : subscribers_) {
+        auto& entries = topic.entries;
         entries.erase(std::remove_if(entries.begin(), entries.end(),
                                      [id](const Entry& e) { return e.id == id; }),
                       entries.end());
+        if (topic.subscribers != nullptr) {
+            topic.subscribers->set(static_cast<std::int64_t>(entries.size()));
+        }
     }
 }
 
@@ -45,7 +53,12 @@ void MessageBus::publish(const Message& msg) const {
         return;
     }
 
-    for (const auto& entry : it->second) {
+    const auto& topic = it->second;
+    if (topic.published != nullptr) {
+        topic.published->add();
+        topic.deliveries->add(topic.entries.size());
+    }
+    for (const auto& entry : topic.entries) {
         entry.cb(msg);
     }
 }
@@ -64,7 +77,29 @@ std::size_t MessageBus::subscriber_count(const std::string& topic) const {
     if (it == subscribers_.end()) {
         return 0;
     }
-    return it->second.size();
+    return it->second.entries.size();
+}
+
+void MessageBus::bind_metrics(MetricsRegistry& registry, std::string_view prefix) {
+    std::unique_lock lock(mutex_);
+    metrics_ = &registry;
+    metrics_prefix_ = std::string(prefix);
+    for (auto& [name, topic] : subscribers_) {
+        bind_topic_metrics(name, topic);
+    }
+}
+
+void MessageBus::bind_topic_metrics(const std::string& name, Topic& topic) {
+    if (metrics_ == nullptr) {
+        return;
+    }
+    if (topic.published == nullptr) {
+        const std::string label = "{topic=\"" + name + "\"}";
+        topic.published = &metrics_->counter(metrics_prefix_ + "_published_total" + label);
+        topic.deliveries = &metrics_->counter(metrics_prefix_ + "_deliveries_total" + label);
+        topic.subscribers = &metrics_->gauge(metrics_prefix_ + "_subscribers" + label);
+    }
+    topic.subscribers->set(static_cast<std::int64_t>(topic.entries.size()));
 }
 
 // NOLINTNEXTLINE cppcoreguidelines-avoid-non-const-global-variables
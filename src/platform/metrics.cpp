@@ -0,0 +1,200 @@
+#include "platform/metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+namespace platform {
+
+    namespace {
+        struct ExportedQuantile {
+            std::string_view label;
+            double q;
+        };
+        constexpr std::array<ExportedQuantile, 4> kExportedQuantiles{{
+            {R"(quantile="0.5")", 0.5},
+            {R"(quantile="0.9")", 0.9},
+            {R"(quantile="0.99")", 0.99},
+            {R"(quantile="1")", 1.0},
+        }};
+
+        std::string_view base_name(std::string_view name) {
+            return name.substr(0, name.find('{'));
+        }
+
+        // Splices an extra label into an optional `{...}` suffix: foo{a="b"} + q -> foo{a="b",q}.
+        std::string with_label(std::string_view name, std::string_view suffix, std::string_view label) {
+            const auto brace = name.find('{');
+            std::string out(base_name(name));
+            out += suffix;
+            if (label.empty()) {
+                if (brace != std::string_view::npos) {
+                    out += name.substr(brace);
+                }
+                return out;
+            }
+            out += '{';
+            if (brace != std::string_view::npos) {
+                out += name.substr(brace + 1, name.size() - brace - 2);
+                out += ',';
+            }
+            out += label;
+            out += '}';
+            return out;
+        }
+
+        void write_type(std::ostream &os, std::set<std::string, std::less<>> &typed, std::string_view name,
+                        const char *type) {
+            const auto base = base_name(name);
+            if (typed.find(base) == typed.end()) {
+                os << "# TYPE " << base << ' ' << type << '\n';
+                typed.emplace(base);
+            }
+        }
+
+        template <class Sample> const Sample *find_sample(const std::vector<Sample> &samples, std::string_view name) {
+            auto it = std::find_if(samples.begin(), samples.end(), [name](const Sample &s) { return s.name == name; });
+            return it == samples.end() ? nullptr : &*it;
+        }
+
+        template <class T> T &find_or_create(std::mutex &mutex, auto &map, std::string_view name) {
+            std::lock_guard lock(mutex);
+            auto it = map.find(name);
+            if (it == map.end()) {
+                it = map.emplace(std::string(name), std::make_unique<T>()).first;
+            }
+            return *it->second;
+        }
+    } // namespace
+
+    HistogramSnapshot Histogram::snapshot() const {
+        HistogramSnapshot snap;
+        snap.buckets.resize(kBucketCount);
+        std::uint64_t count = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            snap.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+            count += snap.buckets[i];
+        }
+        // Derive count from the buckets so quantiles stay consistent with concurrent writers.
+        snap.count = count;
+        snap.sum   = sum_.load(std::memory_order_relaxed);
+        snap.max   = max_.load(std::memory_order_relaxed);
+        snap.min   = count == 0 ? 0 : std::min(min_.load(std::memory_order_relaxed), snap.max);
+        return snap;
+    }
+
+    std::uint64_t HistogramSnapshot::quantile(double q) const {
+        if (count == 0) {
+            return 0;
+        }
+        q                  = std::clamp(q, 0.0, 1.0);
+        const auto rank    = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count))));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < buckets.size(); ++i) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return std::clamp(Histogram::bucket_upper_bound(i), min, max);
+            }
+        }
+        return max;
+    }
+
+    const CounterSample *MetricsSnapshot::find_counter(std::string_view name) const {
+        return find_sample(counters, name);
+    }
+
+    const GaugeSample *MetricsSnapshot::find_gauge(std::string_view name) const {
+        return find_sample(gauges, name);
+    }
+
+    const HistogramSample *MetricsSnapshot::find_histogram(std::string_view name) const {
+        return find_sample(histograms, name);
+    }
+
+    double counter_rate(const MetricsSnapshot &before, const MetricsSnapshot &after, std::string_view name) {
+        const auto *a = before.find_counter(name);
+        const auto *b = after.find_counter(name);
+        const std::chrono::duration<double> elapsed = after.taken_at - before.taken_at;
+        if (a == nullptr || b == nullptr || elapsed.count() <= 0.0 || b->value < a->value) {
+            return 0.0;
+        }
+        return static_cast<double>(b->value - a->value) / elapsed.count();
+    }
+
+    Counter &MetricsRegistry::counter(std::string_view name) {
+        return find_or_create<Counter>(mutex_, counters_, name);
+    }
+
+    Gauge &MetricsRegistry::gauge(std::string_view name) {
+        return find_or_create<Gauge>(mutex_, gauges_, name);
+    }
+
+    Histogram &MetricsRegistry::histogram(std::string_view name) {
+        return find_or_create<Histogram>(mutex_, histograms_, name);
+    }
+
+    MetricsSnapshot MetricsRegistry::snapshot() const {
+        MetricsSnapshot snap;
+        std::lock_guard lock(mutex_);
+        snap.taken_at = std::chrono::steady_clock::now();
+        snap.counters.reserve(counters_.size());
+        for (const auto &[name, c] : counters_) {
+            snap.counters.push_back({name, c->value()});
+        }
+        snap.gauges.reserve(gauges_.size());
+        for (const auto &[name, g] : gauges_) {
+            snap.gauges.push_back({name, g->value()});
+        }
+        snap.histograms.reserve(histograms_.size());
+        for (const auto &[name, h] : histograms_) {
+            snap.histograms.push_back({name, h->snapshot()});
+        }
+        return snap;
+    }
+
+    void MetricsRegistry::write_text(std::ostream &os) const {
+        const auto snap = snapshot();
+        std::set<std::string, std::less<>> typed;
+        for (const auto &c : snap.counters) {
+            write_type(os, typed, c.name, "counter");
+            os << c.name << ' ' << c.value << '\n';
+        }
+        for (const auto &g : snap.gauges) {
+            write_type(os, typed, g.name, "gauge");
+            os << g.name << ' ' << g.value << '\n';
+        }
+        for (const auto &h : snap.histograms) {
+            write_type(os, typed, h.name, "summary");
+            for (const auto &[label, q] : kExportedQuantiles) {
+                os << with_label(h.name, "", label) << ' ' << h.data.quantile(q) << '\n';
+            }
+            os << with_label(h.name, "_sum", {}) << ' ' << h.data.sum << '\n';
+            os << with_label(h.name, "_count", {}) << ' ' << h.data.count << '\n';
+        }
+    }
+
+    std::string MetricsRegistry::render_text() const {
+        std::ostringstream os;
+        write_text(os);
+        return os.str();
+    }
+
+    bool MetricsRegistry::write_text_file(const std::string &path) const {
+        const std::string tmp = path + ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::trunc);
+            if (!out) {
+                return false;
+            }
+            write_text(out);
+            if (!out.flush()) {
+                return false;
+            }
+        }
+        return std::rename(tmp.c_str(), path.c_str()) == 0;
+    }
+
+} // namespace platform
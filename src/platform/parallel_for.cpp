@@ -0,0 +1,77 @@
+#include "platform/parallel_for.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "platform/cpu_features.hpp"
+
+namespace platform {
+
+    namespace {
+        constexpr std::size_t kPageElements = 1024;
+        // Below this a task is too short to amortise the queue hand-off.
+        constexpr std::size_t kMinChunkElements = 4096;
+
+        // Shared with helper jobs by shared_ptr: a helper that starts after the caller returned only
+        // touches this block and never dereferences `fn`.
+        struct ChunkState {
+            std::size_t chunks{0};
+            void (*invoke)(const void *, std::size_t){nullptr};
+            const void *fn{nullptr};
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> done{0};
+
+            void run() {
+                for (std::size_t c = next.fetch_add(1, std::memory_order_relaxed); c < chunks;
+                     c = next.fetch_add(1, std::memory_order_relaxed)) {
+                    invoke(fn, c);
+                    if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == chunks) {
+                        done.notify_all();
+                    }
+                }
+            }
+        };
+    } // namespace
+
+    std::size_t parallel_chunk_elements(std::size_t n, std::size_t participants, std::size_t bytes_per_element,
+                                        const ParallelOptions &options) {
+        if (options.chunk_elements != 0) {
+            return options.chunk_elements;
+        }
+        // Keep one task's working set within half of L2, but cut smaller when that would leave
+        // fewer than ~4 chunks per participant to balance load.
+        const std::size_t threads       = std::max<std::size_t>(participants, 1);
+        const std::size_t cache_chunk   = l2_cache_bytes() / 2 / std::max<std::size_t>(bytes_per_element, 1);
+        const std::size_t balance_chunk = (n + 4 * threads - 1) / (4 * threads);
+        const std::size_t chunk         = std::max(std::min(cache_chunk, balance_chunk), kMinChunkElements);
+        return chunk / kPageElements * kPageElements;
+    }
+
+    namespace detail {
+        void run_chunks(ThreadPool &pool, std::size_t chunks, void (*invoke)(const void *, std::size_t),
+                        const void *fn) {
+            auto state    = std::make_shared<ChunkState>();
+            state->chunks = chunks;
+            state->invoke = invoke;
+            state->fn     = fn;
+
+            // Never blocks for room: when every worker is itself in here, a blocking enqueue on a
+            // full queue would wait forever. Chunks no helper picks up are the caller's.
+            const std::size_t helpers = std::min(pool.thread_count(), chunks - 1);
+            for (std::size_t i = 0; i < helpers; ++i) {
+                if (!pool.try_enqueue([state]() { state->run(); })) {
+                    break;
+                }
+            }
+            state->run();
+            // Every chunk has been claimed by a running thread by now, so this only waits for work
+            // in flight.
+            for (std::size_t seen = state->done.load(std::memory_order_acquire); seen < chunks;
+                 seen = state->done.load(std::memory_order_acquire)) {
+                state->done.wait(seen, std::memory_order_acquire);
+            }
+        }
+    } // namespace detail
+
+} // namespace platform
@@ -0,0 +1,145 @@
+#include "platform/perf_counters.hpp"
+
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace platform {
+
+    namespace {
+        std::uint64_t sat_sub(std::uint64_t a, std::uint64_t b) {
+            return a > b ? a - b : 0;
+        }
+
+#ifdef __linux__
+        constexpr std::uint64_t kEventConfigs[] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES,
+        };
+
+        int open_event(std::uint64_t config, int group_fd) {
+            perf_event_attr attr{};
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.size           = sizeof(attr);
+            attr.config         = config;
+            // Only the leader starts disabled; members follow it via the group ioctls.
+            if (group_fd < 0) {
+                attr.disabled = 1;
+            }
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC));
+        }
+#endif
+    } // namespace
+
+    PerfSample operator-(const PerfSample &a, const PerfSample &b) {
+        return {
+            .cycles        = sat_sub(a.cycles, b.cycles),
+            .instructions  = sat_sub(a.instructions, b.instructions),
+            .cache_misses  = sat_sub(a.cache_misses, b.cache_misses),
+            .branch_misses = sat_sub(a.branch_misses, b.branch_misses),
+        };
+    }
+
+    PerfCounters::PerfCounters() {
+#ifdef __linux__
+        const int leader = open_event(kEventConfigs[0], -1);
+        if (leader < 0) {
+            reason_ = std::string("perf_event_open: ") + std::strerror(errno);
+            return;
+        }
+        fds_[0]  = leader;
+        slot_[0] = 0;
+        int next = 1;
+        // Members that the PMU cannot provide (common on VMs) are skipped, not fatal.
+        for (int i = 1; i < kEvents; ++i) {
+            fds_[i] = open_event(kEventConfigs[i], leader);
+            if (fds_[i] >= 0) {
+                slot_[i] = next++;
+            }
+        }
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        leader_fd_ = leader;
+#else
+        reason_ = "perf_event_open is only available on Linux";
+#endif
+    }
+
+    PerfCounters::~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    PerfSample PerfCounters::read() const {
+        PerfSample sample;
+#ifdef __linux__
+        if (leader_fd_ < 0) {
+            return sample;
+        }
+        // Layout for PERF_FORMAT_GROUP with both time fields: nr, enabled, running, values[nr].
+        std::uint64_t buf[3 + kEvents]{};
+        if (::read(leader_fd_, buf, sizeof(buf)) < static_cast<ssize_t>(3 * sizeof(std::uint64_t))) {
+            return sample;
+        }
+        const std::uint64_t enabled = buf[1];
+        const std::uint64_t running = buf[2];
+        auto value                  = [&](int event) -> std::uint64_t {
+            const int slot = slot_[event];
+            if (slot < 0 || static_cast<std::uint64_t>(slot) >= buf[0]) {
+                return 0;
+            }
+            const std::uint64_t raw = buf[3 + slot];
+            if (running == 0 || running >= enabled) {
+                return raw;
+            }
+            return static_cast<std::uint64_t>(static_cast<double>(raw) * static_cast<double>(enabled) /
+                                              static_cast<double>(running));
+        };
+        sample.cycles        = value(0);
+        sample.instructions  = value(1);
+        sample.cache_misses  = value(2);
+        sample.branch_misses = value(3);
+#endif
+        return sample;
+    }
+
+    PerfCounters &PerfCounters::this_thread() {
+        static thread_local PerfCounters counters;
+        return counters;
+    }
+
+    PerfMetrics PerfMetrics::bind(MetricsRegistry &registry, std::string_view prefix) {
+        const std::string base(prefix);
+        return {
+            .cycles        = &registry.counter(base + "_cycles_total"),
+            .instructions  = &registry.counter(base + "_instructions_total"),
+            .cache_misses  = &registry.counter(base + "_cache_misses_total"),
+            .branch_misses = &registry.counter(base + "_branch_misses_total"),
+        };
+    }
+
+    void PerfMetrics::add(const PerfSample &sample) const {
+        cycles->add(sample.cycles);
+        instructions->add(sample.instructions);
+        cache_misses->add(sample.cache_misses);
+        branch_misses->add(sample.branch_misses);
+    }
+
+} // namespace platform
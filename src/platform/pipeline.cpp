@@ -1,8 +1,15 @@
 #include "platform/pipeline.hpp"
 
+#include "platform/cpu_topology.hpp"
 #include "platform/logging.hpp"
+#include "platform/wire_format.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
 #include <random>
+#include <set>
 
 namespace platform {
 
@@ -12,79 +19,597 @@ namespace platform {
             static thread_local std::normal_distribution<double> dist{0.0, 0.05};
             return 1.0 + dist(rng);
         }
+
+        std::int64_t steady_ns(std::chrono::steady_clock::time_point t) {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+        }
+
+        std::optional<double> sensor_value(std::string_view payload) {
+            if (wire::is_binary(payload)) {
+                const auto view = wire::SensorSampleView::from(payload);
+                return view ? std::optional<double>(view->value()) : std::nullopt;
+            }
+            const auto text = wire::parse_sensor_text(payload);
+            return text ? std::optional<double>(text->value) : std::nullopt;
+        }
+
+        std::optional<double> command_effort(std::string_view payload) {
+            if (wire::is_binary(payload)) {
+                const auto view = wire::ControlCommandView::from(payload);
+                return view ? std::optional<double>(view->effort()) : std::nullopt;
+            }
+            return wire::parse_number(payload);
+        }
+
+        // Formats into a stack buffer, so the only allocation is the payload string itself. Text
+        // payloads do not bound the name, so longer ones are formatted into the string directly.
+        std::string sensor_text_payload(std::string_view name, double value) {
+            const std::size_t max_chars = name.size() + 1 + wire::kMaxNumberChars;
+            if (max_chars <= wire::kMaxSensorTextChars) {
+                char buf[wire::kMaxSensorTextChars];
+                return std::string(buf, wire::format_sensor_text(buf, name, value));
+            }
+            std::string payload(max_chars, '\0');
+            payload.resize(wire::format_sensor_text({payload.data(), payload.size()}, name, value));
+            return payload;
+        }
+
+        std::string number_text(double value) {
+            char buf[wire::kMaxNumberChars];
+            return std::string(buf, wire::format_number(buf, value));
+        }
+
+        bool batched(const StageConfig &config) {
+            return config.batch_size > 1;
+        }
+
+        std::size_t initial_pool_threads(const PipelineOptions &options) {
+            if (options.worker_threads != 0) {
+                return options.worker_threads;
+            }
+            return options.pool_scaling.max_threads > 0 ? 1 : std::thread::hardware_concurrency();
+        }
     } // namespace
 
-    Pipeline::Pipeline() : worker_pool_(std::thread::hardware_concurrency(), 256) {}
+    Pipeline::Pipeline(PipelineOptions options)
+        : options_(with_default_graph(std::move(options))),
+          sensor_to_actuator_ns_(metrics_.histogram("pipeline_sensor_to_actuator_ns")),
+          malformed_payloads_(metrics_.counter("pipeline_malformed_payloads_total")),
+          log_shed_(metrics_.counter("pipeline_log_shed_total")),
+          actuator_writes_(metrics_.counter("pipeline_actuator_writes_total")),
+          actuator_superseded_(metrics_.counter("pipeline_actuator_superseded_total")),
+          config_errors_(validate_pipeline_options(options_)) {
+        bus_.bind_metrics(metrics_, "bus");
+        if (!config_errors_.empty()) {
+            return;
+        }
+        worker_pool_ = std::make_unique<ThreadPool>(initial_pool_threads(options_), options_.queue_capacity,
+                                                    options_.pool, options_.pool_placement, options_.pool_scaling,
+                                                    options_.pool_wait);
+        worker_pool_->bind_metrics(metrics_, "pipeline_pool");
+        for (const auto &sensor : options_.sensors) {
+            sensor_samples_.push_back(
+                &metrics_.counter("pipeline_sensor_samples_total{sensor=\"" + sensor.name + "\"}"));
+        }
+        for (const auto &config : options_.stages) {
+            if (config.deadline > std::chrono::microseconds::zero() && !deadline_executor_) {
+                deadline_executor_ = std::make_unique<DeadlineExecutor>(DeadlineExecutorOptions{
+                    .threads = options_.deadline_workers, .capacity = options_.queue_capacity});
+                deadline_executor_->bind_metrics(metrics_, "pipeline_edf");
+            }
+            auto stage    = std::make_unique<Stage>();
+            stage->config = config;
+            stage->shed   = &metrics_.counter("pipeline_shed_total{stage=\"" + config.name + "\"}");
+            if (batched(config)) {
+                const auto prefix     = "pipeline_" + config.name;
+                stage->batch_limit    = std::max(options_.queue_capacity, config.batch_size);
+                stage->batch_sizes    = &metrics_.histogram(prefix + "_batch_size");
+                stage->batch_timeouts = &metrics_.counter(prefix + "_batch_timeouts_total");
+                stage->batch_dropped  = &metrics_.counter(prefix + "_batch_dropped_total");
+                stage->filling.reserve(stage->batch_limit);
+                stage->draining.reserve(stage->batch_limit);
+                stage->efforts.reserve(stage->batch_limit);
+            } else if (config.placement == StagePlacement::kDedicated) {
+                const std::size_t capacity =
+                    config.shed == ShedPolicy::kCoalesce ? 1 : std::max<std::size_t>(options_.queue_capacity, 1);
+                stage->inbox               = std::make_unique<BoundedQueue<Message>>(capacity, config.wait);
+                stage->inbox->bind_metrics(metrics_, "pipeline_" + config.name + "_inbox");
+            }
+            if (config.kind == StageKind::kFusion) {
+                Stage *raw       = stage.get();
+                stage->fused     = &metrics_.counter("pipeline_" + config.name + "_fused_total");
+                stage->unmatched = &metrics_.counter("pipeline_" + config.name + "_unmatched_total");
+                const SyncOptions sync{.tolerance = config.tolerance, .capacity = config.buffer_capacity};
+                stage->sync = std::make_unique<TopicSynchronizer>(
+                    config.input_topics.size(), sync,
+                    [this, raw](std::span<const StampedValue> tuple) { publish_fused(*raw, tuple); });
+            }
+            stages_.push_back(std::move(stage));
+        }
+    }
 
     Pipeline::~Pipeline() {
         stop();
     }
 
-    void Pipeline::start() {
-        if (running_.exchange(true)) {
-            return;
+    void Pipeline::enable_perf_sampling() {
+        for (auto &stage : stages_) {
+            stage->perf = PerfMetrics::bind(metrics_, "pipeline_" + stage->config.name);
+        }
+        perf_sampling_.store(true, std::memory_order_release);
+    }
+
+    bool Pipeline::start() {
+        if (running_.load()) {
+            return true;
+        }
+        if (!config_errors_.empty()) {
+            for (const auto &error : config_errors_) {
+                LOG_ERROR("Pipeline config: " + error);
+            }
+            return false;
         }
-        start_perception();
-        start_control();
+        running_ = true;
+        start_actuator();
+        start_stages();
         start_io();
-        start_sensor();
+        start_sensors();
+        return true;
     }
 
     void Pipeline::stop() {
         if (!running_.exchange(false)) {
             return;
         }
-        sensor_scheduler_.stop();
-        worker_pool_.shutdown();
-    }
-
-    void Pipeline::start_sensor() {
-        sensor_scheduler_.start(std::chrono::milliseconds(50), [this]() {
-            SensorSample sample{
-                .name      = "imu",
-                .value     = noisy_read(),
-                .timestamp = std::chrono::steady_clock::now(),
-            };
-            Message msg{.topic     = "sensor.raw",
-                        .payload   = sample.name + ":" + std::to_string(sample.value),
-                        .timestamp = sample.timestamp};
-            bus_.publish(msg);
+        if (sensor_thread_.joinable()) {
+            sensor_thread_.request_stop();
+            sensor_thread_.join();
+        }
+        worker_pool_->shutdown();
+        if (deadline_executor_) {
+            deadline_executor_->shutdown();
+        }
+        for (auto &stage : stages_) {
+            if (stage->inbox) {
+                stage->inbox->close();
+            }
+            if (stage->thread.joinable()) {
+                stage->thread.request_stop();
+                stage->thread.join();
+            }
+        }
+        if (actuator_thread_.joinable()) {
+            actuator_thread_.request_stop();
+            actuator_thread_.join();
+        }
+    }
+
+    void Pipeline::start_sensors() {
+        sensor_thread_ = std::jthread([this](std::stop_token st) {
+            name_current_thread("pipe-sensors");
+            run_sensors(st);
         });
     }
 
-    void Pipeline::start_perception() {
-        bus_.subscribe("sensor.raw", [this](const Message &msg) {
-            worker_pool_.enqueue([this, msg]() {
-                // Parse payload and create processed value.
-                ControlCommand cmd{
-                    .effort    = std::stod(msg.payload.substr(msg.payload.find(':') + 1)) * 0.5,
-                    .timestamp = std::chrono::steady_clock::now(),
+    // One thread drives every sensor: it sleeps until the earliest deadline, publishes each due
+    // sensor, and advances its deadline by one period (like Scheduler, a late sample does not
+    // shift the schedule).
+    void Pipeline::run_sensors(std::stop_token st) {
+        using Clock = std::chrono::steady_clock;
+        const auto &sensors = options_.sensors;
+        std::vector<Clock::time_point> due(sensors.size(), Clock::now());
+        std::vector<std::uint32_t> sequence(sensors.size(), 0);
+        std::mutex mutex;
+        std::condition_variable_any wake;
+        while (!st.stop_requested()) {
+            const auto now = Clock::now();
+            for (std::size_t i = 0; i < sensors.size(); ++i) {
+                if (due[i] > now) {
+                    continue;
+                }
+                due[i] += sensors[i].period;
+                SensorSample sample{
+                    .name      = sensors[i].name,
+                    .value     = noisy_read(),
+                    .timestamp = Clock::now(),
                 };
+                Message msg{.topic     = sensors[i].topic,
+                            .payload   = options_.payload_format == PayloadFormat::kBinary
+                                             ? wire::sensor_sample_payload(sample.name, sample.value,
+                                                                           steady_ns(sample.timestamp), sequence[i]++)
+                                             : sensor_text_payload(sample.name, sample.value),
+                            .timestamp = sample.timestamp};
+                bus_.publish(msg);
+                sensor_samples_[i]->add();
+            }
+            std::unique_lock lock(mutex);
+            wake.wait_until(lock, st, *std::min_element(due.begin(), due.end()), [] { return false; });
+        }
+    }
+
+    void Pipeline::start_stages() {
+        for (auto &owned : stages_) {
+            Stage &stage = *owned;
+            if (batched(stage.config)) {
+                stage.thread = std::jthread([this, &stage](std::stop_token st) {
+                    name_current_thread("pipe-" + stage.config.name);
+                    run_batches(stage, st);
+                });
+                for (const auto &topic : stage.config.input_topics) {
+                    bus_.subscribe(topic, [this, &stage](const Message &msg) { collect(stage, msg); });
+                }
+                continue;
+            }
+            if (stage.config.placement == StagePlacement::kDedicated) {
+                stage.thread = std::jthread([this, &stage]() {
+                    name_current_thread("pipe-" + stage.config.name);
+                    while (auto msg = stage.inbox->pop()) {
+                        handle(stage, *msg);
+                    }
+                });
+            }
+            for (const auto &topic : stage.config.input_topics) {
+                switch (stage.config.placement) {
+                    case StagePlacement::kInline:
+                        bus_.subscribe(topic, [this, &stage](const Message &msg) { handle(stage, msg); });
+                        break;
+                    case StagePlacement::kPool:
+                        bus_.subscribe(topic, [this, &stage](const Message &msg) { offer_to_pool(stage, msg); });
+                        break;
+                    case StagePlacement::kDedicated:
+                        bus_.subscribe(topic, [this, &stage](const Message &msg) { offer_to_inbox(stage, msg); });
+                        break;
+                }
+            }
+        }
+    }
+
+    void Pipeline::offer_to_pool(Stage &stage, const Message &msg) {
+        if (stage.config.deadline > std::chrono::microseconds::zero()) {
+            offer_to_deadline(stage, msg);
+            return;
+        }
+        switch (stage.config.shed) {
+            case ShedPolicy::kBlock:
+                worker_pool_->enqueue([this, &stage, msg]() { handle(stage, msg); }, stage.config.priority);
+                return;
+            case ShedPolicy::kCoalesce:
+                coalesce(stage, msg);
+                return;
+            case ShedPolicy::kDropNewest:
+            case ShedPolicy::kDropOldest: // rejected by validation
+                if (!worker_pool_->try_enqueue([this, &stage, msg]() { handle(stage, msg); }, stage.config.priority)) {
+                    stage.shed->add();
+                }
+                return;
+        }
+    }
+
+    // The deadline runs from the sensor timestamp the message carries, so time already spent
+    // upstream counts against it.
+    void Pipeline::offer_to_deadline(Stage &stage, const Message &msg) {
+        const auto deadline = msg.timestamp + stage.config.deadline;
+        if (!deadline_executor_->submit(deadline, [this, &stage, msg]() { handle(stage, msg); }, stage.config.late)) {
+            stage.shed->add();
+        }
+    }
+
+    void Pipeline::offer_to_inbox(Stage &stage, const Message &msg) {
+        bool evicted = false;
+        switch (stage.config.shed) {
+            case ShedPolicy::kBlock:
+                stage.inbox->push(msg);
+                return;
+            case ShedPolicy::kDropNewest:
+                if (!stage.inbox->try_push(Message(msg))) {
+                    stage.shed->add();
+                }
+                return;
+            case ShedPolicy::kDropOldest:
+            case ShedPolicy::kCoalesce: // an inbox of one
+                stage.inbox->push_evict_oldest(Message(msg), evicted);
+                if (evicted) {
+                    stage.shed->add();
+                }
+                return;
+        }
+    }
+
+    // Replaces any message still waiting for this stage and queues at most one pool job to handle
+    // the newest. If the pool refuses the job, the message stays pending for the next arrival to
+    // retry or replace.
+    void Pipeline::coalesce(Stage &stage, const Message &msg) {
+        {
+            std::lock_guard lock(stage.pending_mutex);
+            if (stage.pending) {
+                stage.shed->add();
+            }
+            stage.pending = msg;
+            if (stage.drain_queued) {
+                return;
+            }
+            stage.drain_queued = true;
+        }
+        const bool queued = worker_pool_->try_enqueue(
+            [this, &stage]() {
+                std::optional<Message> next;
+                {
+                    std::lock_guard lock(stage.pending_mutex);
+                    next.swap(stage.pending);
+                    stage.drain_queued = false;
+                }
+                if (next) {
+                    handle(stage, *next);
+                }
+            },
+            stage.config.priority);
+        if (!queued) {
+            std::lock_guard lock(stage.pending_mutex);
+            stage.drain_queued = false;
+        }
+    }
+
+    void Pipeline::handle(Stage &stage, const Message &msg) {
+        std::optional<PerfScope> perf;
+        if (perf_sampling_.load(std::memory_order_acquire)) {
+            perf.emplace(&stage.perf);
+        }
+        switch (stage.config.kind) {
+            case StageKind::kPerception:
+                perceive(stage, msg);
+                break;
+            case StageKind::kControl:
+                actuate(msg);
+                break;
+            case StageKind::kFusion:
+                fuse(stage, msg);
+                break;
+        }
+    }
+
+    void Pipeline::perceive(const Stage &stage, const Message &msg) {
+        // Decode either payload format in place and create processed value.
+        const auto value = sensor_value(msg.payload);
+        if (!value) {
+            malformed_payloads_.add();
+            return;
+        }
+        ControlCommand cmd{
+            .effort    = *value * stage.config.gain,
+            .timestamp = std::chrono::steady_clock::now(),
+        };
 #ifdef PLATFORM_FAILURE_UAF
-                double *scratch = new double(cmd.effort);
-                delete scratch;         // Intentional UAF: cmd.effort still references freed memory in trace below.
-                cmd.effort += *scratch; // NOLINT
+        double *scratch = new double(cmd.effort);
+        delete scratch;         // Intentional UAF: cmd.effort still references freed memory in trace below.
+        cmd.effort += *scratch; // NOLINT
 #endif
 
-                Message out{.topic = "control.cmd", .payload = std::to_string(cmd.effort), .timestamp = cmd.timestamp};
-                bus_.publish(out);
-                processed_samples_.fetch_add(1, std::memory_order_relaxed);
+        // The command keeps the originating sample time so downstream stages can measure
+        // end-to-end latency and deadlines.
+        Message out{.topic     = stage.config.output_topic,
+                    .payload   = options_.payload_format == PayloadFormat::kBinary
+                                     ? wire::control_command_payload(cmd.effort, steady_ns(msg.timestamp))
+                                     : number_text(cmd.effort),
+                    .timestamp = msg.timestamp};
+        bus_.publish(out);
+        processed_samples_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Runs on the publishing thread: decode straight into the batch, so no Message is copied or
+    // queued per sample.
+    void Pipeline::collect(Stage &stage, const Message &msg) {
+        const auto value = sensor_value(msg.payload);
+        if (!value) {
+            malformed_payloads_.add();
+            return;
+        }
+        std::size_t pending = 0;
+        {
+            std::lock_guard lock(stage.batch_mutex);
+            SampleBatch &batch = stage.filling;
+            if (batch.size() == stage.batch_limit) {
+                stage.batch_dropped->add();
+                return;
+            }
+            if (batch.size() == 0) {
+                stage.first_arrival = std::chrono::steady_clock::now();
+            }
+            batch.timestamps_ns.push_back(steady_ns(msg.timestamp));
+            batch.values.push_back(*value);
+            pending = batch.size();
+        }
+        // Wake the stage thread only to arm the flush timer or to take a full batch.
+        if (pending == 1 || pending == stage.config.batch_size) {
+            stage.batch_ready.notify_one();
+        }
+    }
+
+    // Takes the buffered samples once batch_size have arrived or the oldest has waited
+    // batch_flush. On stop it drains whatever is left before returning.
+    void Pipeline::run_batches(Stage &stage, std::stop_token st) {
+        const auto &config = stage.config;
+        std::unique_lock lock(stage.batch_mutex);
+        while (true) {
+            const std::size_t pending = stage.filling.size();
+            const bool stopping       = st.stop_requested();
+            if (pending == 0) {
+                if (stopping) {
+                    break;
+                }
+                stage.batch_ready.wait(lock, st, [&stage] { return stage.filling.size() > 0; });
+                continue;
+            }
+            if (pending < config.batch_size && !stopping) {
+                const auto deadline = stage.first_arrival + config.batch_flush;
+                if (std::chrono::steady_clock::now() < deadline) {
+                    stage.batch_ready.wait_until(lock, st, deadline,
+                                                 [&] { return stage.filling.size() >= config.batch_size; });
+                    continue;
+                }
+                stage.batch_timeouts->add();
+            }
+            std::swap(stage.filling, stage.draining);
+            lock.unlock();
+            perceive_batch(stage);
+            stage.draining.clear();
+            lock.lock();
+        }
+    }
+
+    void Pipeline::perceive_batch(Stage &stage) {
+        std::optional<PerfScope> perf;
+        if (perf_sampling_.load(std::memory_order_acquire)) {
+            perf.emplace(&stage.perf);
+        }
+        const SampleBatch &batch = stage.draining;
+        const std::size_t count  = batch.size();
+        stage.efforts.resize(count);
+        const double gain    = stage.config.gain;
+        const double *values = batch.values.data();
+        double *efforts      = stage.efforts.data();
+        for (std::size_t i = 0; i < count; ++i) {
+            efforts[i] = values[i] * gain;
+        }
+
+        // One Message is reused, so after the first batch its payload buffer no longer allocates.
+        Message out{.topic = stage.config.output_topic, .payload = {}, .timestamp = {}};
+        char buf[std::max(sizeof(wire::ControlCommandRecord), wire::kMaxNumberChars)];
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::int64_t source_ns = batch.timestamps_ns[i];
+            const std::size_t len        = options_.payload_format == PayloadFormat::kBinary
+                                               ? wire::encode_control_command(buf, efforts[i], source_ns)
+                                               : wire::format_number(buf, efforts[i]);
+            out.payload.assign(buf, len);
+            out.timestamp = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(source_ns));
+            bus_.publish(out);
+        }
+        processed_samples_.fetch_add(count, std::memory_order_relaxed);
+        stage.batch_sizes->record(static_cast<std::uint64_t>(count));
+    }
+
+    void Pipeline::actuate(const Message &msg) {
+        const auto effort = command_effort(msg.payload);
+        if (!effort) {
+            malformed_payloads_.add();
+            return;
+        }
+        if (options_.actuator_period <= std::chrono::microseconds::zero()) {
+            // Simulated actuator write.
+            (void)*effort;
+            sensor_to_actuator_ns_.record(std::chrono::steady_clock::now() - msg.timestamp);
+            return;
+        }
+        const std::int64_t source_ns = steady_ns(msg.timestamp);
+        std::lock_guard lock(actuator_write_mutex_);
+        // A command derived from an older sample than the one already handed over is stale.
+        if (source_ns < actuator_newest_ns_) {
+            actuator_superseded_.add();
+            return;
+        }
+        actuator_newest_ns_ = source_ns;
+        if (!actuator_command_.write({.effort = *effort, .source_ns = source_ns})) {
+            actuator_superseded_.add();
+        }
+    }
+
+    void Pipeline::start_actuator() {
+        if (options_.actuator_period > std::chrono::microseconds::zero()) {
+            actuator_thread_ = std::jthread([this](std::stop_token st) {
+                name_current_thread("pipe-actuator");
+                run_actuator(st);
             });
-        });
+        }
     }
 
-    void Pipeline::start_control() {
-        bus_.subscribe("control.cmd", [this](const Message &msg) {
-            worker_pool_.enqueue([msg]() {
-                double effort = std::stod(msg.payload);
+    // Fixed-rate actuator loop: each tick applies the newest command if control produced one
+    // since the last tick, and otherwise holds the previous output.
+    void Pipeline::run_actuator(std::stop_token st) {
+        using Clock = std::chrono::steady_clock;
+        auto due    = Clock::now();
+        std::mutex mutex;
+        std::condition_variable_any wake;
+        while (!st.stop_requested()) {
+            if (actuator_command_.fetch()) {
+                const ActuatorCommand &cmd = actuator_command_.current();
                 // Simulated actuator write.
-                (void)effort;
-            });
-        });
+                (void)cmd.effort;
+                const Clock::time_point source{std::chrono::nanoseconds(cmd.source_ns)};
+                sensor_to_actuator_ns_.record(Clock::now() - source);
+                actuator_writes_.add();
+            }
+            due += options_.actuator_period;
+            std::unique_lock lock(mutex);
+            wake.wait_until(lock, st, due, [] { return false; });
+        }
+    }
+
+    void Pipeline::fuse(Stage &stage, const Message &msg) {
+        const auto value   = sensor_value(msg.payload);
+        const auto &inputs = stage.config.input_topics;
+        const auto topic   = std::find(inputs.begin(), inputs.end(), msg.topic);
+        if (!value || topic == inputs.end()) {
+            malformed_payloads_.add();
+            return;
+        }
+        std::lock_guard lock(stage.fusion_mutex);
+        const SyncStats before = stage.sync->stats();
+        stage.sync->push(static_cast<std::size_t>(topic - inputs.begin()), {steady_ns(msg.timestamp), *value});
+        const SyncStats &after = stage.sync->stats();
+        if (const auto dropped = (after.overflowed - before.overflowed) + (after.out_of_order - before.out_of_order);
+            dropped > 0) {
+            stage.unmatched->add(dropped);
+        }
+    }
+
+    // Runs inside TopicSynchronizer::push, under the stage's fusion mutex.
+    void Pipeline::publish_fused(Stage &stage, std::span<const StampedValue> tuple) {
+        double sum             = 0.0;
+        std::int64_t oldest_ns = tuple.front().timestamp_ns;
+        for (const auto &sample : tuple) {
+            sum += sample.value;
+            oldest_ns = std::min(oldest_ns, sample.timestamp_ns);
+        }
+        const double value = sum / static_cast<double>(tuple.size());
+        const auto &name   = stage.config.name;
+        Message out{.topic     = stage.config.output_topic,
+                    .payload   = options_.payload_format == PayloadFormat::kBinary
+                                     ? wire::sensor_sample_payload(name, value, oldest_ns, stage.fused_sequence++)
+                                     : sensor_text_payload(name, value),
+                    .timestamp = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(oldest_ns))};
+        stage.fused->add();
+        bus_.publish(out);
     }
 
     void Pipeline::start_io() {
-        bus_.subscribe("control.cmd", [](const Message &msg) { LOG_INFO("Actuator command: " + msg.payload); });
+        std::set<std::string> topics;
+        for (const auto &stage : stages_) {
+            if (stage->config.kind != StageKind::kControl) {
+                continue;
+            }
+            for (const auto &topic : stage->config.input_topics) {
+                if (!topics.insert(topic).second) {
+                    continue;
+                }
+                // Logging is the first work shed under load.
+                bus_.subscribe(topic, [this](const Message &msg) {
+                    if (!log_enabled(LogLevel::kInfo)) {
+                        return;
+                    }
+                    const bool queued = worker_pool_->try_enqueue(
+                        [payload = msg.payload]() {
+                            if (!wire::is_binary(payload)) {
+                                LOG_INFO("Actuator command: " + payload);
+                            } else if (const auto effort = command_effort(payload)) {
+                                LOG_INFO("Actuator command: " + number_text(*effort));
+                            }
+                        },
+                        JobPriority::kLow);
+                    if (!queued) {
+                        log_shed_.add();
+                    }
+                });
+            }
+        }
     }
 
 } // namespace platform
@@ -0,0 +1,573 @@
+#include "platform/pipeline_config.hpp"
+
+#include "platform/cpu_topology.hpp"
+#include "platform/wire_format.hpp"
+
+#include <charconv>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <system_error>
+
+namespace platform {
+
+    namespace {
+        std::string_view trim(std::string_view s) {
+            const auto first = s.find_first_not_of(" \t\r");
+            if (first == std::string_view::npos) {
+                return {};
+            }
+            const auto last = s.find_last_not_of(" \t\r");
+            return s.substr(first, last - first + 1);
+        }
+
+        std::vector<std::string_view> split_words(std::string_view s) {
+            std::vector<std::string_view> words;
+            while (!(s = trim(s)).empty()) {
+                const auto end = s.find_first_of(" \t");
+                words.push_back(s.substr(0, end));
+                s = end == std::string_view::npos ? std::string_view{} : s.substr(end);
+            }
+            return words;
+        }
+
+        template <class T> bool parse_integer(std::string_view text, T &out) {
+            const auto result = std::from_chars(text.data(), text.data() + text.size(), out);
+            return result.ec == std::errc{} && result.ptr == text.data() + text.size();
+        }
+
+        std::optional<StagePlacement> parse_placement(std::string_view text) {
+            for (const auto placement : {StagePlacement::kInline, StagePlacement::kPool, StagePlacement::kDedicated}) {
+                if (text == to_string(placement)) {
+                    return placement;
+                }
+            }
+            return std::nullopt;
+        }
+
+        std::optional<ShedPolicy> parse_shed(std::string_view text) {
+            for (const auto policy :
+                 {ShedPolicy::kBlock, ShedPolicy::kDropNewest, ShedPolicy::kDropOldest, ShedPolicy::kCoalesce}) {
+                if (text == to_string(policy)) {
+                    return policy;
+                }
+            }
+            return std::nullopt;
+        }
+
+        std::optional<JobPriority> parse_priority(std::string_view text) {
+            if (text == "low") {
+                return JobPriority::kLow;
+            }
+            if (text == "normal") {
+                return JobPriority::kNormal;
+            }
+            if (text == "high") {
+                return JobPriority::kHigh;
+            }
+            return std::nullopt;
+        }
+
+        std::optional<StageKind> parse_kind(std::string_view text) {
+            if (text == "perception") {
+                return StageKind::kPerception;
+            }
+            if (text == "control") {
+                return StageKind::kControl;
+            }
+            if (text == "fusion") {
+                return StageKind::kFusion;
+            }
+            return std::nullopt;
+        }
+
+        // Applies one `key=value` attribute of a sensor line; returns an error message or empty.
+        std::string apply(SensorConfig &sensor, std::string_view key, std::string_view value) {
+            if (key == "period_ms") {
+                std::int64_t ms = 0;
+                if (!parse_integer(value, ms)) {
+                    return "bad period_ms '" + std::string(value) + "'";
+                }
+                sensor.period = std::chrono::milliseconds(ms);
+            } else if (key == "topic") {
+                sensor.topic = std::string(value);
+            } else {
+                return "unknown sensor key '" + std::string(key) + "'";
+            }
+            return {};
+        }
+
+        std::string apply(StageConfig &stage, std::string_view key, std::string_view value) {
+            if (key == "kind") {
+                const auto kind = parse_kind(value);
+                if (!kind) {
+                    return "unknown stage kind '" + std::string(value) + "'";
+                }
+                stage.kind = *kind;
+            } else if (key == "in") {
+                stage.input_topics.clear();
+                while (!value.empty()) {
+                    const auto comma = value.find(',');
+                    stage.input_topics.emplace_back(value.substr(0, comma));
+                    value = comma == std::string_view::npos ? std::string_view{} : value.substr(comma + 1);
+                }
+            } else if (key == "out") {
+                stage.output_topic = std::string(value);
+            } else if (key == "placement") {
+                const auto placement = parse_placement(value);
+                if (!placement) {
+                    return "unknown placement '" + std::string(value) + "' (inline, pool or dedicated)";
+                }
+                stage.placement = *placement;
+            } else if (key == "shed") {
+                const auto shed = parse_shed(value);
+                if (!shed) {
+                    return "unknown shed policy '" + std::string(value) +
+                           "' (block, drop_newest, drop_oldest or coalesce)";
+                }
+                stage.shed = *shed;
+            } else if (key == "priority") {
+                const auto priority = parse_priority(value);
+                if (!priority) {
+                    return "unknown priority '" + std::string(value) + "' (low, normal or high)";
+                }
+                stage.priority = *priority;
+            } else if (key == "deadline_us") {
+                std::int64_t us = 0;
+                if (!parse_integer(value, us)) {
+                    return "bad deadline_us '" + std::string(value) + "'";
+                }
+                stage.deadline = std::chrono::microseconds(us);
+            } else if (key == "late") {
+                if (value == "drop") {
+                    stage.late = LatePolicy::kDrop;
+                } else if (value == "run") {
+                    stage.late = LatePolicy::kRun;
+                } else {
+                    return "unknown late policy '" + std::string(value) + "' (drop or run)";
+                }
+            } else if (key == "gain") {
+                const auto gain = wire::parse_number(value);
+                if (!gain) {
+                    return "bad gain '" + std::string(value) + "'";
+                }
+                stage.gain = *gain;
+            } else if (key == "tolerance_ms") {
+                std::int64_t ms = 0;
+                if (!parse_integer(value, ms)) {
+                    return "bad tolerance_ms '" + std::string(value) + "'";
+                }
+                stage.tolerance = std::chrono::milliseconds(ms);
+            } else if (key == "buffer") {
+                if (!parse_integer(value, stage.buffer_capacity)) {
+                    return "bad buffer '" + std::string(value) + "'";
+                }
+            } else if (key == "batch") {
+                if (!parse_integer(value, stage.batch_size)) {
+                    return "bad batch '" + std::string(value) + "'";
+                }
+            } else if (key == "flush_us") {
+                std::int64_t us = 0;
+                if (!parse_integer(value, us)) {
+                    return "bad flush_us '" + std::string(value) + "'";
+                }
+                stage.batch_flush = std::chrono::microseconds(us);
+            } else if (key == "wait") {
+                const auto mode = parse_wait_mode(value);
+                if (!mode) {
+                    return "unknown wait '" + std::string(value) + "' (block, spin_park or spin)";
+                }
+                stage.wait.mode = *mode;
+            } else if (key == "spin_us") {
+                std::int64_t us = 0;
+                if (!parse_integer(value, us)) {
+                    return "bad spin_us '" + std::string(value) + "'";
+                }
+                stage.wait.spin = std::chrono::microseconds(us);
+            } else {
+                return "unknown stage key '" + std::string(key) + "'";
+            }
+            return {};
+        }
+
+        std::string apply(PipelineOptions &options, std::string_view key, std::string_view value) {
+            if (key == "worker_threads") {
+                if (!parse_integer(value, options.worker_threads)) {
+                    return "bad worker_threads '" + std::string(value) + "'";
+                }
+            } else if (key == "queue_capacity") {
+                if (!parse_integer(value, options.queue_capacity)) {
+                    return "bad queue_capacity '" + std::string(value) + "'";
+                }
+            } else if (key == "pool_lanes") {
+                if (value == "strict") {
+                    options.pool.selection = LaneSelection::kStrict;
+                } else if (value == "weighted") {
+                    options.pool.selection = LaneSelection::kWeighted;
+                } else {
+                    return "unknown pool_lanes '" + std::string(value) + "' (strict or weighted)";
+                }
+            } else if (key == "pool_aging_us") {
+                std::int64_t us = 0;
+                if (!parse_integer(value, us)) {
+                    return "bad pool_aging_us '" + std::string(value) + "'";
+                }
+                options.pool.aging = std::chrono::microseconds(us);
+            } else if (key == "pool_reserved_workers") {
+                if (!parse_integer(value, options.pool.reserved_workers)) {
+                    return "bad pool_reserved_workers '" + std::string(value) + "'";
+                }
+            } else if (key == "pool_pin") {
+                if (value == "none") {
+                    options.pool_placement.pin = PinPolicy::kNone;
+                } else if (value == "core") {
+                    options.pool_placement.pin = PinPolicy::kCore;
+                } else if (value == "node") {
+                    options.pool_placement.pin = PinPolicy::kNode;
+                } else {
+                    return "unknown pool_pin '" + std::string(value) + "' (none, core or node)";
+                }
+            } else if (key == "pool_numa_groups") {
+                if (value != "on" && value != "off") {
+                    return "bad pool_numa_groups '" + std::string(value) + "' (on or off)";
+                }
+                options.pool_placement.numa_groups = value == "on";
+            } else if (key == "pool_exclude_cpus") {
+                auto cpus = parse_cpu_list(value);
+                if (!cpus) {
+                    return "bad pool_exclude_cpus '" + std::string(value) + "'";
+                }
+                options.pool_placement.exclude = std::move(*cpus);
+            } else if (key == "pool_max_threads") {
+                if (!parse_integer(value, options.pool_scaling.max_threads)) {
+                    return "bad pool_max_threads '" + std::string(value) + "'";
+                }
+            } else if (key == "pool_target_wait_us") {
+                std::int64_t us = 0;
+                if (!parse_integer(value, us)) {
+                    return "bad pool_target_wait_us '" + std::string(value) + "'";
+                }
+                options.pool_scaling.target_wait = std::chrono::microseconds(us);
+            } else if (key == "pool_idle_ms") {
+                std::int64_t ms = 0;
+                if (!parse_integer(value, ms)) {
+                    return "bad pool_idle_ms '" + std::string(value) + "'";
+                }
+                options.pool_scaling.idle_timeout = std::chrono::milliseconds(ms);
+            } else if (key == "pool_wait") {
+                const auto mode = parse_wait_mode(value);
+                if (!mode) {
+                    return "unknown pool_wait '" + std::string(value) + "' (block, spin_park or spin)";
+                }
+                options.pool_wait.mode = *mode;
+            } else if (key == "pool_spin_us") {
+                std::int64_t us = 0;
+                if (!parse_integer(value, us)) {
+                    return "bad pool_spin_us '" + std::string(value) + "'";
+                }
+                options.pool_wait.spin = std::chrono::microseconds(us);
+            } else if (key == "deadline_workers") {
+                if (!parse_integer(value, options.deadline_workers)) {
+                    return "bad deadline_workers '" + std::string(value) + "'";
+                }
+            } else if (key == "sensor_period_ms") {
+                std::int64_t ms = 0;
+                if (!parse_integer(value, ms)) {
+                    return "bad sensor_period_ms '" + std::string(value) + "'";
+                }
+                options.sensor_period = std::chrono::milliseconds(ms);
+            } else if (key == "payload_format") {
+                if (value == "text") {
+                    options.payload_format = PayloadFormat::kText;
+                } else if (value == "binary") {
+                    options.payload_format = PayloadFormat::kBinary;
+                } else {
+                    return "unknown payload_format '" + std::string(value) + "' (text or binary)";
+                }
+            } else if (key == "actuator_period_us") {
+                std::int64_t us = 0;
+                if (!parse_integer(value, us)) {
+                    return "bad actuator_period_us '" + std::string(value) + "'";
+                }
+                options.actuator_period = std::chrono::microseconds(us);
+            } else {
+                return "unknown key '" + std::string(key) + "'";
+            }
+            return {};
+        }
+
+        template <class Config>
+        std::string apply_attributes(Config &config, const std::vector<std::string_view> &words) {
+            for (std::size_t i = 2; i < words.size(); ++i) {
+                const auto eq = words[i].find('=');
+                if (eq == std::string_view::npos) {
+                    return "expected key=value, got '" + std::string(words[i]) + "'";
+                }
+                if (auto err = apply(config, words[i].substr(0, eq), words[i].substr(eq + 1)); !err.empty()) {
+                    return err;
+                }
+            }
+            return {};
+        }
+
+        // True when following publishing stages from `topic` can lead back to a topic on the
+        // current path; such a graph would republish forever.
+        bool has_cycle(const std::string &topic, const std::multimap<std::string, std::string> &edges,
+                       std::map<std::string, int> &state) {
+            int &mark = state[topic];
+            if (mark != 0) {
+                return mark == 1;
+            }
+            mark = 1;
+            for (auto [it, end] = edges.equal_range(topic); it != end; ++it) {
+                if (has_cycle(it->second, edges, state)) {
+                    return true;
+                }
+            }
+            state[topic] = 2;
+            return false;
+        }
+    } // namespace
+
+    const char *to_string(StagePlacement placement) {
+        switch (placement) {
+            case StagePlacement::kInline:
+                return "inline";
+            case StagePlacement::kPool:
+                return "pool";
+            case StagePlacement::kDedicated:
+                return "dedicated";
+        }
+        return "unknown";
+    }
+
+    const char *to_string(ShedPolicy policy) {
+        switch (policy) {
+            case ShedPolicy::kBlock:
+                return "block";
+            case ShedPolicy::kDropNewest:
+                return "drop_newest";
+            case ShedPolicy::kDropOldest:
+                return "drop_oldest";
+            case ShedPolicy::kCoalesce:
+                return "coalesce";
+        }
+        return "unknown";
+    }
+
+    PipelineOptions with_default_graph(PipelineOptions options) {
+        if (options.sensors.empty()) {
+            options.sensors.push_back({.name = "imu", .period = options.sensor_period});
+        }
+        if (options.stages.empty()) {
+            options.stages.push_back({.name         = "perception",
+                                      .kind         = StageKind::kPerception,
+                                      .input_topics = {"sensor.raw"},
+                                      .output_topic = "control.cmd",
+                                      .shed         = ShedPolicy::kDropNewest});
+            options.stages.push_back({.name         = "control",
+                                      .kind         = StageKind::kControl,
+                                      .input_topics = {"control.cmd"},
+                                      .shed         = ShedPolicy::kCoalesce,
+                                      .priority     = JobPriority::kHigh});
+        }
+        return options;
+    }
+
+    std::vector<std::string> validate_pipeline_options(const PipelineOptions &options) {
+        std::vector<std::string> errors;
+        if (options.queue_capacity == 0) {
+            errors.emplace_back("queue_capacity must be positive");
+        }
+        if (options.pool_scaling.max_threads > 0 &&
+            (options.pool_scaling.target_wait <= std::chrono::microseconds::zero() ||
+             options.pool_scaling.idle_timeout <= std::chrono::milliseconds::zero())) {
+            errors.emplace_back("pool_target_wait_us and pool_idle_ms must be positive");
+        }
+        if (options.pool_scaling.max_threads > 0 &&
+            options.pool_scaling.interval <= std::chrono::milliseconds::zero()) {
+            errors.emplace_back("the pool scaling interval must be positive");
+        }
+        if (options.pool.aging < std::chrono::microseconds::zero()) {
+            errors.emplace_back("pool_aging_us must not be negative");
+        }
+        if (options.pool_wait.spin < std::chrono::microseconds::zero()) {
+            errors.emplace_back("pool_spin_us must not be negative");
+        }
+        if (options.actuator_period < std::chrono::microseconds::zero()) {
+            errors.emplace_back("actuator_period_us must not be negative");
+        }
+        if (options.sensors.empty()) {
+            errors.emplace_back("no sensors configured");
+        }
+        // Sensors and fusion stages put their name into sensor sample payloads.
+        auto check_sample_name = [&](const std::string &label, const std::string &name) {
+            if (name.find(':') != std::string::npos) {
+                errors.push_back(label + ": ':' is the text payload separator");
+            }
+            if (options.payload_format == PayloadFormat::kBinary && name.size() > wire::kMaxNameLength) {
+                errors.push_back(label + ": binary payloads hold at most " + std::to_string(wire::kMaxNameLength) +
+                                 " name bytes");
+            }
+        };
+
+        std::set<std::string> produced;
+        std::set<std::string> sensor_names;
+        for (const auto &sensor : options.sensors) {
+            const std::string label = "sensor '" + sensor.name + "'";
+            if (sensor.name.empty()) {
+                errors.emplace_back("sensor with empty name");
+            } else if (!sensor_names.insert(sensor.name).second) {
+                errors.push_back("duplicate " + label);
+            }
+            if (sensor.period <= std::chrono::milliseconds::zero()) {
+                errors.push_back(label + ": period must be positive");
+            }
+            if (sensor.topic.empty()) {
+                errors.push_back(label + ": empty topic");
+            }
+            check_sample_name(label, sensor.name);
+            produced.insert(sensor.topic);
+        }
+
+        std::set<std::string> stage_names;
+        std::multimap<std::string, std::string> edges;
+        for (const auto &stage : options.stages) {
+            if (stage.kind != StageKind::kControl && !stage.output_topic.empty()) {
+                produced.insert(stage.output_topic);
+                for (const auto &input : stage.input_topics) {
+                    edges.emplace(input, stage.output_topic);
+                }
+            }
+        }
+        for (const auto &stage : options.stages) {
+            const std::string label = "stage '" + stage.name + "'";
+            if (stage.name.empty()) {
+                errors.emplace_back("stage with empty name");
+            } else if (!stage_names.insert(stage.name).second) {
+                errors.push_back("duplicate " + label);
+            }
+            if (stage.input_topics.empty()) {
+                errors.push_back(label + ": no input topics");
+            }
+            for (const auto &input : stage.input_topics) {
+                if (input.empty()) {
+                    errors.push_back(label + ": empty input topic");
+                } else if (produced.count(input) == 0) {
+                    errors.push_back(label + ": nothing publishes '" + input + "'");
+                }
+            }
+            if (stage.kind == StageKind::kControl) {
+                if (!stage.output_topic.empty()) {
+                    errors.push_back(label + ": control stages do not publish");
+                }
+            } else if (stage.output_topic.empty()) {
+                errors.push_back(label + ": needs an output topic");
+            }
+            if (stage.kind == StageKind::kFusion) {
+                const std::set<std::string> distinct(stage.input_topics.begin(), stage.input_topics.end());
+                if (distinct.size() < 2 || distinct.size() != stage.input_topics.size()) {
+                    errors.push_back(label + ": fusion needs at least two distinct input topics");
+                }
+                if (stage.tolerance <= std::chrono::milliseconds::zero() || stage.buffer_capacity == 0) {
+                    errors.push_back(label + ": tolerance and buffer must be positive");
+                }
+                check_sample_name(label, stage.name);
+            }
+            if (stage.placement == StagePlacement::kInline && stage.shed != ShedPolicy::kBlock) {
+                errors.push_back(label + ": inline stages run on the publisher and cannot shed");
+            } else if (stage.placement == StagePlacement::kPool && stage.shed == ShedPolicy::kDropOldest) {
+                errors.push_back(label + ": drop_oldest needs placement=dedicated");
+            }
+            if (stage.deadline < std::chrono::microseconds::zero()) {
+                errors.push_back(label + ": deadline_us must not be negative");
+            } else if (stage.deadline > std::chrono::microseconds::zero() &&
+                       (stage.placement != StagePlacement::kPool || stage.shed != ShedPolicy::kDropNewest)) {
+                errors.push_back(label + ": deadline_us needs placement=pool and shed=drop_newest");
+            } else if (stage.deadline > std::chrono::microseconds::zero() && options.deadline_workers == 0) {
+                errors.push_back(label + ": deadline_us needs deadline_workers > 0");
+            }
+            if (stage.batch_size == 0) {
+                errors.push_back(label + ": batch must be positive");
+            } else if (stage.batch_size > 1) {
+                if (stage.kind != StageKind::kPerception || stage.placement != StagePlacement::kDedicated) {
+                    errors.push_back(label + ": only dedicated perception stages batch");
+                }
+                if (stage.batch_flush <= std::chrono::microseconds::zero()) {
+                    errors.push_back(label + ": flush_us must be positive");
+                }
+            }
+            if (stage.wait.mode != WaitMode::kBlock &&
+                (stage.placement != StagePlacement::kDedicated || stage.batch_size > 1)) {
+                errors.push_back(label + ": wait needs placement=dedicated without batching");
+            }
+            if (stage.wait.spin < std::chrono::microseconds::zero()) {
+                errors.push_back(label + ": spin_us must not be negative");
+            }
+        }
+
+        std::map<std::string, int> state;
+        for (const auto &[input, output] : edges) {
+            if (has_cycle(input, edges, state)) {
+                errors.push_back("stages form a publishing cycle through '" + input + "'");
+                break;
+            }
+        }
+        return errors;
+    }
+
+    std::optional<PipelineOptions> parse_pipeline_config(std::string_view text, std::string &error) {
+        PipelineOptions options;
+        std::size_t line_no = 0;
+        while (!text.empty()) {
+            ++line_no;
+            const auto newline = text.find('\n');
+            std::string_view line = text.substr(0, newline);
+            text = newline == std::string_view::npos ? std::string_view{} : text.substr(newline + 1);
+            line = trim(line.substr(0, line.find('#')));
+            if (line.empty()) {
+                continue;
+            }
+
+            std::string err;
+            const auto words = split_words(line);
+            if (words[0] == "sensor" || words[0] == "stage") {
+                if (words.size() < 2 || words[1].find('=') != std::string_view::npos) {
+                    err = std::string(words[0]) + " needs a name";
+                } else if (words[0] == "sensor") {
+                    options.sensors.push_back({.name = std::string(words[1])});
+                    err = apply_attributes(options.sensors.back(), words);
+                } else {
+                    options.stages.push_back({.name = std::string(words[1])});
+                    err = apply_attributes(options.stages.back(), words);
+                }
+            } else if (const auto eq = line.find('='); eq != std::string_view::npos) {
+                err = apply(options, trim(line.substr(0, eq)), trim(line.substr(eq + 1)));
+            } else {
+                err = "expected 'key = value', 'sensor <name> ...' or 'stage <name> ...'";
+            }
+            if (!err.empty()) {
+                error = "line " + std::to_string(line_no) + ": " + err;
+                return std::nullopt;
+            }
+        }
+        return options;
+    }
+
+    std::optional<PipelineOptions> load_pipeline_config(const std::string &path, std::string &error) {
+        std::ifstream in(path);
+        if (!in) {
+            error = "cannot open " + path;
+            return std::nullopt;
+        }
+        std::ostringstream text;
+        text << in.rdbuf();
+        auto options = parse_pipeline_config(text.str(), error);
+        if (!options) {
+            error = path + ": " + error;
+        }
+        return options;
+    }
+
+} // namespace platform
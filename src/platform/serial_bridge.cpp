@@ -0,0 +1,367 @@
+#include "platform/serial_bridge.hpp"
+
+#include "platform/logging.hpp"
+#include "platform/metrics.hpp"
+
+#include <chrono>
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace platform {
+
+    namespace {
+        void add(std::atomic<std::uint64_t> &value, Counter *metric, std::uint64_t delta) {
+            value.fetch_add(delta, std::memory_order_relaxed);
+            if (metric != nullptr) {
+                metric->add(delta);
+            }
+        }
+
+#ifdef __linux__
+        std::optional<speed_t> baud_constant(int baud) {
+            switch (baud) {
+                case 9600:
+                    return B9600;
+                case 19200:
+                    return B19200;
+                case 38400:
+                    return B38400;
+                case 57600:
+                    return B57600;
+                case 115200:
+                    return B115200;
+                case 230400:
+                    return B230400;
+                case 460800:
+                    return B460800;
+                case 921600:
+                    return B921600;
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        bool make_raw(int fd, std::optional<speed_t> speed) {
+            termios tio{};
+            if (tcgetattr(fd, &tio) != 0) {
+                return false;
+            }
+            cfmakeraw(&tio);
+            tio.c_cflag |= CLOCAL | CREAD;
+            if (speed && (cfsetispeed(&tio, *speed) != 0 || cfsetospeed(&tio, *speed) != 0)) {
+                return false;
+            }
+            return tcsetattr(fd, TCSANOW, &tio) == 0;
+        }
+
+        constexpr std::uint64_t kWakeToken = 1;
+#endif
+    } // namespace
+
+    SerialPort::~SerialPort() {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    SerialPort::SerialPort(SerialPort &&other) noexcept
+        : fd_(std::exchange(other.fd_, -1)), name_(std::move(other.name_)) {}
+
+    SerialPort &SerialPort::operator=(SerialPort &&other) noexcept {
+        if (this != &other) {
+            SerialPort old(std::move(*this));
+            fd_   = std::exchange(other.fd_, -1);
+            name_ = std::move(other.name_);
+        }
+        return *this;
+    }
+
+    std::optional<SerialPort> SerialPort::open(const std::string &path, int baud) {
+#ifdef __linux__
+        const auto speed = baud_constant(baud);
+        if (!speed) {
+            return std::nullopt;
+        }
+        SerialPort port(::open(path.c_str(), O_RDWR | O_NOCTTY | O_CLOEXEC), path);
+        if (!port.is_open() || !make_raw(port.fd(), speed)) {
+            return std::nullopt;
+        }
+        return port;
+#else
+        (void)path;
+        (void)baud;
+        return std::nullopt;
+#endif
+    }
+
+    std::optional<std::pair<SerialPort, SerialPort>> SerialPort::open_pty_pair() {
+#ifdef __linux__
+        SerialPort master(posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC), "/dev/ptmx");
+        if (!master.is_open() || grantpt(master.fd()) != 0 || unlockpt(master.fd()) != 0) {
+            return std::nullopt;
+        }
+        char name[128];
+        if (ptsname_r(master.fd(), name, sizeof(name)) != 0) {
+            return std::nullopt;
+        }
+        SerialPort slave(::open(name, O_RDWR | O_NOCTTY | O_CLOEXEC), name);
+        if (!slave.is_open() || !make_raw(slave.fd(), std::nullopt)) {
+            return std::nullopt;
+        }
+        return std::make_pair(std::move(master), std::move(slave));
+#else
+        return std::nullopt;
+#endif
+    }
+
+    SerialBridge::SerialBridge(MessageBus &bus, SerialPort port, SerialBridgeOptions options)
+        : bus_(bus), port_(std::move(port)), options_(std::move(options)) {}
+
+    SerialBridge::~SerialBridge() {
+        stop();
+#ifdef __linux__
+        for (int fd : {epoll_fd_, wake_fd_}) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+#endif
+    }
+
+    void SerialBridge::bind_metrics(MetricsRegistry &registry, std::string_view prefix) {
+        const std::string base(prefix);
+        metrics_ = {
+            .frames_in     = &registry.counter(base + "_frames_in_total"),
+            .frames_out    = &registry.counter(base + "_frames_out_total"),
+            .bytes_in      = &registry.counter(base + "_bytes_in_total"),
+            .bytes_out     = &registry.counter(base + "_bytes_out_total"),
+            .decode_errors = &registry.counter(base + "_decode_errors_total"),
+            .dropped_out   = &registry.counter(base + "_dropped_out_total"),
+        };
+    }
+
+    SerialBridgeStats SerialBridge::stats() const {
+        return {
+            .frames_in     = counters_.frames_in.load(std::memory_order_relaxed),
+            .frames_out    = counters_.frames_out.load(std::memory_order_relaxed),
+            .bytes_in      = counters_.bytes_in.load(std::memory_order_relaxed),
+            .bytes_out     = counters_.bytes_out.load(std::memory_order_relaxed),
+            .decode_errors = counters_.decode_errors.load(std::memory_order_relaxed),
+            .dropped_out   = counters_.dropped_out.load(std::memory_order_relaxed),
+        };
+    }
+
+    bool SerialBridge::start() {
+#ifdef __linux__
+        if (thread_.joinable() || !port_.is_open()) {
+            return false;
+        }
+        const int flags = fcntl(port_.fd(), F_GETFL);
+        if (flags < 0 || fcntl(port_.fd(), F_SETFL, flags | O_NONBLOCK) != 0) {
+            return false;
+        }
+        if (epoll_fd_ < 0) {
+            epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+            wake_fd_  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (epoll_fd_ < 0 || wake_fd_ < 0) {
+                return false;
+            }
+            epoll_event port_event{.events = EPOLLIN, .data = {.fd = port_.fd()}};
+            epoll_event wake_event{.events = EPOLLIN, .data = {.fd = wake_fd_}};
+            if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, port_.fd(), &port_event) != 0 ||
+                epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &wake_event) != 0) {
+                return false;
+            }
+        }
+        read_buffer_.resize(options_.read_chunk);
+        subscription_ = bus_.subscribe(options_.outbound_topic,
+                                       [this](const Message &msg) { queue_outbound(msg.payload); });
+        thread_       = std::jthread([this](std::stop_token st) { run(st); });
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void SerialBridge::stop() {
+        if (!thread_.joinable()) {
+            return;
+        }
+        bus_.unsubscribe(subscription_);
+        thread_.request_stop();
+        wake();
+        thread_.join();
+    }
+
+    void SerialBridge::wake() const {
+#ifdef __linux__
+        if (wake_fd_ >= 0) {
+            [[maybe_unused]] const auto written = ::write(wake_fd_, &kWakeToken, sizeof(kWakeToken));
+        }
+#endif
+    }
+
+    void SerialBridge::queue_outbound(std::string_view payload) {
+        if (payload.size() > options_.max_payload) {
+            add(counters_.dropped_out, metrics_.dropped_out, 1);
+            return;
+        }
+        {
+            std::lock_guard lock(out_mutex_);
+            const std::size_t old_size = out_pending_.size();
+            if (old_size + serial::max_frame_size(payload.size()) > options_.max_pending_bytes) {
+                add(counters_.dropped_out, metrics_.dropped_out, 1);
+                return;
+            }
+            out_pending_.resize(old_size + serial::max_frame_size(payload.size()));
+            const std::size_t written =
+                serial::encode_frame(payload, std::span<char>(out_pending_).subspan(old_size));
+            out_pending_.resize(old_size + written);
+        }
+        add(counters_.frames_out, metrics_.frames_out, 1);
+        wake();
+    }
+
+    void SerialBridge::update_write_interest(bool want_write) {
+#ifdef __linux__
+        if (want_write == write_interest_) {
+            return;
+        }
+        const std::uint32_t events = want_write ? EPOLLIN | EPOLLOUT : EPOLLIN;
+        epoll_event event{.events = events, .data = {.fd = port_.fd()}};
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, port_.fd(), &event) == 0) {
+            write_interest_ = want_write;
+        }
+#else
+        (void)want_write;
+#endif
+    }
+
+    bool SerialBridge::flush_outbound() {
+#ifdef __linux__
+        for (;;) {
+            if (written_ == writing_.size()) {
+                writing_.clear();
+                written_ = 0;
+                std::lock_guard lock(out_mutex_);
+                writing_.swap(out_pending_);
+                if (writing_.empty()) {
+                    update_write_interest(false);
+                    return true;
+                }
+            }
+            const ssize_t n = ::write(port_.fd(), writing_.data() + written_, writing_.size() - written_);
+            if (n > 0) {
+                written_ += static_cast<std::size_t>(n);
+                add(counters_.bytes_out, metrics_.bytes_out, static_cast<std::uint64_t>(n));
+                continue;
+            }
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0 && errno == EAGAIN) {
+                // The port's transmit buffer is full; resume on EPOLLOUT.
+                update_write_interest(true);
+                return true;
+            }
+            return false;
+        }
+#else
+        return false;
+#endif
+    }
+
+    bool SerialBridge::read_port(serial::FrameDecoder &decoder, Message &message) {
+#ifdef __linux__
+        const ssize_t n = ::read(port_.fd(), read_buffer_.data(), read_buffer_.size());
+        if (n < 0) {
+            return errno == EAGAIN || errno == EINTR;
+        }
+        if (n == 0) {
+            return false;
+        }
+        add(counters_.bytes_in, metrics_.bytes_in, static_cast<std::uint64_t>(n));
+
+        // Every frame completed by this read shares one arrival timestamp and one Message, whose
+        // payload buffer is reused across the batch.
+        const serial::DecoderStats before = decoder.stats();
+        message.timestamp                 = std::chrono::steady_clock::now();
+        std::span<const char> input(read_buffer_.data(), static_cast<std::size_t>(n));
+        std::uint64_t frames = 0;
+        while (auto payload = decoder.next(input)) {
+            message.payload.assign(payload->data(), payload->size());
+            bus_.publish(message);
+            ++frames;
+        }
+        const serial::DecoderStats &after = decoder.stats();
+        const std::uint64_t errors        = (after.crc_errors - before.crc_errors) +
+                                     (after.framing_errors - before.framing_errors) +
+                                     (after.overruns - before.overruns);
+        if (frames > 0) {
+            add(counters_.frames_in, metrics_.frames_in, frames);
+        }
+        if (errors > 0) {
+            add(counters_.decode_errors, metrics_.decode_errors, errors);
+        }
+        return true;
+#else
+        (void)decoder;
+        (void)message;
+        return false;
+#endif
+    }
+
+    void SerialBridge::run(std::stop_token st) {
+#ifdef __linux__
+        serial::FrameDecoder decoder(options_.max_payload);
+        Message message;
+        message.topic = options_.inbound_topic;
+        epoll_event events[2];
+        while (!st.stop_requested()) {
+            const int ready = epoll_wait(epoll_fd_, events, 2, -1);
+            if (ready < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                LOG_WARN(std::string("serial bridge: epoll_wait: ") + std::strerror(errno));
+                return;
+            }
+            for (int i = 0; i < ready; ++i) {
+                const epoll_event &event = events[i];
+                if (event.data.fd == wake_fd_) {
+                    std::uint64_t token = 0;
+                    [[maybe_unused]] const auto drained = ::read(wake_fd_, &token, sizeof(token));
+                    if (!flush_outbound()) {
+                        LOG_WARN("serial bridge: write to " + port_.name() + " failed");
+                        return;
+                    }
+                    continue;
+                }
+                if ((event.events & EPOLLOUT) != 0 && !flush_outbound()) {
+                    LOG_WARN("serial bridge: write to " + port_.name() + " failed");
+                    return;
+                }
+                if ((event.events & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0 && !read_port(decoder, message)) {
+                    LOG_WARN("serial bridge: " + port_.name() + " closed");
+                    return;
+                }
+            }
+        }
+#else
+        (void)st;
+#endif
+    }
+
+} // namespace platform
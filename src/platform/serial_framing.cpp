@@ -0,0 +1,216 @@
+#include "platform/serial_framing.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace platform::serial {
+
+    namespace {
+        using CrcTables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+        // tables[0] is the classic byte-at-a-time table; tables[k][b] advances tables[k-1][b] by one
+        // zero byte, so eight lookups fold eight input bytes at once.
+        constexpr CrcTables make_crc_tables() {
+            CrcTables t{};
+            for (std::uint32_t b = 0; b < 256; ++b) {
+                std::uint32_t c = b;
+                for (int k = 0; k < 8; ++k) {
+                    c = (c & 1u) != 0 ? (c >> 1) ^ 0xEDB88320u : c >> 1;
+                }
+                t[0][b] = c;
+            }
+            for (std::size_t k = 1; k < 8; ++k) {
+                for (std::size_t b = 0; b < 256; ++b) {
+                    t[k][b] = (t[k - 1][b] >> 8) ^ t[0][t[k - 1][b] & 0xFFu];
+                }
+            }
+            return t;
+        }
+
+        constexpr CrcTables kCrcTables = make_crc_tables();
+
+        std::uint32_t load_u32_le(const unsigned char *p) {
+            return std::uint32_t{p[0]} | std::uint32_t{p[1]} << 8 | std::uint32_t{p[2]} << 16 |
+                   std::uint32_t{p[3]} << 24;
+        }
+
+        // COBS encoder writing straight into the caller's buffer. Runs of non-zero bytes are
+        // copied with memcpy, at most 254 per block.
+        class CobsWriter {
+          public:
+            explicit CobsWriter(char *out) : out_(out) {}
+
+            void put(const char *p, std::size_t n) {
+                while (n > 0) {
+                    const auto *zero = static_cast<const char *>(std::memchr(p, 0, n));
+                    const std::size_t run = zero == nullptr ? n : static_cast<std::size_t>(zero - p);
+                    put_run(p, run);
+                    if (zero == nullptr) {
+                        return;
+                    }
+                    close_block();
+                    p += run + 1;
+                    n -= run + 1;
+                }
+            }
+
+            std::size_t finish() {
+                out_[code_pos_] = static_cast<char>(code_);
+                out_[pos_++]    = 0;
+                return pos_;
+            }
+
+          private:
+            void put_run(const char *p, std::size_t n) {
+                while (n > 0) {
+                    const std::size_t take = std::min<std::size_t>(n, 0xFF - code_);
+                    std::memcpy(out_ + pos_, p, take);
+                    pos_ += take;
+                    code_ += static_cast<unsigned>(take);
+                    p += take;
+                    n -= take;
+                    if (code_ == 0xFF) {
+                        close_block();
+                    }
+                }
+            }
+
+            void close_block() {
+                out_[code_pos_] = static_cast<char>(code_);
+                code_pos_       = pos_++;
+                code_           = 1;
+            }
+
+            char *out_;
+            std::size_t code_pos_{0};
+            std::size_t pos_{1};
+            unsigned code_{1};
+        };
+    } // namespace
+
+    std::uint32_t crc32(std::span<const char> bytes, std::uint32_t crc) {
+        const auto &t = kCrcTables;
+        const auto *p = reinterpret_cast<const unsigned char *>(bytes.data());
+        std::size_t n = bytes.size();
+        crc           = ~crc;
+        for (; n >= 8; n -= 8, p += 8) {
+            const std::uint32_t lo = load_u32_le(p) ^ crc;
+            const std::uint32_t hi = load_u32_le(p + 4);
+            crc = t[7][lo & 0xFFu] ^ t[6][(lo >> 8) & 0xFFu] ^ t[5][(lo >> 16) & 0xFFu] ^ t[4][lo >> 24] ^
+                  t[3][hi & 0xFFu] ^ t[2][(hi >> 8) & 0xFFu] ^ t[1][(hi >> 16) & 0xFFu] ^ t[0][hi >> 24];
+        }
+        for (; n > 0; --n, ++p) {
+            crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFFu];
+        }
+        return ~crc;
+    }
+
+    std::size_t encode_frame(std::span<const char> payload, std::span<char> out) {
+        if (out.size() < max_frame_size(payload.size())) {
+            return 0;
+        }
+        const std::uint32_t crc = crc32(payload);
+        const char trailer[kCrcBytes]{static_cast<char>(crc & 0xFFu), static_cast<char>((crc >> 8) & 0xFFu),
+                                      static_cast<char>((crc >> 16) & 0xFFu), static_cast<char>(crc >> 24)};
+        CobsWriter writer(out.data());
+        writer.put(payload.data(), payload.size());
+        writer.put(trailer, kCrcBytes);
+        return writer.finish();
+    }
+
+    FrameDecoder::FrameDecoder(std::size_t max_payload) : buffer_(max_payload + kCrcBytes) {}
+
+    void FrameDecoder::reset() {
+        length_       = 0;
+        remaining_    = 0;
+        pending_zero_ = false;
+        discarding_   = false;
+    }
+
+    void FrameDecoder::fail(std::uint64_t &counter) {
+        ++counter;
+        stats_.bytes_discarded += length_;
+        length_     = 0;
+        discarding_ = true;
+    }
+
+    std::optional<std::span<const char>> FrameDecoder::next(std::span<const char> &input) {
+        const char *p   = input.data();
+        const char *end = p + input.size();
+        while (p != end) {
+            // Everything up to the next delimiter belongs to the current frame.
+            const auto *zero = static_cast<const char *>(std::memchr(p, 0, static_cast<std::size_t>(end - p)));
+            const char *stop = zero == nullptr ? end : zero;
+            if (discarding_) {
+                stats_.bytes_discarded += static_cast<std::uint64_t>(stop - p);
+            }
+            while (!discarding_ && p != stop) {
+                if (remaining_ == 0) {
+                    const auto code = static_cast<unsigned char>(*p++);
+                    if (pending_zero_) {
+                        if (length_ == buffer_.size()) {
+                            fail(stats_.overruns);
+                            break;
+                        }
+                        buffer_[length_++] = 0;
+                    }
+                    remaining_    = code - 1u;
+                    pending_zero_ = code != 0xFF;
+                    continue;
+                }
+                const std::size_t take = std::min(remaining_, static_cast<std::size_t>(stop - p));
+                if (take > buffer_.size() - length_) {
+                    fail(stats_.overruns);
+                    break;
+                }
+                std::memcpy(buffer_.data() + length_, p, take);
+                length_ += take;
+                remaining_ -= take;
+                p += take;
+            }
+            if (zero == nullptr) {
+                break;
+            }
+            p = zero + 1;
+            if (discarding_) {
+                reset();
+                continue;
+            }
+            auto frame = finish_frame();
+            if (frame) {
+                input = input.subspan(static_cast<std::size_t>(p - input.data()));
+                return frame;
+            }
+        }
+        input = input.subspan(input.size());
+        return std::nullopt;
+    }
+
+    std::optional<std::span<const char>> FrameDecoder::finish_frame() {
+        const std::size_t length  = length_;
+        const bool truncated      = remaining_ != 0;
+        length_                   = 0;
+        remaining_                = 0;
+        pending_zero_             = false;
+        if (length == 0 && !truncated) {
+            // Back-to-back delimiters (idle line or a sender flushing) are not errors.
+            return std::nullopt;
+        }
+        if (truncated || length < kCrcBytes) {
+            ++stats_.framing_errors;
+            stats_.bytes_discarded += length;
+            return std::nullopt;
+        }
+        const std::size_t payload = length - kCrcBytes;
+        const std::uint32_t crc   = load_u32_le(reinterpret_cast<const unsigned char *>(buffer_.data() + payload));
+        if (crc32(std::span<const char>(buffer_.data(), payload)) != crc) {
+            ++stats_.crc_errors;
+            stats_.bytes_discarded += length;
+            return std::nullopt;
+        }
+        ++stats_.frames;
+        return std::span<const char>(buffer_.data(), payload);
+    }
+
+} // namespace platform::serial
@@ -0,0 +1,218 @@
+#include "platform/simt.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PLATFORM_SIMT_X86 1
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__)
+#define PLATFORM_SIMT_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace platform::simt {
+
+    namespace {
+        using SummarizeKernel = MaskStats (*)(const std::uint32_t *, std::size_t);
+
+        // Two masks per 64-bit popcount. Inlined into targets that have a popcnt instruction, where
+        // std::popcount becomes one; elsewhere it is the portable bit-twiddling sequence.
+        [[gnu::always_inline]] inline MaskStats summarize_words(const std::uint32_t *masks, std::size_t n) {
+            MaskStats stats;
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                std::uint64_t pair;
+                std::memcpy(&pair, masks + i, sizeof(pair));
+                stats.active_lanes += static_cast<std::uint64_t>(std::popcount(pair));
+                stats.full_masks += static_cast<std::uint64_t>(masks[i] == kFullMask) + (masks[i + 1] == kFullMask);
+            }
+            for (; i < n; ++i) {
+                stats.active_lanes += static_cast<std::uint64_t>(std::popcount(masks[i]));
+                stats.full_masks += masks[i] == kFullMask;
+            }
+            stats.masks = n;
+            return stats;
+        }
+
+        MaskStats summarize_scalar(const std::uint32_t *masks, std::size_t n) {
+            return summarize_words(masks, n);
+        }
+
+#ifdef PLATFORM_SIMT_X86
+        __attribute__((target("popcnt"))) MaskStats summarize_popcnt(const std::uint32_t *masks, std::size_t n) {
+            return summarize_words(masks, n);
+        }
+
+        // Per-byte popcount from two 16-entry nibble lookups, summed into 64-bit lanes by vpsadbw.
+        __attribute__((target("avx2,popcnt"))) MaskStats summarize_avx2(const std::uint32_t *masks, std::size_t n) {
+            const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, //
+                                                   0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i low   = _mm256_set1_epi8(0x0f);
+            const __m256i ones  = _mm256_set1_epi32(-1);
+            __m256i lanes       = _mm256_setzero_si256();
+            std::uint64_t full  = 0;
+            std::size_t i       = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m256i v   = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(masks + i));
+                const __m256i lo  = _mm256_shuffle_epi8(table, _mm256_and_si256(v, low));
+                const __m256i hi  = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+                const __m256i cnt = _mm256_add_epi8(lo, hi);
+                lanes             = _mm256_add_epi64(lanes, _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+                const int eq      = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, ones)));
+                full += static_cast<std::uint64_t>(std::popcount(static_cast<unsigned>(eq)));
+            }
+            alignas(32) std::uint64_t parts[4];
+            _mm256_store_si256(reinterpret_cast<__m256i *>(parts), lanes);
+            MaskStats stats  = summarize_words(masks + i, n - i);
+            stats.masks      = n;
+            stats.active_lanes += parts[0] + parts[1] + parts[2] + parts[3];
+            stats.full_masks += full;
+            return stats;
+        }
+
+        __attribute__((target("avx512f,avx512vpopcntdq,popcnt"))) MaskStats summarize_avx512(const std::uint32_t *masks,
+                                                                                           std::size_t n) {
+            const __m512i ones = _mm512_set1_epi32(-1);
+            __m512i lanes      = _mm512_setzero_si512();
+            std::uint64_t full = 0;
+            std::size_t i      = 0;
+            for (; i + 16 <= n; i += 16) {
+                const __m512i v = _mm512_loadu_si512(masks + i);
+                lanes           = _mm512_add_epi64(lanes, _mm512_popcnt_epi64(v));
+                const auto eq   = static_cast<unsigned>(_mm512_cmpeq_epi32_mask(v, ones));
+                full += static_cast<std::uint64_t>(std::popcount(eq));
+            }
+            // Stored and summed by hand: GCC 12's _mm512_reduce_add_epi64 trips -Wuninitialized.
+            alignas(64) std::uint64_t parts[8];
+            _mm512_store_si512(parts, lanes);
+            MaskStats stats = summarize_words(masks + i, n - i);
+            stats.masks     = n;
+            for (const std::uint64_t part : parts) {
+                stats.active_lanes += part;
+            }
+            stats.full_masks += full;
+            return stats;
+        }
+
+        bool vpopcntdq_supported() {
+            static const bool supported = __builtin_cpu_supports("avx512vpopcntdq");
+            return supported;
+        }
+
+        bool popcnt_supported() {
+            static const bool supported = __builtin_cpu_supports("popcnt");
+            return supported;
+        }
+#endif
+
+#ifdef PLATFORM_SIMT_NEON
+        MaskStats summarize_neon(const std::uint32_t *masks, std::size_t n) {
+            std::uint64_t active = 0;
+            std::uint64_t full   = 0;
+            std::size_t i        = 0;
+            for (; i + 4 <= n; i += 4) {
+                const uint32x4_t v = vld1q_u32(masks + i);
+                active += vaddlvq_u8(vcntq_u8(vreinterpretq_u8_u32(v)));
+                full += vaddvq_u32(vshrq_n_u32(vceqq_u32(v, vdupq_n_u32(kFullMask)), 31));
+            }
+            MaskStats stats = summarize_scalar(masks + i, n - i);
+            stats.masks     = n;
+            stats.active_lanes += active;
+            stats.full_masks += full;
+            return stats;
+        }
+#endif
+
+        SummarizeKernel summarize_kernel(SimdIsa isa) {
+            switch (isa) {
+#ifdef PLATFORM_SIMT_X86
+                case SimdIsa::kAvx512:
+                    if (vpopcntdq_supported()) {
+                        return summarize_avx512;
+                    }
+                    return summarize_avx2;
+                case SimdIsa::kAvx2:
+                    return summarize_avx2;
+                case SimdIsa::kSse2:
+                    if (popcnt_supported()) {
+                        return summarize_popcnt;
+                    }
+                    return summarize_scalar;
+#endif
+#ifdef PLATFORM_SIMT_NEON
+                case SimdIsa::kNeon:
+                    return summarize_neon;
+#endif
+                default:
+                    return summarize_scalar;
+            }
+        }
+    } // namespace
+
+    MaskStats summarize_masks(std::span<const std::uint32_t> masks, std::optional<SimdIsa> isa) {
+        const SimdIsa chosen = isa.has_value() && simd_isa_supported(*isa) ? *isa : active_simd_isa();
+        return summarize_kernel(chosen)(masks.data(), masks.size());
+    }
+
+    Occupancy estimate_occupancy(const LaunchResources &launch, const SmLimits &sm) {
+        Occupancy result;
+        if (launch.block_threads == 0 || launch.block_threads > sm.max_threads || sm.max_warps == 0) {
+            return result;
+        }
+        constexpr std::uint32_t kUnlimited  = std::numeric_limits<std::uint32_t>::max();
+        const std::uint32_t warps_per_block = (launch.block_threads + kWarpSize - 1) / kWarpSize;
+
+        const std::uint32_t by_warps  = std::min(sm.max_warps / warps_per_block, sm.max_threads / launch.block_threads);
+        const std::uint32_t by_blocks = sm.max_blocks;
+        std::uint32_t by_registers    = kUnlimited;
+        if (launch.registers_per_thread > sm.max_registers_per_thread) {
+            by_registers = 0;
+        } else if (launch.registers_per_thread > 0) {
+            const std::uint32_t unit     = std::max<std::uint32_t>(sm.register_allocation_unit, 1);
+            const std::uint32_t per_warp = (launch.registers_per_thread * kWarpSize + unit - 1) / unit * unit;
+            by_registers                 = sm.registers / per_warp / warps_per_block;
+        }
+        const std::uint32_t by_shared =
+            launch.shared_bytes_per_block == 0 ? kUnlimited : sm.shared_memory_bytes / launch.shared_bytes_per_block;
+
+        // Ties go to the earlier limiter, matching the order the calculator reports them.
+        result.blocks_per_sm = by_warps;
+        result.limiter       = OccupancyLimiter::kWarps;
+        if (by_blocks < result.blocks_per_sm) {
+            result.blocks_per_sm = by_blocks;
+            result.limiter       = OccupancyLimiter::kBlocks;
+        }
+        if (by_registers < result.blocks_per_sm) {
+            result.blocks_per_sm = by_registers;
+            result.limiter       = OccupancyLimiter::kRegisters;
+        }
+        if (by_shared < result.blocks_per_sm) {
+            result.blocks_per_sm = by_shared;
+            result.limiter       = OccupancyLimiter::kSharedMemory;
+        }
+        result.warps_per_sm = result.blocks_per_sm * warps_per_block;
+        result.occupancy    = static_cast<double>(result.warps_per_sm) / static_cast<double>(sm.max_warps);
+        return result;
+    }
+
+    const char *to_string(OccupancyLimiter limiter) {
+        switch (limiter) {
+            case OccupancyLimiter::kWarps:
+                return "warps";
+            case OccupancyLimiter::kBlocks:
+                return "blocks";
+            case OccupancyLimiter::kRegisters:
+                return "registers";
+            case OccupancyLimiter::kSharedMemory:
+                return "shared_memory";
+            case OccupancyLimiter::kInvalid:
+                break;
+        }
+        return "invalid";
+    }
+
+} // namespace platform::simt
@@ -1,11 +1,46 @@
 #include "platform/thread_pool.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <string>
+
+#include "platform/cpu_topology.hpp"
+#include "platform/metrics.hpp"
+
 namespace platform {
 
-    ThreadPool::ThreadPool(std::size_t thread_count, std::size_t queue_capacity) : queue_(queue_capacity) {
-        workers_.reserve(thread_count);
-        for (std::size_t i = 0; i < thread_count; ++i) {
-            workers_.emplace_back([this](std::stop_token st) { worker(st); });
+    namespace {
+        constexpr std::size_t kLow    = static_cast<std::size_t>(JobPriority::kLow);
+        constexpr std::size_t kNormal = static_cast<std::size_t>(JobPriority::kNormal);
+        constexpr std::size_t kHigh   = static_cast<std::size_t>(JobPriority::kHigh);
+
+        std::uint64_t elapsed_ns(std::chrono::steady_clock::duration d) {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+            return ns < 0 ? 0 : static_cast<std::uint64_t>(ns);
+        }
+
+        std::vector<int> without(const std::vector<int> &cpus, const std::vector<int> &removed) {
+            std::vector<int> sorted(removed);
+            std::sort(sorted.begin(), sorted.end());
+            std::vector<int> out;
+            std::set_difference(cpus.begin(), cpus.end(), sorted.begin(), sorted.end(), std::back_inserter(out));
+            return out;
+        }
+    } // namespace
+
+    ThreadPool::ThreadPool(std::size_t thread_count, std::size_t queue_capacity, PoolPriorities priorities,
+                           ThreadPlacement placement, PoolScaling scaling, WaitStrategy wait)
+        : capacity_(queue_capacity), priorities_(priorities), scaling_(scaling), wait_(wait),
+          elastic_(scaling.max_threads > thread_count), name_(placement.name) {
+        const std::size_t initial = elastic_ ? std::max<std::size_t>(thread_count, 1) : thread_count;
+        place_workers(elastic_ ? scaling.max_threads : thread_count, initial, placement);
+        workers_.resize(slots_.size());
+        for (std::size_t i = 0; i < initial; ++i) {
+            start_worker(i);
+        }
+        if (elastic_) {
+            scaler_ = std::jthread([this](std::stop_token st) { scale(st); });
         }
     }
 
@@ -13,11 +48,314 @@ namespace platform {
         shutdown();
     }
 
-    bool ThreadPool::enqueue(std::function<void()> job) {
+    // Deals worker slots round robin over the groups (one per NUMA node in use), so slot i serves
+    // group i % groups as its (i / groups)-th worker, and decides each slot's CPU set up front. The
+    // first `initial` slots start with the pool; later ones only when an elastic pool grows.
+    void ThreadPool::place_workers(std::size_t slot_count, std::size_t initial, const ThreadPlacement &placement) {
+        const CpuTopology &topology = cpu_topology();
+        std::vector<int> allowed    = without(topology.usable, placement.exclude);
+        if (placement.avoid_isolated) {
+            allowed = without(allowed, topology.isolated);
+        }
+        if (allowed.empty()) {
+            allowed = topology.usable;
+        }
+
+        const std::size_t max_groups  = std::max<std::size_t>(initial, 1);
+        const std::size_t group_count = placement.numa_groups ? std::min(topology.nodes.size(), max_groups) : 1;
+        std::vector<std::vector<int>> group_cpus(group_count, allowed);
+        if (placement.numa_groups) {
+            for (std::size_t g = 0; g < group_count; ++g) {
+                // A node with no allowed CPU left falls back to all of them.
+                auto local = intersect_cpus(topology.nodes[g], allowed);
+                if (!local.empty()) {
+                    group_cpus[g] = std::move(local);
+                }
+            }
+        }
+        for (std::size_t g = 0; g < group_count; ++g) {
+            auto group      = std::make_unique<Group>();
+            group->capacity = std::max<std::size_t>(capacity_ / group_count, 1);
+            group->credits  = priorities_.weights;
+            groups_.push_back(std::move(group));
+        }
+
+        for (std::size_t i = 0; i < initial; ++i) {
+            Group &group = *groups_[i % group_count];
+            ++group.min_live;
+            ++group.live;
+        }
+        slots_.resize(slot_count);
+        for (std::size_t i = 0; i < slot_count; ++i) {
+            const std::size_t g = i % group_count;
+            const std::size_t j = i / group_count;
+            Group &group        = *groups_[g];
+            // Reserved workers are among the initial ones and never retire, and each group keeps a
+            // general worker.
+            const std::size_t reserved = std::min(priorities_.reserved_workers, group.min_live - 1);
+            WorkerSlot &slot           = slots_[i];
+            slot.group                 = &group;
+            slot.reserved              = j < reserved;
+            slot.active                = i < initial;
+            ++group.slots;
+            if (!placement.cpu_sets.empty()) {
+                slot.cpus = placement.cpu_sets[i % placement.cpu_sets.size()];
+            } else if (placement.pin == PinPolicy::kCore) {
+                slot.cpus = {group_cpus[g][j % group_cpus[g].size()]};
+            } else if (placement.pin == PinPolicy::kNode || placement.numa_groups || group_cpus[g] != topology.usable) {
+                slot.cpus = group_cpus[g];
+            }
+        }
+    }
+
+    // The slot must already be marked active and counted in its group's `live`.
+    void ThreadPool::start_worker(std::size_t index) {
+        if (workers_[index].joinable()) {
+            workers_[index].join(); // retired: its thread has returned or is about to
+        }
+        live_.fetch_add(1, std::memory_order_relaxed);
+        workers_[index] = std::jthread([this, index](std::stop_token st) { worker(st, index); });
+    }
+
+    // The group serving the submitting thread's NUMA node; group g serves node g (mod groups).
+    ThreadPool::Group &ThreadPool::submit_group() {
+        if (groups_.size() == 1) {
+            return *groups_.front();
+        }
+        const int cpu = current_cpu();
+        return *groups_[cpu < 0 ? 0 : cpu_topology().node_of(cpu) % groups_.size()];
+    }
+
+    bool ThreadPool::enqueue(std::function<void()> job, JobPriority priority) {
         if (shutting_down_.load(std::memory_order_relaxed)) {
             return false;
         }
-        return queue_.push(std::move(job));
+        Group &group = submit_group();
+        return push(group, job, priority, group.capacity, true);
+    }
+
+    bool ThreadPool::try_enqueue(std::function<void()> job, JobPriority priority) {
+        Group &group          = submit_group();
+        std::size_t watermark = group.capacity;
+        switch (priority) {
+            case JobPriority::kLow:
+                watermark = group.capacity / 2;
+                break;
+            case JobPriority::kNormal:
+                watermark = group.capacity - group.capacity / 4;
+                break;
+            case JobPriority::kHigh:
+                break;
+        }
+        if (!shutting_down_.load(std::memory_order_relaxed) &&
+            push(group, job, priority, std::max<std::size_t>(watermark, 1), false)) {
+            return true;
+        }
+        if (const auto *metrics = metrics_.load(std::memory_order_acquire)) {
+            metrics->rejected->add();
+        }
+        return false;
+    }
+
+    bool ThreadPool::push(Group &group, std::function<void()> &job, JobPriority priority, std::size_t limit,
+                          bool block) {
+        std::unique_lock lock(group.mutex);
+        const auto *metrics = metrics_.load(std::memory_order_acquire);
+        auto has_room       = [&]() { return group.closed || group.depth < limit; };
+        if (block && !has_room()) {
+            const auto started = Clock::now();
+            group.not_full.wait(lock, has_room);
+            if (metrics != nullptr) {
+                metrics->push_wait_ns->record(Clock::now() - started);
+            }
+        }
+        if (group.closed || group.depth >= limit) {
+            return false;
+        }
+        group.lanes[static_cast<std::size_t>(priority)].push_back({std::move(job), Clock::now()});
+        ++group.depth;
+        group.queued.store(group.depth, std::memory_order_release);
+        if (priority == JobPriority::kHigh) {
+            group.queued_high.store(group.lanes[kHigh].size(), std::memory_order_release);
+        }
+        const auto depth = total_depth_.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (metrics != nullptr) {
+            metrics->depth->set(static_cast<std::int64_t>(depth));
+        }
+        if (priority == JobPriority::kHigh) {
+            group.high_ready.notify_one();
+        }
+        group.work_ready.notify_one();
+        return true;
+    }
+
+    ThreadPool::Popped ThreadPool::pop(WorkerSlot &slot, Job &out, std::stop_token st) {
+        Group &group        = *slot.group;
+        const bool reserved = slot.reserved;
+        auto waiting_since  = spin(slot, st);
+        std::unique_lock lock(group.mutex);
+        auto available = [&]() { return reserved ? !group.lanes[kHigh].empty() : group.depth > 0; };
+        if (!available()) {
+            if (!waiting_since) {
+                waiting_since = Clock::now();
+            }
+            auto &ready = reserved ? group.high_ready : group.work_ready;
+            auto woken  = [&]() { return group.closed || available(); };
+            while (!woken() && !st.stop_requested()) {
+                if (wait_.mode == WaitMode::kSpin) {
+                    // Another worker took the job this one spun for; spin again without the lock.
+                    lock.unlock();
+                    spin(slot, st);
+                    lock.lock();
+                } else if (!elastic_ || reserved) {
+                    ready.wait(lock, st, woken);
+                } else if (!ready.wait_for(lock, st, scaling_.idle_timeout, woken) && !st.stop_requested() &&
+                           group.live > group.min_live) {
+                    --group.live;
+                    slot.active = false;
+                    return Popped::kRetired;
+                }
+            }
+        }
+        if (waiting_since) {
+            if (const auto *metrics = metrics_.load(std::memory_order_acquire)) {
+                metrics->pop_wait_ns->record(Clock::now() - *waiting_since);
+            }
+        }
+        if (!available()) {
+            return Popped::kClosed;
+        }
+        const auto now         = Clock::now();
+        const std::size_t lane = reserved ? kHigh : select_lane(group, now);
+        out                    = std::move(group.lanes[lane].front());
+        group.lanes[lane].pop_front();
+        --group.depth;
+        group.queued.store(group.depth, std::memory_order_release);
+        if (lane == kHigh) {
+            group.queued_high.store(group.lanes[kHigh].size(), std::memory_order_release);
+        }
+        const auto depth = total_depth_.fetch_sub(1, std::memory_order_relaxed) - 1;
+        group.not_full.notify_one();
+        if (const auto *metrics = metrics_.load(std::memory_order_acquire)) {
+            metrics->depth->set(static_cast<std::int64_t>(depth));
+            metrics->queue_wait_ns[lane]->record(now - out.enqueued);
+        }
+        return Popped::kJob;
+    }
+
+    std::optional<ThreadPool::Clock::time_point> ThreadPool::spin(const WorkerSlot &slot, std::stop_token st) {
+        const auto &queued = slot.reserved ? slot.group->queued_high : slot.group->queued;
+        auto arrived       = [&]() {
+            return queued.load(std::memory_order_acquire) != 0 || shutting_down_.load(std::memory_order_acquire);
+        };
+        if (wait_.mode == WaitMode::kBlock || arrived()) {
+            return std::nullopt;
+        }
+        const auto since = Clock::now();
+        spin_until(wait_, st, arrived);
+        return since;
+    }
+
+    std::size_t ThreadPool::select_lane(Group &group, Clock::time_point now) {
+        auto &lanes = group.lanes;
+        if (priorities_.aging > std::chrono::microseconds::zero()) {
+            std::optional<std::size_t> oldest;
+            for (const std::size_t lane : {kLow, kNormal}) {
+                if (lanes[lane].empty() || now - lanes[lane].front().enqueued < priorities_.aging) {
+                    continue;
+                }
+                if (!oldest || lanes[lane].front().enqueued < lanes[*oldest].front().enqueued) {
+                    oldest = lane;
+                }
+            }
+            if (oldest) {
+                if (const auto *metrics = metrics_.load(std::memory_order_acquire)) {
+                    metrics->aged->add();
+                }
+                return *oldest;
+            }
+        }
+        if (priorities_.selection == LaneSelection::kWeighted) {
+            // A lane that has used its credits waits for the next round unless it is the only one
+            // with work; a round starts when no non-empty lane has credits left.
+            for (int round = 0; round < 2; ++round) {
+                for (const std::size_t lane : {kHigh, kNormal, kLow}) {
+                    if (!lanes[lane].empty() && group.credits[lane] > 0) {
+                        --group.credits[lane];
+                        return lane;
+                    }
+                }
+                group.credits = priorities_.weights;
+            }
+        }
+        for (const std::size_t lane : {kHigh, kNormal, kLow}) {
+            if (!lanes[lane].empty()) {
+                return lane;
+            }
+        }
+        return kHigh;
+    }
+
+    // Every `interval`, finds how long the oldest job in each group has waited and starts one more
+    // worker in a group whose wait exceeds the target, if it has a free slot. Retirement happens in
+    // pop(), so shrinking needs no coordination here.
+    void ThreadPool::scale(std::stop_token st) {
+        std::mutex mutex;
+        std::condition_variable_any tick;
+        auto last_tick          = Clock::now();
+        std::uint64_t last_busy = 0;
+        while (true) {
+            {
+                std::unique_lock lock(mutex);
+                tick.wait_for(lock, st, scaling_.interval, [] { return false; });
+            }
+            if (st.stop_requested()) {
+                return;
+            }
+            const auto now = Clock::now();
+            Clock::duration oldest{0};
+            for (auto &owned : groups_) {
+                Group &group = *owned;
+                std::optional<std::size_t> start;
+                {
+                    std::lock_guard lock(group.mutex);
+                    Clock::duration waited{0};
+                    for (const auto &lane : group.lanes) {
+                        if (!lane.empty()) {
+                            waited = std::max(waited, now - lane.front().enqueued);
+                        }
+                    }
+                    oldest = std::max(oldest, waited);
+                    if (waited > scaling_.target_wait && group.live < group.slots && !group.closed) {
+                        for (std::size_t i = 0; i < slots_.size(); ++i) {
+                            if (slots_[i].group == &group && !slots_[i].active) {
+                                slots_[i].active = true;
+                                ++group.live;
+                                start = i;
+                                break;
+                            }
+                        }
+                    }
+                }
+                if (start) {
+                    start_worker(*start);
+                    if (const auto *metrics = metrics_.load(std::memory_order_acquire)) {
+                        metrics->scale_ups->add();
+                    }
+                }
+            }
+            const auto busy    = busy_ns_.load(std::memory_order_relaxed);
+            const auto workers = live_.load(std::memory_order_relaxed);
+            const auto window  = elapsed_ns(now - last_tick) * std::max<std::size_t>(workers, 1);
+            if (const auto *metrics = metrics_.load(std::memory_order_acquire)) {
+                const auto pct = window == 0 ? 0 : std::min<std::uint64_t>((busy - last_busy) * 100 / window, 100);
+                metrics->workers->set(static_cast<std::int64_t>(workers));
+                metrics->oldest_wait_ns->set(static_cast<std::int64_t>(elapsed_ns(oldest)));
+                metrics->utilization_pct->set(static_cast<std::int64_t>(pct));
+            }
+            last_tick = now;
+            last_busy = busy;
+        }
     }
 
     void ThreadPool::shutdown() {
@@ -25,7 +363,19 @@ namespace platform {
         if (!shutting_down_.compare_exchange_strong(expected, true)) {
             return;
         }
-        queue_.close();
+        if (scaler_.joinable()) {
+            scaler_.request_stop();
+            scaler_.join();
+        }
+        for (auto &group : groups_) {
+            {
+                std::lock_guard lock(group->mutex);
+                group->closed = true;
+            }
+            group->not_full.notify_all();
+            group->work_ready.notify_all();
+            group->high_ready.notify_all();
+        }
         for (auto &t : workers_) {
             if (t.joinable()) {
                 t.request_stop();
@@ -34,14 +384,82 @@ namespace platform {
         }
     }
 
-    void ThreadPool::worker(std::stop_token st) {
+    void ThreadPool::bind_metrics(MetricsRegistry &registry, std::string_view prefix) {
+        std::call_once(metrics_once_, [&]() {
+            const std::string base(prefix);
+            metrics_storage_.jobs         = &registry.counter(base + "_jobs_total");
+            metrics_storage_.rejected     = &registry.counter(base + "_rejected_total");
+            metrics_storage_.idle_ns      = &registry.counter(base + "_idle_ns_total");
+            metrics_storage_.busy_ns      = &registry.counter(base + "_busy_ns_total");
+            metrics_storage_.aged         = &registry.counter(base + "_aged_total");
+            metrics_storage_.depth        = &registry.gauge(base + "_queue_depth");
+            metrics_storage_.push_wait_ns = &registry.histogram(base + "_queue_push_wait_ns");
+            metrics_storage_.pop_wait_ns  = &registry.histogram(base + "_queue_pop_wait_ns");
+            const char *names[kJobPriorities] = {"low", "normal", "high"};
+            for (std::size_t lane = 0; lane < kJobPriorities; ++lane) {
+                metrics_storage_.queue_wait_ns[lane] =
+                    &registry.histogram(base + "_queue_wait_ns{priority=\"" + names[lane] + "\"}");
+            }
+            if (elastic_) {
+                metrics_storage_.workers         = &registry.gauge(base + "_workers");
+                metrics_storage_.utilization_pct = &registry.gauge(base + "_utilization_pct");
+                metrics_storage_.oldest_wait_ns  = &registry.gauge(base + "_oldest_wait_ns");
+                metrics_storage_.scale_ups       = &registry.counter(base + "_scale_up_total");
+                metrics_storage_.scale_downs     = &registry.counter(base + "_scale_down_total");
+                metrics_storage_.workers->set(static_cast<std::int64_t>(live_.load(std::memory_order_relaxed)));
+            }
+            metrics_storage_.depth->set(static_cast<std::int64_t>(total_depth_.load(std::memory_order_relaxed)));
+            metrics_.store(&metrics_storage_, std::memory_order_release);
+        });
+    }
+
+    void ThreadPool::worker(std::stop_token st, std::size_t index) {
+        WorkerSlot &slot = slots_[index];
+        if (!name_.empty()) {
+            name_current_thread(name_ + "-" + std::to_string(index));
+        }
+        if (!slot.cpus.empty() && pin_current_thread(slot.cpus)) {
+            pinned_.fetch_add(1, std::memory_order_relaxed);
+        }
+        // Idle time is measured from the end of the previous timed job, so the first job after
+        // binding contributes only busy time.
+        std::optional<Clock::time_point> idle_since;
         while (!st.stop_requested()) {
-            auto job = queue_.pop(st);
-            if (!job.has_value()) {
+            Job job;
+            const Popped popped = pop(slot, job, st);
+            if (popped == Popped::kRetired) {
+                live_.fetch_sub(1, std::memory_order_relaxed);
+                if (const auto *metrics = metrics_.load(std::memory_order_acquire)) {
+                    metrics->scale_downs->add();
+                    metrics->workers->set(static_cast<std::int64_t>(live_.load(std::memory_order_relaxed)));
+                }
+                return;
+            }
+            if (popped == Popped::kClosed) {
                 break;
             }
-            (*job)();
+            const auto *metrics = metrics_.load(std::memory_order_acquire);
+            if (metrics == nullptr && !elastic_) {
+                job.fn();
+                continue;
+            }
+            const auto started = Clock::now();
+            job.fn();
+            const auto finished = Clock::now();
+            if (elastic_) {
+                busy_ns_.fetch_add(elapsed_ns(finished - started), std::memory_order_relaxed);
+            }
+            if (metrics == nullptr) {
+                continue;
+            }
+            if (idle_since.has_value()) {
+                metrics->idle_ns->add(elapsed_ns(started - *idle_since));
+            }
+            metrics->busy_ns->add(elapsed_ns(finished - started));
+            metrics->jobs->add();
+            idle_since = finished;
         }
+        live_.fetch_sub(1, std::memory_order_relaxed);
     }
 
 } // namespace platform
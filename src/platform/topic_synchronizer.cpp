@@ -0,0 +1,93 @@
+#include "platform/topic_synchronizer.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace platform {
+
+    bool TopicSynchronizer::Ring::push_back(StampedValue sample) {
+        const bool evicted = size_ == slots_.size();
+        if (evicted) {
+            pop_front(1);
+        }
+        slots_[(head_ + size_) & mask_] = sample;
+        ++size_;
+        return !evicted;
+    }
+
+    void TopicSynchronizer::Ring::pop_front(std::size_t count) {
+        count = std::min(count, size_);
+        head_ = (head_ + count) & mask_;
+        size_ -= count;
+    }
+
+    std::size_t TopicSynchronizer::Ring::nearest(std::int64_t timestamp_ns) const {
+        // First sample at or after the pivot, then compare with its predecessor.
+        std::size_t lo = 0;
+        std::size_t hi = size_;
+        while (lo < hi) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if ((*this)[mid].timestamp_ns < timestamp_ns) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == size_) {
+            return size_ - 1;
+        }
+        if (lo > 0 && timestamp_ns - (*this)[lo - 1].timestamp_ns <= (*this)[lo].timestamp_ns - timestamp_ns) {
+            return lo - 1;
+        }
+        return lo;
+    }
+
+    TopicSynchronizer::TopicSynchronizer(std::size_t topics, SyncOptions options, Callback on_match)
+        : tolerance_ns_(options.tolerance.count()), tuple_(topics), picks_(topics), on_match_(std::move(on_match)) {
+        const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(options.capacity, 1));
+        rings_.reserve(topics);
+        for (std::size_t i = 0; i < topics; ++i) {
+            rings_.emplace_back(capacity);
+        }
+    }
+
+    bool TopicSynchronizer::push(std::size_t topic, StampedValue sample) {
+        Ring &own = rings_[topic];
+        if (own.size() > 0 && sample.timestamp_ns < own.back().timestamp_ns) {
+            ++stats_.out_of_order;
+            return false;
+        }
+        if (!own.push_back(sample)) {
+            ++stats_.overflowed;
+        }
+
+        for (std::size_t i = 0; i < rings_.size(); ++i) {
+            if (i == topic) {
+                continue;
+            }
+            const Ring &ring = rings_[i];
+            if (ring.size() == 0) {
+                return false;
+            }
+            const std::size_t pick = ring.nearest(sample.timestamp_ns);
+            const std::int64_t gap = ring[pick].timestamp_ns - sample.timestamp_ns;
+            if (gap > tolerance_ns_ || -gap > tolerance_ns_) {
+                return false;
+            }
+            picks_[i] = pick;
+            tuple_[i] = ring[pick];
+        }
+
+        picks_[topic] = own.size() - 1;
+        tuple_[topic] = sample;
+        for (std::size_t i = 0; i < rings_.size(); ++i) {
+            rings_[i].pop_front(picks_[i] + 1);
+        }
+        ++stats_.matched;
+        if (on_match_) {
+            on_match_(tuple_);
+        }
+        return true;
+    }
+
+} // namespace platform
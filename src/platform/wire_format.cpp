@@ -0,0 +1,137 @@
+#include "platform/wire_format.hpp"
+
+#include <charconv>
+#include <system_error>
+
+namespace platform::wire {
+
+    namespace {
+        void write_header(char *p, RecordType type, std::size_t size) {
+            p[0] = static_cast<char>(kMagic[0]);
+            p[1] = static_cast<char>(kMagic[1]);
+            p[2] = static_cast<char>(kVersion);
+            p[3] = static_cast<char>(type);
+            detail::store_le(p + offsetof(Header, size), static_cast<std::uint32_t>(size));
+        }
+    } // namespace
+
+    std::optional<std::size_t> detail::check_header(std::string_view bytes, RecordType type, std::size_t v1_size) {
+        if (bytes.size() < v1_size || !is_binary(bytes)) {
+            return std::nullopt;
+        }
+        const auto version = static_cast<std::uint8_t>(bytes[offsetof(Header, version)]);
+        const auto kind    = static_cast<RecordType>(bytes[offsetof(Header, type)]);
+        const auto size    = load_le<std::uint32_t>(bytes.data() + offsetof(Header, size));
+        if (version < 1 || kind != type || size < v1_size || size > bytes.size()) {
+            return std::nullopt;
+        }
+        return size;
+    }
+
+    std::optional<SensorSampleView> SensorSampleView::from(std::string_view bytes) {
+        if (!detail::check_header(bytes, RecordType::kSensorSample, sizeof(SensorSampleRecord))) {
+            return std::nullopt;
+        }
+        return SensorSampleView(bytes.data());
+    }
+
+    std::string_view SensorSampleView::name() const {
+        const char *name = data_ + offsetof(SensorSampleRecord, name);
+        std::size_t len  = 0;
+        while (len < kMaxNameLength && name[len] != '\0') {
+            ++len;
+        }
+        return {name, len};
+    }
+
+    std::optional<ControlCommandView> ControlCommandView::from(std::string_view bytes) {
+        if (!detail::check_header(bytes, RecordType::kControlCommand, sizeof(ControlCommandRecord))) {
+            return std::nullopt;
+        }
+        return ControlCommandView(bytes.data());
+    }
+
+    std::size_t encode_sensor_sample(std::span<char> out, std::string_view name, double value,
+                                     std::int64_t timestamp_ns, std::uint32_t sequence) {
+        constexpr std::size_t kSize = sizeof(SensorSampleRecord);
+        if (out.size() < kSize || name.size() > kMaxNameLength) {
+            return 0;
+        }
+        char *p = out.data();
+        std::memset(p, 0, kSize);
+        write_header(p, RecordType::kSensorSample, kSize);
+        detail::store_le(p + offsetof(SensorSampleRecord, sequence), sequence);
+        detail::store_le(p + offsetof(SensorSampleRecord, timestamp_ns), timestamp_ns);
+        detail::store_le(p + offsetof(SensorSampleRecord, value), value);
+        std::memcpy(p + offsetof(SensorSampleRecord, name), name.data(), name.size());
+        return kSize;
+    }
+
+    std::size_t encode_control_command(std::span<char> out, double effort, std::int64_t timestamp_ns,
+                                       std::uint32_t sequence) {
+        constexpr std::size_t kSize = sizeof(ControlCommandRecord);
+        if (out.size() < kSize) {
+            return 0;
+        }
+        char *p = out.data();
+        std::memset(p, 0, kSize);
+        write_header(p, RecordType::kControlCommand, kSize);
+        detail::store_le(p + offsetof(ControlCommandRecord, sequence), sequence);
+        detail::store_le(p + offsetof(ControlCommandRecord, timestamp_ns), timestamp_ns);
+        detail::store_le(p + offsetof(ControlCommandRecord, effort), effort);
+        return kSize;
+    }
+
+    std::string sensor_sample_payload(std::string_view name, double value, std::int64_t timestamp_ns,
+                                      std::uint32_t sequence) {
+        std::string out(sizeof(SensorSampleRecord), '\0');
+        if (encode_sensor_sample(out, name, value, timestamp_ns, sequence) == 0) {
+            out.clear();
+        }
+        return out;
+    }
+
+    std::string control_command_payload(double effort, std::int64_t timestamp_ns, std::uint32_t sequence) {
+        std::string out(sizeof(ControlCommandRecord), '\0');
+        encode_control_command(out, effort, timestamp_ns, sequence);
+        return out;
+    }
+
+    std::optional<double> parse_number(std::string_view text) {
+        double value      = 0.0;
+        const char *end   = text.data() + text.size();
+        const auto result = std::from_chars(text.data(), end, value);
+        if (result.ec != std::errc{} || result.ptr != end) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    std::optional<SensorText> parse_sensor_text(std::string_view payload) {
+        const auto colon = payload.find(':');
+        if (colon == std::string_view::npos) {
+            return std::nullopt;
+        }
+        const auto value = parse_number(payload.substr(colon + 1));
+        if (!value) {
+            return std::nullopt;
+        }
+        return SensorText{.name = payload.substr(0, colon), .value = *value};
+    }
+
+    std::size_t format_number(std::span<char> out, double value) {
+        const auto result = std::to_chars(out.data(), out.data() + out.size(), value);
+        return result.ec == std::errc{} ? static_cast<std::size_t>(result.ptr - out.data()) : 0;
+    }
+
+    std::size_t format_sensor_text(std::span<char> out, std::string_view name, double value) {
+        if (name.find(':') != std::string_view::npos || out.size() <= name.size()) {
+            return 0;
+        }
+        std::memcpy(out.data(), name.data(), name.size());
+        out[name.size()]        = ':';
+        const std::size_t chars = format_number(out.subspan(name.size() + 1), value);
+        return chars == 0 ? 0 : name.size() + 1 + chars;
+    }
+
+} // namespace platform::wire
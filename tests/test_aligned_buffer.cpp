@@ -0,0 +1,35 @@
+// test_aligned_buffer.cpp - alignment, value-initialisation and move semantics.
+#include "platform/aligned_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+
+TEST(AlignedBuffer, StorageIsAlignedAndZeroed) {
+    platform::AlignedBuffer<float> buf(1000);
+    ASSERT_EQ(buf.size(), 1000u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buf.data()) % 64, 0u);
+    for (float v : buf) {
+        EXPECT_EQ(v, 0.0f);
+    }
+
+    platform::AlignedBuffer<double, 128> wide(3);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(wide.data()) % 128, 0u);
+}
+
+TEST(AlignedBuffer, MoveTransfersOwnership) {
+    platform::AlignedBuffer<int> a(16);
+    a[15]           = 42;
+    const int *data = a.data();
+
+    platform::AlignedBuffer<int> b(std::move(a));
+    EXPECT_EQ(b.data(), data);
+    EXPECT_EQ(b[15], 42);
+    EXPECT_TRUE(a.empty());
+
+    platform::AlignedBuffer<int> c;
+    c = std::move(b);
+    EXPECT_EQ(c.span().size(), 16u);
+    EXPECT_TRUE(b.empty());
+}
@@ -0,0 +1,75 @@
+// test_bench_compare.cpp - benchmark JSON parsing, Mann-Whitney and regression verdict checks.
+#include "bench_compare.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+    std::string make_json(const std::string &name, const std::vector<double> &times, const char *unit = "ns") {
+        std::string json = R"({"context": {"library_build_type": "release"}, "benchmarks": [)";
+        for (std::size_t i = 0; i < times.size(); ++i) {
+            json += R"({"name": ")" + name + R"(", "run_name": ")" + name +
+                    R"(", "run_type": "iteration", "repetition_index": )" + std::to_string(i) +
+                    R"(, "real_time": )" + std::to_string(times[i]) + R"(, "cpu_time": 1.0e+00, "time_unit": ")" +
+                    unit + R"("},)";
+        }
+        json += R"({"name": ")" + name + R"(_mean", "run_name": ")" + name +
+                R"(", "run_type": "aggregate", "aggregate_name": "mean", "real_time": 999.0, "time_unit": "ns"}]})";
+        return json;
+    }
+} // namespace
+
+TEST(BenchCompare, ParsesIterationsAndNormalisesUnits) {
+    std::string error;
+    auto runs = bench_compare::parse_benchmark_json(make_json("BM_Queue/64", {1.5, 2.0, 2.5}, "us"), "real_time",
+                                                    &error);
+    ASSERT_TRUE(runs.has_value()) << error;
+    ASSERT_EQ(runs->size(), 1u);
+    EXPECT_EQ((*runs)[0].name, "BM_Queue/64");
+    ASSERT_EQ((*runs)[0].values.size(), 3u);
+    EXPECT_DOUBLE_EQ((*runs)[0].values[0], 1500.0);
+}
+
+TEST(BenchCompare, RejectsMalformedJson) {
+    std::string error;
+    EXPECT_FALSE(bench_compare::parse_benchmark_json(R"({"benchmarks": [)", "real_time", &error).has_value());
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(bench_compare::parse_benchmark_json(R"({"context": {}})", "real_time").has_value());
+}
+
+TEST(BenchCompare, MannWhitneyExactAndApproximate) {
+    const std::vector<double> low{1, 2, 3, 4, 5};
+    const std::vector<double> high{6, 7, 8, 9, 10};
+    // Complete separation of 5 vs 5: two-sided exact p = 2 / C(10, 5).
+    EXPECT_NEAR(bench_compare::mann_whitney_p_value(low, high), 2.0 / 252.0, 1e-12);
+    EXPECT_NEAR(bench_compare::mann_whitney_p_value(low, low), 1.0, 1e-9);
+
+    std::vector<double> a(30, 1.0);
+    std::vector<double> b(30, 2.0);
+    EXPECT_LT(bench_compare::mann_whitney_p_value(a, b), 1e-6);
+}
+
+TEST(BenchCompare, FlagsSignificantRegressionOnly) {
+    const std::vector<bench_compare::BenchmarkSamples> base{{"fast", {100, 101, 99, 100, 102, 98}},
+                                                            {"noisy", {100, 150, 80, 120, 90, 110}},
+                                                            {"gone", {1, 1, 1}}};
+    const std::vector<bench_compare::BenchmarkSamples> cand{{"fast", {130, 131, 129, 132, 128, 130}},
+                                                            {"noisy", {110, 90, 140, 100, 125, 95}}};
+    const auto results = bench_compare::compare(base, cand, {});
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[0].verdict, bench_compare::Verdict::kRegressed);
+    EXPECT_NEAR(results[0].relative_change, 0.3, 0.01);
+    EXPECT_EQ(results[1].verdict, bench_compare::Verdict::kUnchanged);
+    EXPECT_EQ(results[2].verdict, bench_compare::Verdict::kMissing);
+}
+
+TEST(BenchCompare, FallsBackToThresholdWithFewRepetitions) {
+    const std::vector<bench_compare::BenchmarkSamples> base{{"single", {100}}};
+    const std::vector<bench_compare::BenchmarkSamples> cand{{"single", {90}}};
+    const auto results = bench_compare::compare(base, cand, {});
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_FALSE(results[0].tested);
+    EXPECT_EQ(results[0].verdict, bench_compare::Verdict::kImproved);
+}
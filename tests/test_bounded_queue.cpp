@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <optional>
 #include <thread>
 #include <vector>
 
 #include "platform/bounded_queue.hpp"
+#include "platform/metrics.hpp"
 
 TEST(BoundedQueue, PushPopRoundTrip) {
     platform::BoundedQueue<int> q(4);
@@ -43,3 +46,79 @@ TEST(BoundedQueue, MultiThreaded) {
     EXPECT_GT(total, 0);
 }
 
+
+TEST(BoundedQueue, TryPushNeverBlocksAndHonoursLimit) {
+    platform::BoundedQueue<int> q(4);
+    EXPECT_TRUE(q.try_push(1, 2));
+    EXPECT_TRUE(q.try_push(2, 2));
+    EXPECT_FALSE(q.try_push(3, 2)); // below capacity but at the caller's limit
+    EXPECT_TRUE(q.try_push(3));
+    EXPECT_TRUE(q.try_push(4));
+    EXPECT_FALSE(q.try_push(5));
+    EXPECT_EQ(q.size(), 4u);
+    q.close();
+    q.pop();
+    EXPECT_FALSE(q.try_push(6));
+}
+
+TEST(BoundedQueue, PushEvictOldestKeepsTheNewest) {
+    platform::BoundedQueue<int> q(2);
+    bool evicted = true;
+    EXPECT_TRUE(q.push_evict_oldest(1, evicted));
+    EXPECT_FALSE(evicted);
+    q.push_evict_oldest(2, evicted);
+    EXPECT_TRUE(q.push_evict_oldest(3, evicted));
+    EXPECT_TRUE(evicted);
+    EXPECT_EQ(q.pop(), 2);
+    EXPECT_EQ(q.pop(), 3);
+    q.close();
+    EXPECT_FALSE(q.push_evict_oldest(4, evicted));
+}
+
+TEST(BoundedQueue, PushEvictOldestRefusesAZeroCapacityQueue) {
+    platform::BoundedQueue<int> q(0);
+    bool evicted = true;
+    EXPECT_FALSE(q.push_evict_oldest(1, evicted));
+    EXPECT_FALSE(evicted);
+    EXPECT_EQ(q.size(), 0u);
+}
+
+TEST(BoundedQueue, EveryWaitStrategyDeliversInOrderAndSeesClose) {
+    using platform::WaitMode;
+    for (const auto mode : {WaitMode::kBlock, WaitMode::kSpinThenPark, WaitMode::kSpin}) {
+        platform::BoundedQueue<int> q(4, {.mode = mode, .spin = std::chrono::microseconds(20)});
+        std::vector<int> seen;
+        std::jthread consumer([&q, &seen] {
+            while (auto v = q.pop()) {
+                seen.push_back(*v);
+            }
+        });
+        for (int i = 0; i < 200; ++i) {
+            ASSERT_TRUE(q.push(i));
+            if (i % 50 == 0) {
+                // Let the consumer run dry so it spins, and for spin_park parks, before the next item.
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        q.close();
+        consumer.join();
+        ASSERT_EQ(seen.size(), 200u) << platform::to_string(mode);
+        for (int i = 0; i < 200; ++i) {
+            EXPECT_EQ(seen[static_cast<std::size_t>(i)], i);
+        }
+    }
+}
+
+TEST(BoundedQueue, StopTokenEndsASpinningPop) {
+    platform::BoundedQueue<int> q(1, {.mode = platform::WaitMode::kSpin});
+    platform::MetricsRegistry registry;
+    q.bind_metrics(registry, "q");
+    std::optional<int> result{0};
+    std::jthread consumer([&q, &result](std::stop_token st) { result = q.pop(st); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    consumer.request_stop();
+    consumer.join();
+    EXPECT_FALSE(result.has_value());
+    // The spin counts as waiting even though the consumer never parked.
+    EXPECT_EQ(registry.snapshot().find_histogram("q_pop_wait_ns")->data.count, 1u);
+}
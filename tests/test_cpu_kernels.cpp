@@ -0,0 +1,179 @@
+// test_cpu_kernels.cpp - parity of every kernel, ISA and threading mode against the references.
+#include "platform/cpu_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<float> random_floats(std::size_t n, unsigned seed) {
+        std::mt19937 rng{seed};
+        std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+        std::vector<float> v(n);
+        for (auto &x : v) {
+            x = dist(rng);
+        }
+        return v;
+    }
+
+    // Every supported ISA, single-threaded and on a pool with chunks small enough to split the test inputs.
+    std::vector<platform::KernelOptions> all_modes(platform::ThreadPool &pool) {
+        std::vector<platform::KernelOptions> modes;
+        for (auto isa : {platform::SimdIsa::kScalar, platform::SimdIsa::kSse2, platform::SimdIsa::kAvx2,
+                         platform::SimdIsa::kAvx512, platform::SimdIsa::kNeon}) {
+            if (!platform::simd_isa_supported(isa)) {
+                continue;
+            }
+            platform::KernelOptions serial;
+            serial.isa = isa;
+            modes.push_back(serial);
+            platform::KernelOptions parallel        = serial;
+            parallel.pool                           = &pool;
+            parallel.parallel.min_parallel_elements = 1;
+            parallel.parallel.chunk_elements        = 1000;
+            modes.push_back(parallel);
+        }
+        return modes;
+    }
+
+    std::string describe(const platform::KernelOptions &options) {
+        return std::string(platform::to_string(options.isa.value_or(platform::active_simd_isa()))) +
+               (options.pool != nullptr ? "/pool" : "/serial");
+    }
+
+    void expect_near_all(const std::vector<float> &got, const std::vector<float> &expected, float tolerance,
+                         const std::string &what) {
+        ASSERT_EQ(got.size(), expected.size()) << what;
+        for (std::size_t i = 0; i < got.size(); ++i) {
+            ASSERT_NEAR(got[i], expected[i], tolerance * (1.0f + std::abs(expected[i]))) << what << " i=" << i;
+        }
+    }
+
+    constexpr std::size_t kSizes[] = {0, 1, 7, 17, 63, 1000, 4097, 100'003};
+} // namespace
+
+TEST(CpuKernels, ReductionsMatchReference) {
+    platform::ThreadPool pool(3);
+    for (std::size_t n : kSizes) {
+        const auto x = random_floats(n, 1);
+        const auto y = random_floats(n, 2);
+        double magnitude = 0.0;
+        for (float v : x) {
+            magnitude += std::abs(v);
+        }
+        // Reassociated float sums stay within a small multiple of eps * sum|x|.
+        const double tolerance = 1e-5 * magnitude + 1e-6;
+        for (const auto &mode : all_modes(pool)) {
+            EXPECT_NEAR(platform::reduce_sum(x, mode), platform::reference::reduce_sum(x), tolerance)
+                << describe(mode) << " n=" << n;
+            EXPECT_EQ(platform::reduce_max(x, mode), platform::reference::reduce_max(x)) << describe(mode);
+            EXPECT_NEAR(platform::dot(x, y, mode), platform::reference::dot(x, y), tolerance)
+                << describe(mode) << " n=" << n;
+        }
+    }
+}
+
+TEST(CpuKernels, ScanMatchesReferenceAndWorksInPlace) {
+    platform::ThreadPool pool(3);
+    for (std::size_t n : kSizes) {
+        // Non-negative inputs keep the running sum monotonic so relative tolerance is meaningful.
+        auto x = random_floats(n, 3);
+        for (auto &v : x) {
+            v = std::abs(v);
+        }
+        std::vector<float> expected(n);
+        ASSERT_TRUE(platform::reference::inclusive_scan(x, expected));
+        for (const auto &mode : all_modes(pool)) {
+            std::vector<float> out(n);
+            ASSERT_TRUE(platform::inclusive_scan(x, out, mode));
+            expect_near_all(out, expected, 1e-5f, describe(mode) + " n=" + std::to_string(n));
+
+            auto in_place = x;
+            ASSERT_TRUE(platform::inclusive_scan(in_place, in_place, mode));
+            expect_near_all(in_place, expected, 1e-5f, describe(mode) + " in place");
+        }
+    }
+    std::vector<float> in(4), out(3);
+    EXPECT_FALSE(platform::inclusive_scan(in, out));
+}
+
+TEST(CpuKernels, ElementwiseKernelsMatchReference) {
+    platform::ThreadPool pool(3);
+    const std::vector<platform::AffineStep> steps{{1.5f, -0.25f}, {0.5f, 2.0f}, {-2.0f, 0.125f}};
+    for (std::size_t n : kSizes) {
+        const auto x = random_floats(n, 4);
+        const auto y = random_floats(n, 5);
+        std::vector<float> saxpy_expected = y;
+        ASSERT_TRUE(platform::reference::saxpy(0.75f, x, saxpy_expected));
+        std::vector<float> affine_expected(n);
+        ASSERT_TRUE(platform::reference::fused_affine(x, steps, affine_expected));
+        for (const auto &mode : all_modes(pool)) {
+            auto got = y;
+            ASSERT_TRUE(platform::saxpy(0.75f, x, got, mode));
+            expect_near_all(got, saxpy_expected, 1e-6f, describe(mode) + " saxpy");
+
+            std::vector<float> fused(n);
+            ASSERT_TRUE(platform::fused_affine(x, steps, fused, mode));
+            expect_near_all(fused, affine_expected, 1e-6f, describe(mode) + " affine");
+        }
+    }
+    std::vector<float> x(8), y(7);
+    EXPECT_FALSE(platform::saxpy(1.0f, x, y));
+    EXPECT_FALSE(platform::fused_affine(x, steps, y));
+}
+
+TEST(CpuKernels, ConvolutionsMatchReference) {
+    platform::ThreadPool pool(3);
+    const auto taps = random_floats(9, 6);
+    for (std::size_t n : {9u, 10u, 40u, 1000u, 100'003u}) {
+        const auto x = random_floats(n, 7);
+        std::vector<float> expected(n - taps.size() + 1);
+        ASSERT_TRUE(platform::reference::conv1d(x, taps, expected));
+        for (const auto &mode : all_modes(pool)) {
+            std::vector<float> got(expected.size());
+            ASSERT_TRUE(platform::conv1d(x, taps, got, mode));
+            expect_near_all(got, expected, 1e-5f, describe(mode) + " conv1d n=" + std::to_string(n));
+        }
+    }
+
+    // 3x3 and 5x2 kernels over images whose widths exercise full vectors and ragged tails.
+    struct Shape {
+        std::size_t width, height, kernel_width, kernel_height;
+    };
+    for (const Shape s : {Shape{3, 3, 3, 3}, Shape{37, 11, 3, 3}, Shape{640, 120, 5, 2}}) {
+        const auto image  = random_floats(s.width * s.height, 8);
+        const auto kernel = random_floats(s.kernel_width * s.kernel_height, 9);
+        std::vector<float> expected((s.width - s.kernel_width + 1) * (s.height - s.kernel_height + 1));
+        ASSERT_TRUE(platform::reference::conv2d(image, s.width, kernel, s.kernel_width, expected));
+        for (const auto &mode : all_modes(pool)) {
+            std::vector<float> got(expected.size());
+            ASSERT_TRUE(platform::conv2d(image, s.width, kernel, s.kernel_width, got, mode));
+            expect_near_all(got, expected, 1e-5f, describe(mode) + " conv2d w=" + std::to_string(s.width));
+        }
+    }
+
+    std::vector<float> x(4), out(4);
+    EXPECT_FALSE(platform::conv1d(x, random_floats(5, 1), out));
+    EXPECT_FALSE(platform::conv2d(x, 3, random_floats(1, 1), 1, out)); // 4 is not a multiple of 3
+    EXPECT_FALSE(platform::conv2d(x, 2, random_floats(3, 1), 3, out)); // kernel wider than image
+}
+
+TEST(CpuKernels, StencilMatchesReferenceAndCopiesBorders) {
+    platform::ThreadPool pool(3);
+    const platform::Stencil5 weights{0.5f, 0.125f, 0.125f, 0.125f, 0.125f};
+    for (const auto [width, height] : {std::pair<std::size_t, std::size_t>{1, 5}, {2, 2}, {3, 3}, {33, 17},
+                                       {512, 300}}) {
+        const auto image = random_floats(width * height, 10);
+        std::vector<float> expected(image.size());
+        ASSERT_TRUE(platform::reference::stencil5(image, width, weights, expected));
+        for (const auto &mode : all_modes(pool)) {
+            std::vector<float> got(image.size());
+            ASSERT_TRUE(platform::stencil5(image, width, weights, got, mode));
+            expect_near_all(got, expected, 1e-6f, describe(mode) + " stencil w=" + std::to_string(width));
+            EXPECT_EQ(got.front(), image.front());
+            EXPECT_EQ(got.back(), image.back());
+        }
+    }
+}
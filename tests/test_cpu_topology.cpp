@@ -0,0 +1,73 @@
+// test_cpu_topology.cpp - CPU list parsing and intersection, topology consistency, and pinning/naming the caller.
+#include "platform/cpu_topology.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+TEST(CpuTopology, ParsesKernelCpuLists) {
+    EXPECT_EQ(platform::parse_cpu_list("0-3,8,10-11"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(platform::parse_cpu_list("5,1,1\n"), (std::vector<int>{1, 5}));
+    EXPECT_EQ(platform::parse_cpu_list(""), std::vector<int>{});
+    EXPECT_FALSE(platform::parse_cpu_list("3-1"));
+    EXPECT_FALSE(platform::parse_cpu_list("1-"));
+    EXPECT_FALSE(platform::parse_cpu_list("0,,2"));
+    EXPECT_FALSE(platform::parse_cpu_list("cpu0"));
+}
+
+TEST(CpuTopology, RejectsCpuIdsBeyondTheOsLimit) {
+    EXPECT_FALSE(platform::parse_cpu_list("0,99999999"));
+    EXPECT_FALSE(platform::parse_cpu_list("0-99999999"));
+    EXPECT_FALSE(platform::parse_cpu_list("0-2147483647"));
+    EXPECT_FALSE(platform::parse_cpu_list("4294967296"));
+    const auto last = platform::parse_cpu_list("1023");
+    ASSERT_TRUE(last);
+    EXPECT_EQ(*last, std::vector<int>{1023});
+}
+
+TEST(CpuTopology, IntersectsSortedCpuLists) {
+    const std::vector<int> node{0, 1, 2, 3};
+    const std::vector<int> allowed{1, 3, 5};
+    EXPECT_EQ(platform::intersect_cpus(node, allowed), (std::vector<int>{1, 3}));
+    EXPECT_EQ(platform::intersect_cpus(node, {}), std::vector<int>{});
+}
+
+TEST(CpuTopology, NodesPartitionTheUsableCpus) {
+    const auto &topology = platform::cpu_topology();
+    ASSERT_FALSE(topology.usable.empty());
+    ASSERT_FALSE(topology.nodes.empty());
+    std::vector<int> all;
+    for (std::size_t node = 0; node < topology.nodes.size(); ++node) {
+        for (const int cpu : topology.nodes[node]) {
+            all.push_back(cpu);
+            EXPECT_EQ(topology.node_of(cpu), node);
+        }
+    }
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(all, topology.usable);
+}
+
+#ifdef __linux__
+TEST(CpuTopology, PinsAndNamesTheCallingThread) {
+    const int target = platform::cpu_topology().usable.back();
+    std::thread t([target] {
+        const std::vector<int> cpus{target};
+        ASSERT_TRUE(platform::pin_current_thread(cpus));
+        EXPECT_EQ(platform::current_cpu(), target);
+        EXPECT_FALSE(platform::pin_current_thread({}));
+
+        platform::name_current_thread("platform-worker-with-a-long-name");
+        char name[16] = {};
+        ASSERT_EQ(pthread_getname_np(pthread_self(), name, sizeof(name)), 0);
+        EXPECT_EQ(std::string(name), "platform-worker");
+    });
+    t.join();
+}
+#endif
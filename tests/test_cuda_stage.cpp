@@ -1,6 +1,14 @@
 #include <gtest/gtest.h>
 
+#include "platform/aligned_buffer.hpp"
 #include "platform/cuda_stage.hpp"
+#include "platform/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
 
 TEST(CudaStage, CpuReference) {
     std::vector<float> a{1, 2, 3};
@@ -12,6 +20,110 @@ TEST(CudaStage, CpuReference) {
     EXPECT_FLOAT_EQ(out[2], 9.0f);
 }
 
+TEST(CudaStage, CpuReferenceReusesOutput) {
+    std::vector<float> a(64, 1.0f);
+    std::vector<float> b(64, 2.0f);
+    std::vector<float> out(64);
+    const float *storage = out.data();
+    platform::vector_add_cpu(a, b, out);
+    EXPECT_EQ(out.data(), storage);
+    EXPECT_FLOAT_EQ(out[63], 3.0f);
+}
+
+TEST(CudaStage, EveryIsaMatchesScalar) {
+    // Sizes straddle every vector width and tail path; the offset forces unaligned loads.
+    for (std::size_t n : {0u, 1u, 3u, 4u, 7u, 8u, 15u, 16u, 17u, 31u, 33u, 1000u, 1027u}) {
+        for (std::size_t offset : {0u, 1u}) {
+            platform::AlignedBuffer<float> a(n + offset), b(n + offset);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                a[i] = static_cast<float>(i) * 0.5f;
+                b[i] = 1.0f - static_cast<float>(i);
+            }
+            const auto as = a.span().subspan(offset);
+            const auto bs = b.span().subspan(offset);
+            std::vector<float> expected(n);
+            ASSERT_TRUE(platform::vector_add_cpu(as, bs, expected, platform::SimdIsa::kScalar));
+            for (auto isa : {platform::SimdIsa::kSse2, platform::SimdIsa::kAvx2, platform::SimdIsa::kAvx512,
+                             platform::SimdIsa::kNeon}) {
+                if (!platform::simd_isa_supported(isa)) {
+                    continue;
+                }
+                // One sentinel past the end catches stores that overrun the tail.
+                std::vector<float> got(n + 1, -7.0f);
+                ASSERT_TRUE(platform::vector_add_cpu(as, bs, std::span<float>(got).first(n), isa));
+                for (std::size_t i = 0; i < n; ++i) {
+                    ASSERT_EQ(got[i], expected[i]) << platform::to_string(isa) << " n=" << n << " i=" << i;
+                }
+                EXPECT_EQ(got[n], -7.0f) << platform::to_string(isa) << " n=" << n;
+            }
+        }
+    }
+}
+
+TEST(CudaStage, SpanKernelRejectsShortOutputAndUnsupportedIsa) {
+    std::vector<float> a(8, 1.0f), b(8, 1.0f), out(4, 0.0f);
+    EXPECT_FALSE(platform::vector_add_cpu(a, b, std::span<float>(out)));
+    EXPECT_EQ(out[0], 0.0f);
+    for (auto isa : {platform::SimdIsa::kAvx512, platform::SimdIsa::kNeon}) {
+        if (!platform::simd_isa_supported(isa)) {
+            std::vector<float> full(8);
+            EXPECT_FALSE(platform::vector_add_cpu(a, b, full, isa));
+        }
+    }
+    EXPECT_TRUE(platform::simd_isa_supported(platform::active_simd_isa()));
+    EXPECT_EQ(platform::parse_simd_isa("avx2"), platform::SimdIsa::kAvx2);
+    EXPECT_FALSE(platform::parse_simd_isa("mmx").has_value());
+}
+
+TEST(CudaStage, ParallelMatchesSerial) {
+    platform::ThreadPool pool(3);
+    platform::ParallelOptions options;
+    options.min_parallel_elements = 1024;
+    // Below the threshold, one ragged chunk, many ragged chunks, and an explicit chunk size.
+    for (std::size_t n : {100u, 5000u, 200'003u}) {
+        std::vector<float> a(n), b(n), serial(n), parallel(n, -1.0f);
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<float>(i % 97);
+            b[i] = static_cast<float>(i % 13) * 0.25f;
+        }
+        ASSERT_TRUE(platform::vector_add_cpu(a, b, std::span<float>(serial)));
+        ASSERT_TRUE(platform::vector_add_cpu(pool, a, b, parallel, options));
+        EXPECT_EQ(parallel, serial) << "n=" << n;
+
+        auto fixed           = options;
+        fixed.chunk_elements = 1000;
+        std::fill(parallel.begin(), parallel.end(), -1.0f);
+        ASSERT_TRUE(platform::vector_add_cpu(pool, a, b, parallel, fixed));
+        EXPECT_EQ(parallel, serial) << "n=" << n << " fixed chunks";
+    }
+
+    std::vector<float> a(10), b(10), out(5);
+    EXPECT_FALSE(platform::vector_add_cpu(pool, a, b, out, options));
+}
+
+TEST(CudaStage, ParallelFromInsidePoolJobDoesNotDeadlock) {
+    // A single worker that is itself the caller: every chunk must still complete.
+    platform::ThreadPool pool(1);
+    platform::ParallelOptions options;
+    options.min_parallel_elements = 1;
+    options.chunk_elements        = 1024;
+    std::vector<float> a(100'000, 1.0f), b(100'000, 2.0f), out(100'000);
+    std::atomic<bool> ok{false};
+    std::atomic<bool> done{false};
+    ASSERT_TRUE(pool.enqueue([&]() {
+        ok.store(platform::vector_add_cpu(pool, a, b, out, options));
+        done.store(true);
+    }));
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!done.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(done.load());
+    EXPECT_TRUE(ok.load());
+    EXPECT_FLOAT_EQ(out.front(), 3.0f);
+    EXPECT_FLOAT_EQ(out.back(), 3.0f);
+}
+
 #ifdef PLATFORM_ENABLE_CUDA
 TEST(CudaStage, GpuMatchesCpu) {
     std::vector<float> a(1024, 1.0f);
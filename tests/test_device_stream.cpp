@@ -0,0 +1,58 @@
+// test_device_stream.cpp - CPU stream ordering and batched streamed vector add.
+#include "platform/device_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+TEST(DeviceStream, CpuStreamRunsOperationsInOrder) {
+    auto stream = platform::make_stream(platform::StreamBackend::kCpu);
+    ASSERT_EQ(stream->backend(), platform::StreamBackend::kCpu);
+
+    const std::size_t n = 1000;
+    std::vector<float> a(n, 1.0f), b(n, 2.0f), out(n, 0.0f);
+    std::vector<float> da(n), db(n), dout(n);
+    stream->copy_to_device(da.data(), a.data(), n * sizeof(float));
+    stream->copy_to_device(db.data(), b.data(), n * sizeof(float));
+    stream->vector_add(da.data(), db.data(), dout.data(), n);
+    stream->copy_to_host(out.data(), dout.data(), n * sizeof(float));
+    ASSERT_TRUE(stream->synchronize());
+    for (float v : out) {
+        ASSERT_EQ(v, 3.0f);
+    }
+}
+
+TEST(DeviceStream, StreamedVectorAddMatchesAcrossBatches) {
+    platform::StreamedVectorAdd runner(platform::StreamBackend::kCpu, {.streams = 3, .batch_elements = 1000});
+    const std::size_t n = 10'501;
+    std::vector<float> a(n), b(n), out(n, -1.0f);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = static_cast<float>(i);
+        b[i] = 0.5f;
+    }
+    ASSERT_TRUE(runner.run(a.data(), b.data(), out.data(), n));
+    for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(out[i], a[i] + b[i]) << i;
+    }
+}
+
+TEST(DeviceStream, SteadyStateRunsDoNotAllocate) {
+    platform::StreamedVectorAdd runner(platform::StreamBackend::kCuda, {.streams = 2, .batch_elements = 4096});
+    const std::size_t n = 20'000;
+    std::vector<float> a(n, 1.0f), b(n, 1.0f), out(n);
+    ASSERT_TRUE(runner.run(a.data(), b.data(), out.data(), n));
+    const auto device  = runner.device_pool().stats();
+    const auto staging = runner.staging_pool().stats();
+    EXPECT_EQ(device.upstream_allocations, 2u);
+    EXPECT_EQ(staging.upstream_allocations, 2u);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(runner.run(a.data(), b.data(), out.data(), n));
+    }
+    EXPECT_EQ(runner.device_pool().stats().upstream_allocations, device.upstream_allocations);
+    EXPECT_EQ(runner.staging_pool().stats().upstream_allocations, staging.upstream_allocations);
+    EXPECT_EQ(runner.device_pool().stats().hits, 6u);
+    EXPECT_EQ(runner.device_pool().stats().bytes_in_use, 0u);
+    EXPECT_EQ(out.back(), 2.0f);
+}
@@ -0,0 +1,76 @@
+// test_expr.cpp - fused expression evaluation against hand-written loops, per ISA and in parallel.
+#include "platform/expr.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "platform/thread_pool.hpp"
+
+using namespace platform::expr;
+
+namespace {
+    std::vector<float> ramp(std::size_t n, float scale, float offset) {
+        std::vector<float> v(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            v[i] = static_cast<float>(i % 97) * scale + offset;
+        }
+        return v;
+    }
+} // namespace
+
+TEST(Expr, FusesMixedOperationsPerIsa) {
+    const std::size_t n = 1003;
+    const auto a = ramp(n, 0.5f, -3.0f), b = ramp(n, -0.25f, 1.0f), c = ramp(n, 0.125f, 2.0f);
+    const auto e = clamp(abs(view(a) + view(b) * view(c)) / 2.0f - 1.0f, -4.0f, max(view(c), 3.0f));
+
+    for (auto isa : {platform::SimdIsa::kScalar, platform::SimdIsa::kSse2, platform::SimdIsa::kAvx2,
+                     platform::SimdIsa::kAvx512, platform::SimdIsa::kNeon}) {
+        if (!platform::simd_isa_supported(isa)) {
+            continue;
+        }
+        std::vector<float> out(n, -99.0f);
+        ASSERT_TRUE(eval(e, out, {.isa = isa}));
+        for (std::size_t i = 0; i < n; ++i) {
+            const float hi       = std::fmax(c[i], 3.0f);
+            const float expected = std::fmin(std::fmax(std::fabs(a[i] + b[i] * c[i]) / 2.0f - 1.0f, -4.0f), hi);
+            ASSERT_NEAR(out[i], expected, 1e-5f) << platform::to_string(isa) << " at " << i;
+        }
+    }
+}
+
+TEST(Expr, SizeIsShortestOperandAndOutputIsChecked) {
+    const std::vector<float> a(10, 1.0f), b(7, 2.0f);
+    const auto e = view(a) - view(b);
+    EXPECT_EQ(e.size(), 7u);
+
+    std::vector<float> short_out(6);
+    EXPECT_FALSE(eval(e, short_out));
+    std::vector<float> out(8, 0.0f);
+    ASSERT_TRUE(eval(e, out));
+    EXPECT_EQ(out[6], -1.0f);
+    EXPECT_EQ(out[7], 0.0f);
+
+    EXPECT_FALSE(eval(Scalar{{}, 1.0f} + 2.0f, out));
+}
+
+TEST(Expr, OutputMayAliasAnOperand) {
+    std::vector<float> x = ramp(4096, 1.0f, 0.0f);
+    const auto expected  = ramp(4096, 2.0f, 1.0f);
+    ASSERT_TRUE(eval(view(x) * 2.0f + 1.0f, x));
+    EXPECT_EQ(x, expected);
+}
+
+TEST(Expr, ParallelMatchesSerial) {
+    const std::size_t n = (1 << 18) + 5;
+    const auto a = ramp(n, 0.5f, 1.0f), b = ramp(n, 2.0f, -1.0f);
+    const auto e = -(view(a) * view(b)) + view(a);
+
+    std::vector<float> serial(n), parallel(n);
+    ASSERT_TRUE(eval(e, serial));
+    platform::ThreadPool pool(3);
+    ASSERT_TRUE(eval(e, parallel, {.pool = &pool, .parallel = {.min_parallel_elements = 1024}}));
+    EXPECT_EQ(serial, parallel);
+}
@@ -0,0 +1,73 @@
+// test_latency_histogram.cpp - percentile accuracy, merge and fixed-memory checks.
+#include "platform/latency_histogram.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST(LatencyHistogram, PercentilesMatchSortWithinPrecision) {
+    platform::LatencyHistogram hist(10'000'000, 2);
+    std::vector<std::uint64_t> samples;
+    std::mt19937_64 rng{42};
+    std::lognormal_distribution<double> dist{11.0, 0.6};
+    for (int i = 0; i < 20000; ++i) {
+        const auto v = static_cast<std::uint64_t>(dist(rng));
+        samples.push_back(v);
+        hist.record(v);
+    }
+    std::sort(samples.begin(), samples.end());
+    for (double p : {50.0, 90.0, 95.0, 99.0, 99.9}) {
+        // Nearest-rank definition, as used by the histogram.
+        const auto idx      = static_cast<std::size_t>(std::ceil(p / 100.0 * static_cast<double>(samples.size()))) - 1;
+        const auto expected = static_cast<double>(samples[idx]);
+        EXPECT_NEAR(static_cast<double>(hist.percentile(p)), expected, expected * 0.01) << "p" << p;
+    }
+    EXPECT_EQ(hist.min(), samples.front());
+    EXPECT_EQ(hist.max(), samples.back());
+    EXPECT_EQ(hist.percentile(100.0), samples.back());
+}
+
+TEST(LatencyHistogram, MatchesModule05KnownDataset) {
+    platform::LatencyHistogram hist(1000, 3);
+    for (std::uint64_t v : {10, 20, 30, 40, 50, 60, 70, 80, 90, 100}) {
+        hist.record(v);
+    }
+    EXPECT_EQ(hist.percentile(50.0), 50u);
+    EXPECT_EQ(hist.percentile(95.0), 100u);
+    EXPECT_DOUBLE_EQ(hist.mean(), 55.0);
+}
+
+TEST(LatencyHistogram, MergeCombinesPerThreadInstances) {
+    platform::LatencyHistogram a;
+    platform::LatencyHistogram b;
+    a.record(std::chrono::microseconds(10));
+    b.record(std::chrono::microseconds(30));
+    ASSERT_TRUE(a.merge(b));
+    EXPECT_EQ(a.count(), 2u);
+    EXPECT_EQ(a.min(), 10'000u);
+    EXPECT_EQ(a.max(), 30'000u);
+    EXPECT_DOUBLE_EQ(a.mean(), 20'000.0);
+
+    platform::LatencyHistogram other_precision(platform::LatencyHistogram::kDefaultHighest, 3);
+    EXPECT_FALSE(a.merge(other_precision));
+    EXPECT_EQ(a.count(), 2u);
+}
+
+TEST(LatencyHistogram, MemoryIsFixedAndOverflowSaturates) {
+    platform::LatencyHistogram hist(1'000'000, 2);
+    const auto bytes = hist.memory_bytes();
+    for (std::uint64_t v = 0; v < 100'000; ++v) {
+        hist.record(v * 97);
+    }
+    EXPECT_EQ(hist.memory_bytes(), bytes);
+    EXPECT_GT(hist.saturated(), 0u);
+    EXPECT_EQ(hist.max(), 1'000'000u);
+
+    hist.reset();
+    EXPECT_EQ(hist.count(), 0u);
+    EXPECT_EQ(hist.percentile(50.0), 0u);
+}
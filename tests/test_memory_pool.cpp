@@ -0,0 +1,76 @@
+// test_memory_pool.cpp - size classes, cache reuse, trim and metrics of the caching pool.
+#include "platform/memory_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "platform/metrics.hpp"
+
+TEST(MemoryPool, SizeClassesRoundUp) {
+    using platform::CachingMemoryPool;
+    EXPECT_EQ(CachingMemoryPool::size_class(1), 256u);
+    EXPECT_EQ(CachingMemoryPool::size_class(256), 256u);
+    EXPECT_EQ(CachingMemoryPool::size_class(257), 512u);
+    EXPECT_EQ(CachingMemoryPool::size_class(1u << 20), 1u << 20);
+    EXPECT_EQ(CachingMemoryPool::size_class((1u << 20) + 1), 2u << 20);
+    EXPECT_EQ(CachingMemoryPool::size_class((5u << 20) - 3), 5u << 20);
+}
+
+TEST(MemoryPool, ReleasedBlocksAreReused) {
+    platform::CachingMemoryPool pool(platform::host_upstream());
+    void *first = nullptr;
+    {
+        auto block = pool.acquire(1000);
+        ASSERT_TRUE(block);
+        EXPECT_EQ(block.size(), 1024u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block.data()) % 4096, 0u);
+        first = block.data();
+    }
+    auto again = pool.acquire(900);
+    EXPECT_EQ(again.data(), first);
+
+    const auto stats = pool.stats();
+    EXPECT_EQ(stats.requests, 2u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.upstream_allocations, 1u);
+    EXPECT_EQ(stats.bytes_in_use, 1024u);
+    EXPECT_EQ(stats.bytes_cached, 0u);
+}
+
+TEST(MemoryPool, MovedBlockReturnsOnce) {
+    platform::CachingMemoryPool pool(platform::host_upstream());
+    auto a = pool.acquire(300);
+    auto b = std::move(a);
+    EXPECT_FALSE(a);
+    b.reset();
+    b.reset();
+    EXPECT_EQ(pool.stats().bytes_cached, 512u);
+    EXPECT_FALSE(pool.acquire(0));
+}
+
+TEST(MemoryPool, TrimReleasesOnlyCachedBlocks) {
+    platform::CachingMemoryPool pool(platform::host_upstream());
+    auto held = pool.acquire(4096);
+    pool.acquire(4096).reset();
+    EXPECT_EQ(pool.stats().bytes_cached, 4096u);
+    pool.trim();
+    EXPECT_EQ(pool.stats().bytes_cached, 0u);
+    EXPECT_EQ(pool.stats().bytes_in_use, 4096u);
+    pool.acquire(4096).reset();
+    EXPECT_EQ(pool.stats().upstream_allocations, 3u);
+}
+
+TEST(MemoryPool, PublishesMetrics) {
+    platform::MetricsRegistry registry;
+    platform::CachingMemoryPool pool(platform::host_upstream());
+    pool.bind_metrics(registry, "staging");
+    pool.acquire(2048).reset();
+    auto held = pool.acquire(2048);
+    EXPECT_EQ(registry.counter("staging_requests_total").value(), 2u);
+    EXPECT_EQ(registry.counter("staging_hits_total").value(), 1u);
+    EXPECT_EQ(registry.counter("staging_upstream_allocations_total").value(), 1u);
+    EXPECT_EQ(registry.gauge("staging_bytes_in_use").value(), 2048);
+    EXPECT_EQ(registry.gauge("staging_bytes_cached").value(), 0);
+}
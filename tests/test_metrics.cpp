@@ -0,0 +1,112 @@
+// test_metrics.cpp - metrics registry, histogram and component binding checks.
+#include "platform/metrics.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "platform/bounded_queue.hpp"
+#include "platform/message_bus.hpp"
+#include "platform/thread_pool.hpp"
+
+TEST(Metrics, CounterMergesShardsAcrossThreads) {
+    platform::Counter counter;
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&counter]() {
+                for (int i = 0; i < 1000; ++i) {
+                    counter.add();
+                }
+            });
+        }
+    }
+    EXPECT_EQ(counter.value(), 8000u);
+}
+
+TEST(Metrics, GaugeSetAndAdd) {
+    platform::Gauge gauge;
+    gauge.set(10);
+    gauge.add(-3);
+    EXPECT_EQ(gauge.value(), 7);
+}
+
+TEST(Metrics, HistogramQuantilesWithinBucketError) {
+    platform::Histogram hist;
+    for (std::uint64_t v = 1; v <= 1000; ++v) {
+        hist.record(v);
+    }
+    const auto snap = hist.snapshot();
+    EXPECT_EQ(snap.count, 1000u);
+    EXPECT_EQ(snap.min, 1u);
+    EXPECT_EQ(snap.max, 1000u);
+    EXPECT_DOUBLE_EQ(snap.mean(), 500.5);
+    const double tolerance = 1.0 / platform::Histogram::kSubBuckets;
+    EXPECT_NEAR(static_cast<double>(snap.quantile(0.5)), 500.0, 500.0 * tolerance);
+    EXPECT_NEAR(static_cast<double>(snap.quantile(0.99)), 990.0, 990.0 * tolerance);
+    EXPECT_EQ(snap.quantile(1.0), 1000u);
+}
+
+TEST(Metrics, HistogramBucketBoundsAreContiguous) {
+    for (std::uint64_t v : {0ull, 7ull, 8ull, 9ull, 1023ull, 1024ull, 123456789ull, ~0ull}) {
+        const auto idx = platform::Histogram::bucket_index(v);
+        EXPECT_GE(platform::Histogram::bucket_upper_bound(idx), v);
+        if (idx > 0) {
+            EXPECT_LT(platform::Histogram::bucket_upper_bound(idx - 1), v);
+        }
+    }
+}
+
+TEST(Metrics, RegistryReturnsSameInstanceAndRendersText) {
+    platform::MetricsRegistry registry;
+    registry.counter("jobs_total").add(3);
+    registry.counter("jobs_total").add(2);
+    registry.gauge("depth").set(4);
+    registry.histogram(R"(latency_ns{stage="perception"})").record(100);
+
+    const auto snap = registry.snapshot();
+    ASSERT_NE(snap.find_counter("jobs_total"), nullptr);
+    EXPECT_EQ(snap.find_counter("jobs_total")->value, 5u);
+
+    const auto text = registry.render_text();
+    EXPECT_NE(text.find("# TYPE jobs_total counter\njobs_total 5\n"), std::string::npos);
+    EXPECT_NE(text.find("depth 4\n"), std::string::npos);
+    EXPECT_NE(text.find(R"(latency_ns{stage="perception",quantile="0.5"} 100)"), std::string::npos);
+    EXPECT_NE(text.find(R"(latency_ns_count{stage="perception"} 1)"), std::string::npos);
+}
+
+TEST(Metrics, ComponentsPublishMetrics) {
+    platform::MetricsRegistry registry;
+
+    platform::BoundedQueue<int> queue(4);
+    queue.bind_metrics(registry, "q");
+    queue.push(1);
+    queue.push(2);
+    EXPECT_EQ(registry.gauge("q_depth").value(), 2);
+
+    platform::MessageBus bus;
+    bus.subscribe("topic", [](const platform::Message &) {});
+    bus.bind_metrics(registry, "bus");
+    bus.subscribe("topic", [](const platform::Message &) {});
+    bus.publish("topic", "data");
+    EXPECT_EQ(registry.counter(R"(bus_published_total{topic="topic"})").value(), 1u);
+    EXPECT_EQ(registry.counter(R"(bus_deliveries_total{topic="topic"})").value(), 2u);
+    EXPECT_EQ(registry.gauge(R"(bus_subscribers{topic="topic"})").value(), 2);
+
+    {
+        platform::ThreadPool pool(2, 16);
+        pool.bind_metrics(registry, "pool");
+        std::atomic<int> done{0};
+        for (int i = 0; i < 10; ++i) {
+            ASSERT_TRUE(pool.enqueue([&done]() { done.fetch_add(1); }));
+        }
+        while (done.load() < 10) {
+            std::this_thread::yield();
+        }
+        pool.shutdown();
+    }
+    EXPECT_EQ(registry.counter("pool_jobs_total").value(), 10u);
+    EXPECT_EQ(registry.gauge("pool_queue_depth").value(), 0);
+}
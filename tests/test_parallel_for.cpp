@@ -0,0 +1,85 @@
+// test_parallel_for.cpp - chunk sizing, coverage and nesting of the pool-backed loops.
+#include "platform/parallel_for.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "platform/cpu_features.hpp"
+
+TEST(ParallelFor, ChunksArePageMultiplesAndBalanced) {
+    const platform::ParallelOptions options;
+    const std::size_t n = std::size_t{1} << 24;
+    for (std::size_t participants : {2u, 4u, 16u}) {
+        const std::size_t chunk = platform::parallel_chunk_elements(n, participants, 12, options);
+        EXPECT_EQ(chunk % 1024, 0u);
+        EXPECT_GE(n / chunk, 4 * participants - 1) << "participants=" << participants;
+        EXPECT_LE(chunk * 12, platform::l2_cache_bytes() / 2);
+    }
+    EXPECT_GE(platform::parallel_chunk_elements(1 << 16, 64, 12, options), 4096u);
+
+    platform::ParallelOptions fixed;
+    fixed.chunk_elements = 777;
+    EXPECT_EQ(platform::parallel_chunk_elements(n, 4, 12, fixed), 777u);
+}
+
+TEST(ParallelFor, CoversEveryElementExactlyOnce) {
+    platform::ThreadPool pool(3);
+    platform::ParallelOptions options;
+    options.min_parallel_elements = 1;
+    options.chunk_elements        = 1000;
+    std::vector<std::atomic<int>> hits(100'003);
+    std::atomic<int> calls{0};
+    platform::parallel_for(&pool, hits.size(), 4, options, [&](std::size_t begin, std::size_t end) {
+        calls.fetch_add(1);
+        for (std::size_t i = begin; i < end; ++i) {
+            hits[i].fetch_add(1);
+        }
+    });
+    EXPECT_EQ(calls.load(), 101);
+    for (const auto &h : hits) {
+        ASSERT_EQ(h.load(), 1);
+    }
+}
+
+TEST(ParallelFor, SmallInputsAndNullPoolRunInline) {
+    platform::ThreadPool pool(2);
+    int calls = 0;
+    platform::parallel_for(&pool, 100, 4, {}, [&](std::size_t begin, std::size_t end) {
+        ++calls;
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 100u);
+    });
+    platform::parallel_for(nullptr, 1 << 20, 4, {}, [&](std::size_t, std::size_t) { ++calls; });
+    platform::parallel_for(&pool, 0, 4, {}, [&](std::size_t, std::size_t) { ++calls; });
+    EXPECT_EQ(calls, 2);
+}
+
+// Every worker runs a parallel loop while the queue has room for one job: helpers that do not fit
+// must be skipped rather than waited for, or the workers block each other in enqueue.
+TEST(ParallelFor, NestedLoopsOnAFullQueueDoNotDeadlock) {
+    platform::ThreadPool pool(2, 1);
+    std::atomic<int> started{0};
+    std::atomic<int> finished{0};
+    std::atomic<std::size_t> ran{0};
+    for (int job = 0; job < 2; ++job) {
+        ASSERT_TRUE(pool.enqueue([&] {
+            started.fetch_add(1);
+            while (started.load() < 2) {
+                std::this_thread::yield();
+            }
+            platform::parallel_for_chunks(&pool, 8, [&ran](std::size_t) { ran.fetch_add(1); });
+            finished.fetch_add(1);
+        }));
+    }
+    const auto give_up = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (finished.load() < 2 && std::chrono::steady_clock::now() < give_up) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(finished.load(), 2);
+    pool.shutdown();
+    EXPECT_EQ(ran.load(), 16u);
+}
@@ -0,0 +1,54 @@
+// test_perf_counters.cpp - perf_event_open sampling and graceful fallback checks.
+#include "platform/perf_counters.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace {
+    std::uint64_t busy_work() {
+        volatile std::uint64_t acc = 0;
+        for (std::uint64_t i = 0; i < 200000; ++i) {
+            acc = acc + i * 3;
+        }
+        return acc;
+    }
+} // namespace
+
+TEST(PerfCounters, ScopeMeasuresOrFallsBackToZero) {
+    platform::PerfScope scope;
+    (void)busy_work();
+    const auto s = scope.elapsed();
+    if (!platform::PerfCounters::this_thread().available()) {
+        EXPECT_FALSE(platform::PerfCounters::this_thread().unavailable_reason().empty());
+        EXPECT_EQ(s.cycles, 0u);
+        EXPECT_EQ(s.instructions, 0u);
+        GTEST_SKIP() << platform::PerfCounters::this_thread().unavailable_reason();
+    }
+    EXPECT_GT(s.cycles, 0u);
+    EXPECT_GT(s.instructions, 0u);
+    EXPECT_GT(s.ipc(), 0.0);
+}
+
+TEST(PerfCounters, SampleArithmeticSaturates) {
+    platform::PerfSample a{.cycles = 100, .instructions = 250, .cache_misses = 5, .branch_misses = 1};
+    platform::PerfSample b{.cycles = 40, .instructions = 300, .cache_misses = 1, .branch_misses = 0};
+    const auto d = a - b;
+    EXPECT_EQ(d.cycles, 60u);
+    EXPECT_EQ(d.instructions, 0u);
+    a += b;
+    EXPECT_EQ(a.cycles, 140u);
+    EXPECT_DOUBLE_EQ(a.ipc(), 550.0 / 140.0);
+    EXPECT_DOUBLE_EQ(a.cache_mpki(), 1000.0 * 6.0 / 550.0);
+}
+
+TEST(PerfCounters, MetricsAccumulateSamples) {
+    platform::MetricsRegistry registry;
+    const auto metrics = platform::PerfMetrics::bind(registry, "stage");
+    metrics.add({.cycles = 10, .instructions = 20, .cache_misses = 3, .branch_misses = 4});
+    metrics.add({.cycles = 10, .instructions = 20, .cache_misses = 3, .branch_misses = 4});
+    EXPECT_EQ(registry.counter("stage_cycles_total").value(), 20u);
+    EXPECT_EQ(registry.counter("stage_instructions_total").value(), 40u);
+    EXPECT_EQ(registry.counter("stage_cache_misses_total").value(), 6u);
+    EXPECT_EQ(registry.counter("stage_branch_misses_total").value(), 8u);
+}
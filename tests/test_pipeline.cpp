@@ -0,0 +1,304 @@
+// test_pipeline.cpp - Pipeline runs: placements, fusion, batching, actuator hand-off, overload and deadlines.
+#include "platform/pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include "platform/logging.hpp"
+#include "platform/scope_guard.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace {
+    std::uint64_t counter_value(platform::Pipeline &pipeline, const std::string &name) {
+        return pipeline.metrics().counter(name).value();
+    }
+
+    // Silences the warnings these runs provoke until the returned guard goes out of scope, which
+    // also restores the level when an ASSERT_* returns early.
+    auto quiet_logs() {
+        platform::set_log_level(platform::LogLevel::kError);
+        return platform::make_scope_guard([] { platform::set_log_level(platform::LogLevel::kInfo); });
+    }
+} // namespace
+
+TEST(Pipeline, StartRejectsInvalidConfig) {
+    const auto restore_logs = quiet_logs();
+    platform::PipelineOptions options;
+    options.sensors = {{.name = "imu", .period = -1ms}};
+    platform::Pipeline pipeline(options);
+    EXPECT_FALSE(pipeline.start());
+}
+
+// Invalid options are rejected before the pool, the EDF executor or a synchronizer is built from them.
+TEST(Pipeline, InvalidConfigBuildsNothing) {
+    const auto restore_logs = quiet_logs();
+    platform::PipelineOptions options;
+    options.deadline_workers = 0;
+    options.sensors          = {{.name = "imu", .period = 1ms, .topic = "imu.raw"}};
+    options.stages           = {
+        {.name         = "fused",
+         .kind         = platform::StageKind::kFusion,
+         .input_topics = {"imu.raw"},
+         .output_topic = "sensor.raw"},
+        {.name         = "steering",
+         .kind         = platform::StageKind::kControl,
+         .input_topics = {"sensor.raw"},
+         .shed         = platform::ShedPolicy::kDropNewest,
+         .deadline     = 2ms},
+    };
+    platform::Pipeline pipeline(options);
+    const auto snapshot = pipeline.metrics().snapshot();
+    EXPECT_EQ(snapshot.find_gauge("pipeline_pool_queue_depth"), nullptr);
+    EXPECT_EQ(snapshot.find_gauge("pipeline_edf_queue_depth"), nullptr);
+    EXPECT_EQ(snapshot.find_counter("pipeline_fused_fused_total"), nullptr);
+    EXPECT_FALSE(pipeline.start());
+    pipeline.stop();
+}
+
+class PipelinePlacement : public ::testing::TestWithParam<platform::StagePlacement> {};
+
+TEST_P(PipelinePlacement, RunsEverySensorThroughBothStages) {
+    const auto restore_logs = quiet_logs();
+    platform::PipelineOptions options;
+    options.worker_threads = 2;
+    options.sensors        = {
+        {.name = "imu", .period = 2ms}, {.name = "wheel", .period = 3ms}, {.name = "gps", .period = 5ms}};
+    options.stages         = {
+        {.name = "perception", .input_topics = {"sensor.raw"}, .output_topic = "control.cmd", .placement = GetParam()},
+        {.name         = "control",
+         .kind         = platform::StageKind::kControl,
+         .input_topics = {"control.cmd"},
+         .placement    = GetParam()},
+    };
+    platform::Pipeline pipeline(options);
+    ASSERT_TRUE(pipeline.start());
+    std::this_thread::sleep_for(100ms);
+    pipeline.stop();
+
+    std::uint64_t published = 0;
+    for (const char *sensor : {"imu", "wheel", "gps"}) {
+        const auto samples =
+            counter_value(pipeline, std::string("pipeline_sensor_samples_total{sensor=\"") + sensor + "\"}");
+        EXPECT_GT(samples, 0u) << sensor;
+        published += samples;
+    }
+    EXPECT_GT(pipeline.processed_samples(), 0u);
+    EXPECT_LE(pipeline.processed_samples(), published);
+    EXPECT_EQ(counter_value(pipeline, "pipeline_malformed_payloads_total"), 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllPlacements, PipelinePlacement,
+                         ::testing::Values(platform::StagePlacement::kInline, platform::StagePlacement::kPool,
+                                           platform::StagePlacement::kDedicated),
+                         [](const auto &info) { return std::string(platform::to_string(info.param)); });
+
+// Text payloads carry names of any length; only the binary format bounds them.
+TEST(PipelineFusion, TextPayloadsCarryLongNames) {
+    const auto restore_logs = quiet_logs();
+    const std::string imu(44, 'i');
+    const std::string wheel(44, 'w');
+    platform::PipelineOptions options;
+    options.worker_threads = 2;
+    options.sensors        = {{.name = imu, .period = 2ms, .topic = "imu.raw"},
+                              {.name = wheel, .period = 2ms, .topic = "wheel.raw"}};
+    options.stages         = {
+        {.name         = std::string(60, 'f'),
+         .kind         = platform::StageKind::kFusion,
+         .input_topics = {"imu.raw", "wheel.raw"},
+         .output_topic = "sensor.raw"},
+        {.name = "perception", .input_topics = {"sensor.raw"}, .output_topic = "control.cmd"},
+        {.name = "control", .kind = platform::StageKind::kControl, .input_topics = {"control.cmd"}},
+    };
+    platform::Pipeline pipeline(options);
+    ASSERT_TRUE(pipeline.start());
+    std::this_thread::sleep_for(100ms);
+    pipeline.stop();
+
+    EXPECT_GT(pipeline.processed_samples(), 0u);
+    EXPECT_EQ(counter_value(pipeline, "pipeline_malformed_payloads_total"), 0u);
+}
+
+TEST(PipelineFusion, AlignsTwoSensorsIntoOneStream) {
+    const auto restore_logs = quiet_logs();
+    platform::PipelineOptions options;
+    options.worker_threads = 2;
+    options.sensors        = {{.name = "imu", .period = 2ms, .topic = "imu.raw"},
+                              {.name = "wheel", .period = 2ms, .topic = "wheel.raw"}};
+    options.stages         = {
+        {.name         = "fused",
+         .kind         = platform::StageKind::kFusion,
+         .input_topics = {"imu.raw", "wheel.raw"},
+         .output_topic = "sensor.raw"},
+        {.name = "perception", .input_topics = {"sensor.raw"}, .output_topic = "control.cmd"},
+        {.name = "control", .kind = platform::StageKind::kControl, .input_topics = {"control.cmd"}},
+    };
+    platform::Pipeline pipeline(options);
+    ASSERT_TRUE(pipeline.start());
+    std::this_thread::sleep_for(100ms);
+    pipeline.stop();
+
+    const auto fused = counter_value(pipeline, "pipeline_fused_fused_total");
+    EXPECT_GT(fused, 0u);
+    // Pool jobs still queued at stop() are dropped, so perception may trail the fusion stage.
+    EXPECT_GT(pipeline.processed_samples(), 0u);
+    EXPECT_LE(pipeline.processed_samples(), fused);
+    EXPECT_EQ(counter_value(pipeline, "pipeline_malformed_payloads_total"), 0u);
+}
+
+TEST(PipelineBatching, FlushesFullBatchesOnTimeoutAndOnStop) {
+    const auto restore_logs = quiet_logs();
+    platform::PipelineOptions options;
+    options.worker_threads = 1;
+    options.sensors        = {{.name = "imu", .period = std::chrono::hours(1)}};
+    options.stages         = {
+        {.name         = "perception",
+         .input_topics = {"sensor.raw"},
+         .output_topic = "control.cmd",
+         .placement    = platform::StagePlacement::kDedicated,
+         .batch_size   = 8,
+         .batch_flush  = 20ms},
+        {.name = "control", .kind = platform::StageKind::kControl, .input_topics = {"control.cmd"}},
+    };
+    platform::Pipeline pipeline(options);
+    ASSERT_TRUE(pipeline.start());
+    auto wait_for = [&](std::size_t n) {
+        for (int i = 0; i < 200 && pipeline.processed_samples() < n; ++i) {
+            std::this_thread::sleep_for(5ms);
+        }
+        return pipeline.processed_samples();
+    };
+
+    // The sensor's single sample sits alone until the flush timer releases it.
+    EXPECT_EQ(wait_for(1), 1u);
+    EXPECT_EQ(counter_value(pipeline, "pipeline_perception_batch_timeouts_total"), 1u);
+
+    for (int i = 0; i < 16; ++i) {
+        pipeline.bus().publish("sensor.raw", "imu:1.0");
+    }
+    // Full batches go without waiting for the timer; a slow stage thread may take all 16 at once.
+    EXPECT_EQ(wait_for(17), 17u);
+    EXPECT_EQ(counter_value(pipeline, "pipeline_perception_batch_timeouts_total"), 1u);
+    const auto snap   = pipeline.metrics().snapshot();
+    const auto *sizes = snap.find_histogram("pipeline_perception_batch_size");
+    ASSERT_NE(sizes, nullptr);
+    EXPECT_GE(sizes->data.max, 8u);
+
+    // Whatever is still buffered is processed before stop() returns.
+    for (int i = 0; i < 3; ++i) {
+        pipeline.bus().publish("sensor.raw", "imu:1.0");
+    }
+    pipeline.stop();
+    EXPECT_EQ(pipeline.processed_samples(), 20u);
+    EXPECT_EQ(counter_value(pipeline, "pipeline_perception_batch_dropped_total"), 0u);
+}
+
+TEST(PipelineActuator, AppliesOnlyTheNewestCommandEachPeriod) {
+    const auto restore_logs = quiet_logs();
+    platform::PipelineOptions options;
+    options.worker_threads  = 1;
+    options.actuator_period = 2ms;
+    for (int i = 0; i < 8; ++i) {
+        options.sensors.push_back({.name = "s" + std::to_string(i), .period = 1ms});
+    }
+    options.stages = {
+        {.name         = "perception",
+         .input_topics = {"sensor.raw"},
+         .output_topic = "control.cmd",
+         .placement    = platform::StagePlacement::kInline},
+        {.name         = "control",
+         .kind         = platform::StageKind::kControl,
+         .input_topics = {"control.cmd"},
+         .placement    = platform::StagePlacement::kInline},
+    };
+    platform::Pipeline pipeline(options);
+    ASSERT_TRUE(pipeline.start());
+    std::this_thread::sleep_for(100ms);
+    pipeline.stop();
+
+    // About 50 ticks against about 800 commands: most are superseded, none applied twice.
+    const auto writes     = counter_value(pipeline, "pipeline_actuator_writes_total");
+    const auto superseded = counter_value(pipeline, "pipeline_actuator_superseded_total");
+    EXPECT_GT(writes, 0u);
+    EXPECT_LE(writes, 60u);
+    EXPECT_GT(superseded, 0u);
+    EXPECT_LE(writes + superseded, pipeline.processed_samples());
+}
+
+// 128 sensors at 1 kHz (10x a 100 Hz nominal rate) into one worker and an 8-slot queue. The
+// sensor thread must keep publishing, and every sample must be either processed, shed, or among
+// the few still queued at stop.
+TEST(PipelineOverload, ShedsInsteadOfStallingTheSensors) {
+    constexpr std::size_t kSensors  = 128;
+    constexpr std::size_t kCapacity = 8;
+    const auto restore_logs = quiet_logs();
+    platform::PipelineOptions options;
+    options.worker_threads = 1;
+    options.queue_capacity = kCapacity;
+    for (std::size_t i = 0; i < kSensors; ++i) {
+        options.sensors.push_back({.name = "s" + std::to_string(i), .period = 1ms});
+    }
+    platform::Pipeline pipeline(options); // default graph: drop_newest perception, coalescing control
+    ASSERT_TRUE(pipeline.start());
+    std::this_thread::sleep_for(200ms);
+    pipeline.stop();
+
+    const auto snap     = pipeline.metrics().snapshot();
+    const auto *sensors = snap.find_counter("bus_published_total{topic=\"sensor.raw\"}");
+    ASSERT_NE(sensors, nullptr);
+    const std::uint64_t published = sensors->value;
+    const std::uint64_t shed      = counter_value(pipeline, "pipeline_shed_total{stage=\"perception\"}");
+    const std::uint64_t processed = pipeline.processed_samples();
+    EXPECT_GE(published, kSensors * 40); // a fifth of the schedule, leaving room for sanitizer builds
+    EXPECT_GT(shed, 0u);
+    EXPECT_LE(processed + shed, published);
+    EXPECT_LE(published - processed - shed, kCapacity + 1);
+
+    const auto *latency = snap.find_histogram("pipeline_sensor_to_actuator_ns");
+    ASSERT_NE(latency, nullptr);
+    EXPECT_GT(latency->data.count, 0u);
+}
+
+// Control runs on the EDF executor: a generous deadline is always met, while one already past by
+// the time the job can start drops every command before it reaches the actuator.
+TEST(PipelineDeadline, MeetsOrDropsByTheSensorTimestamp) {
+    const auto restore_logs = quiet_logs();
+    for (const auto deadline : {std::chrono::microseconds(1s), std::chrono::microseconds(1)}) {
+        platform::PipelineOptions options;
+        options.worker_threads = 1;
+        options.sensors        = {{.name = "imu", .period = 1ms}};
+        options.stages         = {
+            {.name         = "perception",
+             .input_topics = {"sensor.raw"},
+             .output_topic = "control.cmd",
+             .placement    = platform::StagePlacement::kInline},
+            {.name         = "control",
+             .kind         = platform::StageKind::kControl,
+             .input_topics = {"control.cmd"},
+             .shed         = platform::ShedPolicy::kDropNewest,
+             .deadline     = deadline},
+        };
+        platform::Pipeline pipeline(options);
+        ASSERT_TRUE(pipeline.start());
+        std::this_thread::sleep_for(50ms);
+        pipeline.stop();
+
+        const auto ran     = counter_value(pipeline, "pipeline_edf_jobs_total");
+        const auto dropped = counter_value(pipeline, "pipeline_edf_late_dropped_total");
+        const auto applied = pipeline.metrics().histogram("pipeline_sensor_to_actuator_ns").snapshot().count;
+        if (deadline == 1s) {
+            EXPECT_GT(ran, 0u);
+            EXPECT_EQ(dropped, 0u);
+            EXPECT_EQ(counter_value(pipeline, "pipeline_edf_deadline_miss_total"), 0u);
+            EXPECT_EQ(applied, ran);
+        } else {
+            EXPECT_EQ(ran, 0u);
+            EXPECT_GT(dropped, 0u);
+            EXPECT_EQ(applied, 0u);
+        }
+    }
+}
@@ -0,0 +1,251 @@
+// test_pipeline_config.cpp - config parsing and graph validation.
+#include "platform/pipeline_config.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+    bool mentions(const std::vector<std::string> &errors, const std::string &needle) {
+        return std::any_of(errors.begin(), errors.end(),
+                           [&](const std::string &e) { return e.find(needle) != std::string::npos; });
+    }
+} // namespace
+
+TEST(PipelineConfig, DefaultGraphIsOneSensorAndTwoPoolStages) {
+    const auto options = platform::with_default_graph({.sensor_period = 20ms});
+    ASSERT_EQ(options.sensors.size(), 1u);
+    EXPECT_EQ(options.sensors[0].name, "imu");
+    EXPECT_EQ(options.sensors[0].period, 20ms);
+    ASSERT_EQ(options.stages.size(), 2u);
+    EXPECT_EQ(options.stages[0].output_topic, "control.cmd");
+    EXPECT_EQ(options.stages[1].kind, platform::StageKind::kControl);
+    EXPECT_TRUE(platform::validate_pipeline_options(options).empty());
+}
+
+TEST(PipelineConfig, ParsesSensorsStagesAndGlobals) {
+    std::string error;
+    const auto options = platform::parse_pipeline_config(R"(
+        # two sensors, one fast
+        worker_threads = 3
+        payload_format=binary
+        pool_lanes = weighted
+        pool_aging_us = 20000
+        pool_reserved_workers = 1
+        pool_pin = core
+        pool_exclude_cpus = 0-1,4
+        pool_max_threads = 6
+        pool_target_wait_us = 500
+        pool_idle_ms = 200
+        sensor imu   period_ms=10 topic=sensor.raw
+        sensor lidar period_ms=100   # trailing comment
+        stage perception kind=perception in=sensor.raw out=control.cmd placement=inline gain=0.25
+        stage control    kind=control    in=control.cmd placement=dedicated
+    )",
+                                                         error);
+    ASSERT_TRUE(options) << error;
+    EXPECT_EQ(options->worker_threads, 3u);
+    EXPECT_EQ(options->payload_format, platform::PayloadFormat::kBinary);
+    EXPECT_EQ(options->pool.selection, platform::LaneSelection::kWeighted);
+    EXPECT_EQ(options->pool.aging, 20ms);
+    EXPECT_EQ(options->pool.reserved_workers, 1u);
+    EXPECT_EQ(options->pool_placement.pin, platform::PinPolicy::kCore);
+    EXPECT_EQ(options->pool_placement.exclude, (std::vector<int>{0, 1, 4}));
+    EXPECT_EQ(options->pool_placement.name, "pipe-pool");
+    EXPECT_EQ(options->pool_scaling.max_threads, 6u);
+    EXPECT_EQ(options->pool_scaling.target_wait, 500us);
+    EXPECT_EQ(options->pool_scaling.idle_timeout, 200ms);
+    ASSERT_EQ(options->sensors.size(), 2u);
+    EXPECT_EQ(options->sensors[0].period, 10ms);
+    EXPECT_EQ(options->sensors[1].name, "lidar");
+    EXPECT_EQ(options->sensors[1].topic, "sensor.raw");
+    ASSERT_EQ(options->stages.size(), 2u);
+    EXPECT_EQ(options->stages[0].placement, platform::StagePlacement::kInline);
+    EXPECT_EQ(options->stages[0].gain, 0.25);
+    EXPECT_EQ(options->stages[1].placement, platform::StagePlacement::kDedicated);
+    EXPECT_TRUE(platform::validate_pipeline_options(*options).empty());
+}
+
+TEST(PipelineConfig, ReportsSyntaxErrorsWithLineNumbers) {
+    std::string error;
+    EXPECT_FALSE(platform::parse_pipeline_config("sensor imu\nstage p placement=somewhere", error));
+    EXPECT_EQ(error.rfind("line 2:", 0), 0u) << error;
+    EXPECT_NE(error.find("somewhere"), std::string::npos);
+
+    EXPECT_FALSE(platform::parse_pipeline_config("threads = 4", error));
+    EXPECT_NE(error.find("unknown key"), std::string::npos);
+    EXPECT_FALSE(platform::parse_pipeline_config("sensor period_ms=5", error));
+    EXPECT_NE(error.find("needs a name"), std::string::npos);
+    EXPECT_FALSE(platform::parse_pipeline_config("sensor imu period_ms=fast", error));
+    EXPECT_FALSE(platform::parse_pipeline_config("just words", error));
+    EXPECT_FALSE(platform::parse_pipeline_config("pool_exclude_cpus = 0-2147483647", error));
+    EXPECT_NE(error.find("bad pool_exclude_cpus"), std::string::npos);
+}
+
+TEST(PipelineConfig, ValidationCatchesBrokenGraphs) {
+    platform::PipelineOptions options;
+    options.payload_format = platform::PayloadFormat::kBinary;
+    options.sensors        = {{.name = "imu", .period = 0ms},
+                              {.name = "imu"},
+                              {.name = "a_really_long_sensor_name"}};
+    options.stages         = {
+        {.name = "p1", .input_topics = {"sensor.raw"}, .output_topic = "a"},
+        {.name = "p2", .input_topics = {"a"}, .output_topic = "b"},
+        {.name = "p3", .input_topics = {"b"}, .output_topic = "a"},
+        {.name = "p4", .input_topics = {"sensor.raw"}},
+        {.name = "c", .kind = platform::StageKind::kControl, .input_topics = {"nobody.publishes"}},
+    };
+    const auto errors = platform::validate_pipeline_options(options);
+    EXPECT_TRUE(mentions(errors, "period must be positive"));
+    EXPECT_TRUE(mentions(errors, "duplicate sensor 'imu'"));
+    EXPECT_TRUE(mentions(errors, "at most 15"));
+    EXPECT_TRUE(mentions(errors, "cycle"));
+    EXPECT_TRUE(mentions(errors, "'p4': needs an output topic"));
+    EXPECT_TRUE(mentions(errors, "nothing publishes 'nobody.publishes'"));
+}
+
+// A non-positive interval would make the elastic pool's controller spin a whole core.
+TEST(PipelineConfig, ElasticPoolNeedsPositiveTimings) {
+    auto options         = platform::with_default_graph({});
+    options.pool_scaling = {.max_threads = 4, .interval = std::chrono::milliseconds::zero()};
+    auto errors          = platform::validate_pipeline_options(options);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_TRUE(mentions(errors, "scaling interval must be positive"));
+
+    options.pool_scaling = {.max_threads = 4, .idle_timeout = std::chrono::milliseconds::zero()};
+    EXPECT_TRUE(mentions(platform::validate_pipeline_options(options), "pool_idle_ms must be positive"));
+
+    options.pool_scaling.max_threads = 0; // fixed pools ignore the scaling timings
+    EXPECT_TRUE(platform::validate_pipeline_options(options).empty());
+}
+
+TEST(PipelineConfig, ParsesAndValidatesFusionStages) {
+    std::string error;
+    auto options = platform::parse_pipeline_config(R"(
+        sensor imu   period_ms=10 topic=imu.raw
+        sensor wheel period_ms=20 topic=wheel.raw
+        stage fused      kind=fusion     in=imu.raw,wheel.raw out=sensor.raw tolerance_ms=8 buffer=16
+        stage perception kind=perception in=sensor.raw out=control.cmd
+        stage control    kind=control    in=control.cmd
+    )",
+                                                   error);
+    ASSERT_TRUE(options) << error;
+    const auto &fused = options->stages.at(0);
+    EXPECT_EQ(fused.kind, platform::StageKind::kFusion);
+    EXPECT_EQ(fused.input_topics, (std::vector<std::string>{"imu.raw", "wheel.raw"}));
+    EXPECT_EQ(fused.tolerance, 8ms);
+    EXPECT_EQ(fused.buffer_capacity, 16u);
+    EXPECT_TRUE(platform::validate_pipeline_options(*options).empty());
+
+    options->stages[0].input_topics = {"imu.raw", "imu.raw"};
+    options->stages[0].tolerance    = 0ms;
+    const auto errors               = platform::validate_pipeline_options(*options);
+    EXPECT_TRUE(mentions(errors, "at least two distinct input topics"));
+    EXPECT_TRUE(mentions(errors, "tolerance and buffer must be positive"));
+}
+
+TEST(PipelineConfig, BatchingNeedsADedicatedPerceptionStage) {
+    std::string error;
+    auto options = platform::parse_pipeline_config(R"(
+        sensor imu period_ms=1
+        stage perception kind=perception in=sensor.raw out=control.cmd placement=dedicated batch=32 flush_us=250
+        stage control    kind=control    in=control.cmd batch=4 flush_us=0
+    )",
+                                                   error);
+    ASSERT_TRUE(options) << error;
+    EXPECT_EQ(options->stages[0].batch_size, 32u);
+    EXPECT_EQ(options->stages[0].batch_flush, 250us);
+    const auto errors = platform::validate_pipeline_options(*options);
+    ASSERT_EQ(errors.size(), 2u);
+    EXPECT_TRUE(mentions(errors, "'control': only dedicated perception stages batch"));
+    EXPECT_TRUE(mentions(errors, "'control': flush_us must be positive"));
+}
+
+TEST(PipelineConfig, ParsesShedPoliciesAndRejectsUnsupportedOnes) {
+    std::string error;
+    auto options = platform::parse_pipeline_config(R"(
+        sensor imu period_ms=1
+        stage perception kind=perception in=sensor.raw out=control.cmd shed=drop_oldest priority=low
+        stage control    kind=control    in=control.cmd placement=inline shed=coalesce
+    )",
+                                                   error);
+    ASSERT_TRUE(options) << error;
+    EXPECT_EQ(options->stages[0].shed, platform::ShedPolicy::kDropOldest);
+    EXPECT_EQ(options->stages[0].priority, platform::JobPriority::kLow);
+    const auto errors = platform::validate_pipeline_options(*options);
+    EXPECT_TRUE(mentions(errors, "'perception': drop_oldest needs placement=dedicated"));
+    EXPECT_TRUE(mentions(errors, "'control': inline stages run on the publisher and cannot shed"));
+
+    EXPECT_FALSE(platform::parse_pipeline_config("stage p shed=sometimes", error));
+    EXPECT_NE(error.find("unknown shed policy"), std::string::npos);
+    EXPECT_FALSE(platform::parse_pipeline_config("stage p priority=urgent", error));
+}
+
+TEST(PipelineConfig, DeadlinesNeedADroppingPoolStage) {
+    std::string error;
+    auto options = platform::parse_pipeline_config(R"(
+        deadline_workers = 2
+        sensor imu period_ms=1
+        stage perception kind=perception in=sensor.raw out=control.cmd deadline_us=500 late=run
+        stage control    kind=control    in=control.cmd shed=drop_newest deadline_us=2000
+    )",
+                                                   error);
+    ASSERT_TRUE(options) << error;
+    EXPECT_EQ(options->deadline_workers, 2u);
+    EXPECT_EQ(options->stages[0].late, platform::LatePolicy::kRun);
+    EXPECT_EQ(options->stages[1].deadline, 2ms);
+    EXPECT_EQ(options->stages[1].late, platform::LatePolicy::kDrop);
+    const auto errors = platform::validate_pipeline_options(*options);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_TRUE(mentions(errors, "'perception': deadline_us needs placement=pool and shed=drop_newest"));
+
+    EXPECT_FALSE(platform::parse_pipeline_config("stage p late=maybe", error));
+    EXPECT_NE(error.find("unknown late policy"), std::string::npos);
+}
+
+TEST(PipelineConfig, WaitStrategiesNeedAnUnbatchedDedicatedStage) {
+    std::string error;
+    auto options = platform::parse_pipeline_config(R"(
+        pool_wait = spin_park
+        pool_spin_us = 30
+        stage perception kind=perception in=sensor.raw out=control.cmd wait=spin
+        stage control    kind=control    in=control.cmd placement=dedicated wait=spin_park spin_us=100
+    )",
+                                                   error);
+    ASSERT_TRUE(options) << error;
+    EXPECT_EQ(options->pool_wait.mode, platform::WaitMode::kSpinThenPark);
+    EXPECT_EQ(options->pool_wait.spin, 30us);
+    EXPECT_EQ(options->stages[0].wait.mode, platform::WaitMode::kSpin);
+    EXPECT_EQ(options->stages[1].wait.mode, platform::WaitMode::kSpinThenPark);
+    EXPECT_EQ(options->stages[1].wait.spin, 100us);
+    const auto errors = platform::validate_pipeline_options(platform::with_default_graph(*options));
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_TRUE(mentions(errors, "'perception': wait needs placement=dedicated without batching"));
+
+    EXPECT_FALSE(platform::parse_pipeline_config("pool_wait = sometimes", error));
+    EXPECT_NE(error.find("unknown pool_wait"), std::string::npos);
+}
+
+TEST(PipelineConfig, LoadsFromFile) {
+    const std::string path = ::testing::TempDir() + "pipeline_config_test.conf";
+    {
+        std::ofstream out(path);
+        out << "queue_capacity = 64\nsensor gps period_ms=200\n";
+    }
+    std::string error;
+    const auto options = platform::load_pipeline_config(path, error);
+    std::remove(path.c_str());
+    ASSERT_TRUE(options) << error;
+    EXPECT_EQ(options->queue_capacity, 64u);
+    EXPECT_EQ(options->sensors.at(0).name, "gps");
+
+    EXPECT_FALSE(platform::load_pipeline_config(path, error));
+    EXPECT_NE(error.find("cannot open"), std::string::npos);
+}
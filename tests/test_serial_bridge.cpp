@@ -0,0 +1,179 @@
+// test_serial_bridge.cpp - serial bridge over a PTY pair: inbound publish, outbound framing, recovery.
+#include "platform/serial_bridge.hpp"
+
+#include "platform/metrics.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+    // Collects payloads published on one topic.
+    struct Collector {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<std::string> payloads;
+
+        void operator()(const platform::Message &msg) {
+            std::lock_guard lock(mutex);
+            payloads.push_back(msg.payload);
+            cv.notify_all();
+        }
+
+        bool wait_for_count(std::size_t count) {
+            std::unique_lock lock(mutex);
+            return cv.wait_for(lock, 2s, [&] { return payloads.size() >= count; });
+        }
+    };
+
+    std::string frame(const std::string &payload) {
+        std::string out(platform::serial::max_frame_size(payload.size()), '\0');
+        out.resize(platform::serial::encode_frame(payload, out));
+        return out;
+    }
+
+    void write_all(int fd, const std::string &bytes) {
+        std::size_t done = 0;
+        while (done < bytes.size()) {
+            const ssize_t n = ::write(fd, bytes.data() + done, bytes.size() - done);
+            ASSERT_GT(n, 0);
+            done += static_cast<std::size_t>(n);
+        }
+    }
+
+    // Reads from `fd` until `count` frames decode or two seconds pass.
+    std::vector<std::string> read_frames(int fd, std::size_t count) {
+        platform::serial::FrameDecoder decoder;
+        std::vector<std::string> out;
+        const auto deadline = std::chrono::steady_clock::now() + 2s;
+        char buffer[512];
+        while (out.size() < count && std::chrono::steady_clock::now() < deadline) {
+            pollfd pfd{.fd = fd, .events = POLLIN, .revents = 0};
+            if (::poll(&pfd, 1, 50) <= 0) {
+                continue;
+            }
+            const ssize_t n = ::read(fd, buffer, sizeof(buffer));
+            if (n <= 0) {
+                break;
+            }
+            std::span<const char> in(buffer, static_cast<std::size_t>(n));
+            while (auto payload = decoder.next(in)) {
+                out.emplace_back(payload->begin(), payload->end());
+            }
+        }
+        return out;
+    }
+} // namespace
+
+class SerialBridgeTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        auto pair = platform::SerialPort::open_pty_pair();
+        if (!pair) {
+            GTEST_SKIP() << "pseudo-terminals unavailable";
+        }
+        mcu_  = std::move(pair->first);
+        host_ = std::move(pair->second);
+    }
+
+    platform::SerialPort mcu_;
+    platform::SerialPort host_;
+    platform::MessageBus bus_;
+};
+
+TEST_F(SerialBridgeTest, PtyPairPassesBytesUnchanged) {
+    // Raw mode: no CR/LF translation, no echo, and control characters are plain data.
+    const std::string bytes("\r\n\x03\x04\x11\0\xff", 7);
+    write_all(mcu_.fd(), bytes);
+    std::string received;
+    char buffer[16];
+    while (received.size() < bytes.size()) {
+        const ssize_t n = ::read(host_.fd(), buffer, sizeof(buffer));
+        ASSERT_GT(n, 0);
+        received.append(buffer, static_cast<std::size_t>(n));
+    }
+    EXPECT_EQ(received, bytes);
+}
+
+TEST_F(SerialBridgeTest, PublishesInboundFrames) {
+    Collector collector;
+    bus_.subscribe("sensor.raw", std::ref(collector));
+    platform::SerialBridge bridge(bus_, std::move(host_));
+    ASSERT_TRUE(bridge.start());
+
+    std::string stream;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 100; ++i) {
+        expected.push_back("imu:" + std::to_string(i));
+        stream += frame(expected.back());
+    }
+    // Split mid-frame so the decoder has to carry state across reads.
+    write_all(mcu_.fd(), stream.substr(0, 301));
+    write_all(mcu_.fd(), stream.substr(301));
+
+    ASSERT_TRUE(collector.wait_for_count(expected.size()));
+    bridge.stop();
+    EXPECT_EQ(collector.payloads, expected);
+    EXPECT_EQ(bridge.stats().frames_in, expected.size());
+    EXPECT_EQ(bridge.stats().bytes_in, stream.size());
+}
+
+TEST_F(SerialBridgeTest, WritesOutboundCommandsAsFrames) {
+    platform::MetricsRegistry registry;
+    platform::SerialBridge bridge(bus_, std::move(host_));
+    bridge.bind_metrics(registry, "serial");
+    ASSERT_TRUE(bridge.start());
+
+    const std::vector<std::string> commands{"0.5", "-1.25", std::string("\0bin\0", 5)};
+    for (const auto &command : commands) {
+        bus_.publish("control.cmd", command);
+    }
+    EXPECT_EQ(read_frames(mcu_.fd(), commands.size()), commands);
+    bridge.stop();
+    EXPECT_EQ(registry.counter("serial_frames_out_total").value(), commands.size());
+    EXPECT_GT(registry.counter("serial_bytes_out_total").value(), 0u);
+}
+
+TEST_F(SerialBridgeTest, CountsCorruptionAndKeepsGoing) {
+    Collector collector;
+    bus_.subscribe("mcu.in", std::ref(collector));
+    platform::SerialBridge bridge(bus_, std::move(host_), {.inbound_topic = "mcu.in"});
+    ASSERT_TRUE(bridge.start());
+
+    std::string bad = frame("lost");
+    bad[1] ^= 0x20;
+    write_all(mcu_.fd(), std::string("noise") + bad + frame("kept"));
+
+    ASSERT_TRUE(collector.wait_for_count(1));
+    bridge.stop();
+    EXPECT_EQ(collector.payloads, std::vector<std::string>{"kept"});
+    EXPECT_GE(bridge.stats().decode_errors, 1u);
+}
+
+TEST_F(SerialBridgeTest, DropsOversizedOutboundPayloads) {
+    platform::SerialBridge bridge(bus_, std::move(host_), {.max_payload = 8});
+    ASSERT_TRUE(bridge.start());
+    bus_.publish("control.cmd", std::string(9, 'x'));
+    bus_.publish("control.cmd", "ok");
+    EXPECT_EQ(read_frames(mcu_.fd(), 1), std::vector<std::string>{"ok"});
+    bridge.stop();
+    EXPECT_EQ(bridge.stats().dropped_out, 1u);
+}
+
+TEST(SerialPort, OpenRejectsMissingDeviceAndUnknownBaud) {
+    EXPECT_FALSE(platform::SerialPort::open("/dev/does-not-exist"));
+    EXPECT_FALSE(platform::SerialPort::open("/dev/null", 12345));
+
+    platform::MessageBus bus;
+    platform::SerialBridge bridge(bus, platform::SerialPort{});
+    EXPECT_FALSE(bridge.start());
+}
@@ -0,0 +1,148 @@
+// test_serial_framing.cpp - CRC-32, COBS framing round trips, streaming decode and resynchronisation.
+#include "platform/serial_framing.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace serial = platform::serial;
+
+namespace {
+    std::string frame(const std::string &payload) {
+        std::string out(serial::max_frame_size(payload.size()), '\0');
+        out.resize(serial::encode_frame(payload, out));
+        return out;
+    }
+
+    // Feeds `stream` in chunks of `chunk` bytes and collects every decoded payload.
+    std::vector<std::string> decode_all(serial::FrameDecoder &decoder, const std::string &stream, std::size_t chunk) {
+        std::vector<std::string> out;
+        for (std::size_t pos = 0; pos < stream.size(); pos += chunk) {
+            std::span<const char> in(stream.data() + pos, std::min(chunk, stream.size() - pos));
+            while (auto payload = decoder.next(in)) {
+                out.emplace_back(payload->begin(), payload->end());
+            }
+        }
+        return out;
+    }
+
+    std::string random_payload(std::mt19937 &rng, std::size_t size) {
+        // Byte values skewed towards zero so COBS blocks of every length show up.
+        std::uniform_int_distribution<int> byte(-8, 255);
+        std::string out(size, '\0');
+        for (auto &c : out) {
+            c = static_cast<char>(std::max(0, byte(rng)));
+        }
+        return out;
+    }
+} // namespace
+
+TEST(SerialFraming, Crc32MatchesCheckValue) {
+    EXPECT_EQ(serial::crc32(std::string_view("123456789")), 0xCBF43926u);
+    EXPECT_EQ(serial::crc32({}), 0u);
+
+    // Chained calls equal one call over the concatenation, at every split point.
+    const std::string data = "The quick brown fox jumps over the lazy dog";
+    const std::uint32_t whole = serial::crc32(data);
+    EXPECT_EQ(whole, 0x414FA339u);
+    for (std::size_t split = 0; split <= data.size(); ++split) {
+        const std::span<const char> bytes(data);
+        EXPECT_EQ(serial::crc32(bytes.subspan(split), serial::crc32(bytes.first(split))), whole);
+    }
+}
+
+TEST(SerialFraming, EncodedFrameHasSingleTrailingDelimiter) {
+    const std::string payload("a\0b\0\0c", 6);
+    const std::string bytes = frame(payload);
+    ASSERT_FALSE(bytes.empty());
+    EXPECT_EQ(bytes.back(), '\0');
+    EXPECT_EQ(std::count(bytes.begin(), bytes.end(), '\0'), 1);
+    EXPECT_LE(bytes.size(), serial::max_frame_size(payload.size()));
+
+    char small[4];
+    EXPECT_EQ(serial::encode_frame(payload, small), 0u);
+}
+
+TEST(SerialFraming, RoundTripsAcrossBlockBoundaries) {
+    std::mt19937 rng(7);
+    serial::FrameDecoder decoder(2048);
+    for (const std::size_t size : {0u, 1u, 3u, 4u, 249u, 250u, 251u, 253u, 254u, 255u, 508u, 509u, 1000u, 2048u}) {
+        for (const bool zeros : {false, true}) {
+            const std::string payload = zeros ? random_payload(rng, size) : std::string(size, 'x');
+            const std::string bytes   = frame(payload);
+            ASSERT_LE(bytes.size(), serial::max_frame_size(size));
+            const auto decoded = decode_all(decoder, bytes, bytes.size());
+            ASSERT_EQ(decoded.size(), 1u) << "size " << size;
+            EXPECT_EQ(decoded[0], payload) << "size " << size;
+        }
+    }
+    EXPECT_EQ(decoder.stats().crc_errors + decoder.stats().framing_errors + decoder.stats().overruns, 0u);
+}
+
+TEST(SerialFraming, DecodesIndependentlyOfChunking) {
+    std::mt19937 rng(11);
+    std::vector<std::string> payloads;
+    std::string stream;
+    for (int i = 0; i < 50; ++i) {
+        payloads.push_back(random_payload(rng, rng() % 600));
+        stream += frame(payloads.back());
+    }
+    for (const std::size_t chunk : {std::size_t{1}, std::size_t{2}, std::size_t{7}, std::size_t{64}, stream.size()}) {
+        serial::FrameDecoder decoder;
+        EXPECT_EQ(decode_all(decoder, stream, chunk), payloads) << "chunk " << chunk;
+        EXPECT_EQ(decoder.stats().frames, payloads.size());
+    }
+}
+
+TEST(SerialFraming, CorruptionCostsOnlyTheDamagedFrame) {
+    const std::string first = "first", second = "second", third = "third";
+    std::string stream = frame(first) + frame(second) + frame(third);
+    stream[frame(first).size() + 2] ^= 0x10; // flip a data bit inside "second"
+
+    serial::FrameDecoder decoder;
+    const auto decoded = decode_all(decoder, stream, 3);
+    EXPECT_EQ(decoded, (std::vector<std::string>{first, third}));
+    EXPECT_EQ(decoder.stats().crc_errors, 1u);
+}
+
+TEST(SerialFraming, ResynchronisesAfterJoiningMidStream) {
+    const std::string payload = "payload";
+    const std::string bytes   = frame(payload);
+    // Garbage, including a stray delimiter, then the tail of a frame, then two good frames.
+    const std::string stream = std::string("\x13\x37\0\x42\x42", 5) + bytes.substr(3) + bytes + bytes;
+
+    serial::FrameDecoder decoder;
+    const auto decoded = decode_all(decoder, stream, stream.size());
+    EXPECT_EQ(decoded, (std::vector<std::string>{payload, payload}));
+    EXPECT_GE(decoder.stats().crc_errors + decoder.stats().framing_errors, 2u);
+    EXPECT_GT(decoder.stats().bytes_discarded, 0u);
+}
+
+TEST(SerialFraming, DropsOversizedFramesAndRecovers) {
+    serial::FrameDecoder decoder(16);
+    const std::string stream = frame(std::string(100, 'y')) + frame("ok");
+    const auto decoded       = decode_all(decoder, stream, 5);
+    EXPECT_EQ(decoded, (std::vector<std::string>{"ok"}));
+    EXPECT_EQ(decoder.stats().overruns, 1u);
+}
+
+TEST(SerialFraming, IgnoresIdleDelimitersAndRejectsRunts) {
+    serial::FrameDecoder decoder;
+    const std::string stream = std::string(4, '\0') + std::string("\x03\x01\x02\0", 4) + frame("x");
+    EXPECT_EQ(decode_all(decoder, stream, stream.size()), (std::vector<std::string>{"x"}));
+    EXPECT_EQ(decoder.stats().framing_errors, 1u);
+}
+
+TEST(SerialFraming, ResetDropsPartialFrame) {
+    serial::FrameDecoder decoder;
+    const std::string bytes = frame("hello");
+    std::span<const char> head(bytes.data(), 4);
+    EXPECT_FALSE(decoder.next(head));
+    EXPECT_TRUE(head.empty());
+    decoder.reset();
+    EXPECT_EQ(decode_all(decoder, bytes, bytes.size()), (std::vector<std::string>{"hello"}));
+}
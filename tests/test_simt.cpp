@@ -0,0 +1,116 @@
+// test_simt.cpp - mask popcount parity, warp divergence accounting and occupancy estimates.
+#include "platform/simt.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace simt = platform::simt;
+
+TEST(Simt, SummarizeMasksMatchesNaiveCountPerIsa) {
+    std::mt19937 rng{7};
+    std::vector<std::uint32_t> masks(1037);
+    for (auto &m : masks) {
+        m = rng() % 4 == 0 ? simt::kFullMask : static_cast<std::uint32_t>(rng());
+    }
+    std::uint64_t lanes = 0, full = 0;
+    for (auto m : masks) {
+        for (std::uint32_t v = m; v != 0; v &= v - 1) {
+            ++lanes;
+        }
+        full += m == simt::kFullMask;
+    }
+
+    for (auto isa : {platform::SimdIsa::kScalar, platform::SimdIsa::kSse2, platform::SimdIsa::kAvx2,
+                     platform::SimdIsa::kAvx512, platform::SimdIsa::kNeon}) {
+        if (!platform::simd_isa_supported(isa)) {
+            continue;
+        }
+        const auto stats = simt::summarize_masks(masks, isa);
+        EXPECT_EQ(stats.masks, masks.size()) << platform::to_string(isa);
+        EXPECT_EQ(stats.active_lanes, lanes) << platform::to_string(isa);
+        EXPECT_EQ(stats.full_masks, full) << platform::to_string(isa);
+    }
+
+    const std::vector<std::uint32_t> half{simt::kFullMask, 0u};
+    EXPECT_DOUBLE_EQ(simt::summarize_masks(half).simd_efficiency(), 0.5);
+    EXPECT_EQ(simt::summarize_masks({}).simd_efficiency(), 0.0);
+}
+
+TEST(Simt, UniformKernelHasNoDivergenceAndMasksTailWarp) {
+    std::vector<float> out(40, 0.0f);
+    const auto report = simt::simulate(out.size(), [&](simt::Warp &warp) {
+        warp.step([&](std::size_t t) { out[t] = static_cast<float>(t); });
+    });
+    EXPECT_EQ(report.warps, 2u);
+    ASSERT_EQ(report.masks.size(), 2u);
+    EXPECT_EQ(report.masks[0], simt::kFullMask);
+    EXPECT_EQ(report.masks[1], 0xFFu);
+    EXPECT_EQ(report.divergent_branches, 0u);
+    EXPECT_EQ(report.lanes.active_lanes, 40u);
+    EXPECT_EQ(out[39], 39.0f);
+}
+
+TEST(Simt, EvenOddBranchDivergesEveryWarp) {
+    std::vector<int> path(64, 0);
+    const auto report = simt::simulate(64, [&](simt::Warp &warp) {
+        warp.branch([](std::size_t t) { return t % 2 == 0; },
+                    [&](simt::Warp &w) { w.step([&](std::size_t t) { path[t] = 1; }); },
+                    [&](simt::Warp &w) { w.step([&](std::size_t t) { path[t] = 2; }); });
+    });
+    EXPECT_EQ(report.branches, 2u);
+    EXPECT_EQ(report.divergent_branches, 2u);
+    ASSERT_EQ(report.masks.size(), 6u);
+    EXPECT_EQ(report.masks[1], 0x55555555u);
+    EXPECT_EQ(report.masks[2], 0xAAAAAAAAu);
+    EXPECT_NEAR(report.lanes.simd_efficiency(), 2.0 / 3.0, 1e-12);
+    EXPECT_EQ(path[10], 1);
+    EXPECT_EQ(path[11], 2);
+
+    const auto uniform = simt::simulate(64, [](simt::Warp &warp) {
+        warp.branch([](std::size_t t) { return t < 32; }, [](simt::Warp &w) { w.step([](std::size_t) {}); });
+    });
+    EXPECT_EQ(uniform.divergent_branches, 0u);
+    EXPECT_EQ(uniform.divergence_rate(), 0.0);
+}
+
+TEST(Simt, DataDependentLoopIdlesFinishedLanes) {
+    std::vector<int> trips(32, 0);
+    const auto report = simt::simulate(32, [&](simt::Warp &warp) {
+        warp.loop([&](std::size_t t) { return trips[t] < static_cast<int>(t % 4); },
+                  [&](simt::Warp &w) { w.step([&](std::size_t t) { ++trips[t]; }); });
+    });
+    for (std::size_t t = 0; t < trips.size(); ++t) {
+        EXPECT_EQ(trips[t], static_cast<int>(t % 4));
+    }
+    // Four loop tests and three bodies; lanes with fewer trips sit idle in later iterations.
+    EXPECT_EQ(report.masks.size(), 7u);
+    EXPECT_EQ(report.divergent_branches, 3u);
+    EXPECT_LT(report.lanes.simd_efficiency(), 1.0);
+}
+
+TEST(Simt, OccupancyFollowsTheTightestLimit) {
+    auto occ = simt::estimate_occupancy({.block_threads = 256, .registers_per_thread = 32});
+    EXPECT_EQ(occ.blocks_per_sm, 6u);
+    EXPECT_EQ(occ.limiter, simt::OccupancyLimiter::kWarps);
+    EXPECT_DOUBLE_EQ(occ.occupancy, 1.0);
+
+    occ = simt::estimate_occupancy({.block_threads = 256, .registers_per_thread = 64});
+    EXPECT_EQ(occ.blocks_per_sm, 4u);
+    EXPECT_EQ(occ.limiter, simt::OccupancyLimiter::kRegisters);
+    EXPECT_NEAR(occ.occupancy, 32.0 / 48.0, 1e-12);
+
+    occ = simt::estimate_occupancy(
+        {.block_threads = 128, .registers_per_thread = 32, .shared_bytes_per_block = 48 * 1024});
+    EXPECT_EQ(occ.blocks_per_sm, 2u);
+    EXPECT_EQ(occ.limiter, simt::OccupancyLimiter::kSharedMemory);
+
+    occ = simt::estimate_occupancy({.block_threads = 32, .registers_per_thread = 16});
+    EXPECT_EQ(occ.blocks_per_sm, 16u);
+    EXPECT_EQ(occ.limiter, simt::OccupancyLimiter::kBlocks);
+
+    EXPECT_EQ(simt::estimate_occupancy({.block_threads = 256, .registers_per_thread = 300}).blocks_per_sm, 0u);
+    EXPECT_EQ(simt::estimate_occupancy({.block_threads = 4096}).limiter, simt::OccupancyLimiter::kInvalid);
+}
@@ -0,0 +1,326 @@
+// test_thread_pool.cpp - submission, priority lanes and watermarks, aging, reserved workers, CPU placement,
+// elastic sizing and wait strategies.
+#include "platform/thread_pool.hpp"
+
+#include "platform/cpu_topology.hpp"
+#include "platform/metrics.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+    // Occupies the pool's only worker until release() so tests control the queue depth.
+    class Gate {
+      public:
+        explicit Gate(platform::ThreadPool &pool) {
+            pool.enqueue([this] {
+                started_.store(true);
+                release_.get_future().wait();
+            });
+            while (!started_.load()) {
+                std::this_thread::yield();
+            }
+        }
+        void release() {
+            release_.set_value();
+        }
+
+      private:
+        std::atomic<bool> started_{false};
+        std::promise<void> release_;
+    };
+
+    // Records the order in which queued jobs run.
+    class Trace {
+      public:
+        std::function<void()> job(char tag) {
+            return [this, tag] {
+                std::lock_guard lock(mutex_);
+                order_.push_back(tag);
+            };
+        }
+        std::string wait_for(std::size_t n) {
+            while (true) {
+                {
+                    std::lock_guard lock(mutex_);
+                    if (order_.size() >= n) {
+                        return order_;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+
+      private:
+        std::mutex mutex_;
+        std::string order_;
+    };
+} // namespace
+
+TEST(ThreadPool, RunsEnqueuedJobs) {
+    platform::ThreadPool pool(2, 16);
+    std::atomic<int> ran{0};
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(pool.enqueue([&ran] { ran.fetch_add(1); }));
+    }
+    while (ran.load() < 10) {
+        std::this_thread::yield();
+    }
+    pool.shutdown();
+    EXPECT_FALSE(pool.enqueue([] {}));
+    EXPECT_FALSE(pool.try_enqueue([] {}, platform::JobPriority::kHigh));
+}
+
+TEST(ThreadPool, TryEnqueueAdmitsByPriorityWatermark) {
+    platform::MetricsRegistry registry; // outlives the pool's workers
+    platform::ThreadPool pool(1, 8);
+    pool.bind_metrics(registry, "pool");
+    Gate gate(pool);
+    std::atomic<int> ran{0};
+    auto job = [&ran] { ran.fetch_add(1); };
+
+    auto admitted = [&](platform::JobPriority priority) {
+        int n = 0;
+        while (pool.try_enqueue(job, priority)) {
+            ++n;
+        }
+        return n;
+    };
+    EXPECT_EQ(admitted(platform::JobPriority::kLow), 4);    // up to 1/2 of 8
+    EXPECT_EQ(admitted(platform::JobPriority::kNormal), 2); // up to 3/4
+    EXPECT_EQ(admitted(platform::JobPriority::kHigh), 2);   // the rest
+    EXPECT_FALSE(pool.try_enqueue(job, platform::JobPriority::kHigh));
+    EXPECT_EQ(pool.queue_depth(), 8u);
+    EXPECT_EQ(registry.counter("pool_rejected_total").value(), 4u);
+
+    gate.release();
+    while (ran.load() < 8) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(pool.try_enqueue(job, platform::JobPriority::kLow));
+}
+
+TEST(ThreadPool, TinyQueuesStillAdmitEveryPriority) {
+    platform::ThreadPool pool(1, 1);
+    Gate gate(pool);
+    EXPECT_TRUE(pool.try_enqueue([] {}, platform::JobPriority::kLow));
+    EXPECT_FALSE(pool.try_enqueue([] {}, platform::JobPriority::kHigh));
+    gate.release();
+}
+
+TEST(ThreadPool, StrictLanesServeHighestPriorityFirst) {
+    platform::MetricsRegistry registry;
+    platform::ThreadPool pool(1, 16);
+    pool.bind_metrics(registry, "pool");
+    Gate gate(pool);
+    Trace trace;
+    pool.enqueue(trace.job('l'), platform::JobPriority::kLow);
+    pool.enqueue(trace.job('n'), platform::JobPriority::kNormal);
+    pool.enqueue(trace.job('L'), platform::JobPriority::kLow);
+    pool.enqueue(trace.job('h'), platform::JobPriority::kHigh);
+    gate.release();
+    EXPECT_EQ(trace.wait_for(4), "hnlL");
+
+    const auto snap = registry.snapshot();
+    const auto *high = snap.find_histogram(R"(pool_queue_wait_ns{priority="high"})");
+    const auto *low  = snap.find_histogram(R"(pool_queue_wait_ns{priority="low"})");
+    ASSERT_NE(high, nullptr);
+    ASSERT_NE(low, nullptr);
+    EXPECT_EQ(high->data.count, 1u);
+    EXPECT_EQ(low->data.count, 2u);
+}
+
+TEST(ThreadPool, WeightedLanesShareRoundsByWeight) {
+    platform::ThreadPool pool(1, 32, {.selection = platform::LaneSelection::kWeighted, .weights = {1, 2, 4}});
+    Gate gate(pool);
+    Trace trace;
+    for (int i = 0; i < 6; ++i) {
+        pool.enqueue(trace.job('l'), platform::JobPriority::kLow);
+        pool.enqueue(trace.job('n'), platform::JobPriority::kNormal);
+        pool.enqueue(trace.job('h'), platform::JobPriority::kHigh);
+    }
+    gate.release();
+    // Rounds of four high, two normal and one low until a lane runs dry; the gate job already
+    // spent one normal credit of the first round.
+    EXPECT_EQ(trace.wait_for(18), "hhhhnlhhnnlnnlnlll");
+}
+
+TEST(ThreadPool, AgingServesAStarvedLowJobFirst) {
+    platform::MetricsRegistry registry;
+    platform::ThreadPool pool(1, 16, {.aging = 1ms});
+    pool.bind_metrics(registry, "pool");
+    Gate gate(pool);
+    Trace trace;
+    pool.enqueue(trace.job('l'), platform::JobPriority::kLow);
+    std::this_thread::sleep_for(5ms);
+    pool.enqueue(trace.job('h'), platform::JobPriority::kHigh);
+    pool.enqueue(trace.job('h'), platform::JobPriority::kHigh);
+    gate.release();
+    EXPECT_EQ(trace.wait_for(3), "lhh");
+    EXPECT_EQ(registry.counter("pool_aged_total").value(), 1u);
+}
+
+TEST(ThreadPool, ReservedWorkerRunsHighJobsWhileOthersAreBusy) {
+    platform::ThreadPool pool(2, 16, {.reserved_workers = 1});
+    Gate gate(pool); // holds the only general worker
+    std::atomic<bool> low_ran{false};
+    std::promise<void> high_ran;
+    pool.enqueue([&low_ran] { low_ran.store(true); }, platform::JobPriority::kLow);
+    pool.enqueue([&high_ran] { high_ran.set_value(); }, platform::JobPriority::kHigh);
+    EXPECT_EQ(high_ran.get_future().wait_for(5s), std::future_status::ready);
+    EXPECT_FALSE(low_ran.load());
+    gate.release();
+    while (!low_ran.load()) {
+        std::this_thread::yield();
+    }
+}
+
+TEST(ThreadPool, ReservationAlwaysLeavesAGeneralWorker) {
+    platform::ThreadPool pool(1, 4, {.reserved_workers = 3});
+    std::promise<void> ran;
+    pool.enqueue([&ran] { ran.set_value(); }, platform::JobPriority::kLow);
+    EXPECT_EQ(ran.get_future().wait_for(5s), std::future_status::ready);
+}
+
+TEST(ThreadPool, CorePinningGivesEachWorkerOneAllowedCpu) {
+    const auto &usable = platform::cpu_topology().usable;
+    platform::ThreadPool pool(2, 16, {}, {.pin = platform::PinPolicy::kCore, .name = "tp"});
+    for (std::size_t i = 0; i < pool.thread_count(); ++i) {
+        ASSERT_EQ(pool.worker_cpus(i).size(), 1u);
+        EXPECT_TRUE(std::binary_search(usable.begin(), usable.end(), pool.worker_cpus(i)[0]));
+    }
+    if (usable.size() >= 2) {
+        EXPECT_NE(pool.worker_cpus(0), pool.worker_cpus(1));
+    }
+    std::promise<int> ran_on;
+    pool.enqueue([&ran_on] { ran_on.set_value(platform::current_cpu()); });
+    const int cpu = ran_on.get_future().get();
+#ifdef __linux__
+    EXPECT_TRUE(cpu == pool.worker_cpus(0)[0] || cpu == pool.worker_cpus(1)[0]) << cpu;
+#endif
+    while (pool.pinned_workers() < 2) {
+        std::this_thread::yield();
+    }
+}
+
+TEST(ThreadPool, PlacementHonoursExplicitSetsAndExclusions) {
+    const auto &usable = platform::cpu_topology().usable;
+    platform::ThreadPool explicit_sets(3, 16, {}, {.cpu_sets = {{usable.front()}, usable}});
+    EXPECT_EQ(explicit_sets.worker_cpus(0), std::vector<int>{usable.front()});
+    EXPECT_EQ(explicit_sets.worker_cpus(1), usable);
+    EXPECT_EQ(explicit_sets.worker_cpus(2), std::vector<int>{usable.front()});
+
+    // Excluding every CPU falls back to all of them, which needs no pinning.
+    platform::ThreadPool excluded_all(1, 16, {}, {.exclude = usable, .avoid_isolated = false});
+    EXPECT_TRUE(excluded_all.worker_cpus(0).empty());
+
+    if (usable.size() >= 2) {
+        platform::ThreadPool excluded_first(1, 16, {}, {.exclude = {usable.front()}});
+        const auto &cpus = excluded_first.worker_cpus(0);
+        EXPECT_FALSE(cpus.empty());
+        EXPECT_EQ(std::count(cpus.begin(), cpus.end(), usable.front()), 0);
+    }
+}
+
+TEST(ThreadPool, NumaGroupsPinToNodesAndRunJobs) {
+    const auto &topology = platform::cpu_topology();
+    platform::ThreadPool pool(2, 16, {}, {.numa_groups = true});
+    EXPECT_EQ(pool.group_count(), std::min<std::size_t>(topology.nodes.size(), 2));
+    for (std::size_t i = 0; i < pool.thread_count(); ++i) {
+        EXPECT_FALSE(pool.worker_cpus(i).empty());
+    }
+    std::atomic<int> ran{0};
+    for (int i = 0; i < 8; ++i) {
+        pool.enqueue([&ran] { ran.fetch_add(1); });
+    }
+    while (ran.load() < 8) {
+        std::this_thread::yield();
+    }
+}
+
+// Step load: a burst of 2 ms jobs makes the oldest job wait far beyond the 1 ms target, so the
+// pool grows to its maximum; once the queue drains the extra workers time out and retire back to
+// the initial count; a second step grows it again. Jobs sleep, so this also holds on one CPU.
+TEST(ThreadPool, ElasticPoolFollowsStepLoad) {
+    using Clock = std::chrono::steady_clock;
+    platform::MetricsRegistry registry;
+    platform::ThreadPool pool(1, 512, {}, {},
+                              {.max_threads  = 4,
+                               .target_wait  = 1ms,
+                               .idle_timeout = 30ms,
+                               .interval     = 2ms});
+    pool.bind_metrics(registry, "pool");
+    EXPECT_EQ(pool.thread_count(), 1u);
+    EXPECT_EQ(pool.max_threads(), 4u);
+
+    auto wait_until = [](auto condition) {
+        const auto deadline = Clock::now() + 10s;
+        while (!condition() && Clock::now() < deadline) {
+            std::this_thread::sleep_for(1ms);
+        }
+        return condition();
+    };
+    std::atomic<int> ran{0};
+    auto step = [&](int jobs) {
+        for (int i = 0; i < jobs; ++i) {
+            pool.enqueue([&ran] {
+                std::this_thread::sleep_for(2ms);
+                ran.fetch_add(1);
+            });
+        }
+    };
+
+    step(200);
+    EXPECT_TRUE(wait_until([&] { return pool.thread_count() == 4; }));
+    EXPECT_TRUE(wait_until([&] { return ran.load() == 200; }));
+    EXPECT_TRUE(wait_until([&] { return pool.thread_count() == 1; }));
+    EXPECT_EQ(registry.counter("pool_scale_up_total").value(), 3u);
+    EXPECT_EQ(registry.counter("pool_scale_down_total").value(), 3u);
+
+    step(200);
+    EXPECT_TRUE(wait_until([&] { return pool.thread_count() == 4; }));
+    EXPECT_TRUE(wait_until([&] { return ran.load() == 400; }));
+    EXPECT_TRUE(wait_until([&] { return registry.gauge("pool_workers").value() == 1; }));
+    EXPECT_EQ(registry.counter("pool_scale_up_total").value(), 6u);
+}
+
+TEST(ThreadPool, FixedPoolNeverScales) {
+    platform::ThreadPool pool(2, 16, {}, {}, {.max_threads = 2});
+    EXPECT_EQ(pool.thread_count(), 2u);
+    EXPECT_EQ(pool.max_threads(), 2u);
+}
+
+TEST(ThreadPool, SpinningWorkersRunEveryJobAndShutDown) {
+    using platform::WaitMode;
+    for (const auto mode : {WaitMode::kSpinThenPark, WaitMode::kSpin}) {
+        platform::MetricsRegistry registry;
+        std::atomic<int> ran{0};
+        {
+            platform::ThreadPool pool(2, 64, {.reserved_workers = 1}, {}, {}, {.mode = mode, .spin = 20us});
+            pool.bind_metrics(registry, "pool");
+            for (int i = 0; i < 100; ++i) {
+                const auto priority = i % 3 == 0 ? platform::JobPriority::kHigh : platform::JobPriority::kNormal;
+                ASSERT_TRUE(pool.enqueue([&ran] { ran.fetch_add(1); }, priority));
+                if (i % 25 == 0) {
+                    std::this_thread::sleep_for(1ms);
+                }
+            }
+            while (ran.load() < 100) {
+                std::this_thread::yield();
+            }
+        }
+        EXPECT_EQ(ran.load(), 100) << platform::to_string(mode);
+        EXPECT_GT(registry.snapshot().find_histogram("pool_queue_pop_wait_ns")->data.count, 0u);
+    }
+}
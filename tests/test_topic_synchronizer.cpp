@@ -0,0 +1,113 @@
+// test_topic_synchronizer.cpp - approximate-time matching, tolerance, ordering and buffer limits.
+#include "platform/topic_synchronizer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+    constexpr std::int64_t ms(std::int64_t n) {
+        return n * 1'000'000;
+    }
+
+    struct Recorder {
+        std::vector<std::vector<platform::StampedValue>> tuples;
+
+        platform::TopicSynchronizer::Callback callback() {
+            return [this](std::span<const platform::StampedValue> tuple) {
+                tuples.emplace_back(tuple.begin(), tuple.end());
+            };
+        }
+    };
+} // namespace
+
+TEST(TopicSynchronizer, MatchesSamplesWithinToleranceOnce) {
+    Recorder rec;
+    platform::TopicSynchronizer sync(2, {.tolerance = 5ms}, rec.callback());
+    EXPECT_FALSE(sync.push(0, {ms(0), 1.0}));
+    EXPECT_TRUE(sync.push(1, {ms(3), 2.0}));
+    ASSERT_EQ(rec.tuples.size(), 1u);
+    EXPECT_EQ(rec.tuples[0][0].value, 1.0);
+    EXPECT_EQ(rec.tuples[0][1].timestamp_ns, ms(3));
+    EXPECT_EQ(sync.buffered(0), 0u);
+    EXPECT_EQ(sync.buffered(1), 0u);
+
+    // The topic 0 sample was consumed, so the next topic 1 sample has no partner.
+    EXPECT_FALSE(sync.push(1, {ms(4), 3.0}));
+    EXPECT_EQ(sync.stats().matched, 1u);
+}
+
+TEST(TopicSynchronizer, WaitsWhilePartnersAreOutsideTolerance) {
+    Recorder rec;
+    platform::TopicSynchronizer sync(2, {.tolerance = 5ms}, rec.callback());
+    EXPECT_FALSE(sync.push(0, {ms(0), 1.0}));
+    EXPECT_FALSE(sync.push(1, {ms(10), 2.0}));
+    EXPECT_EQ(sync.buffered(0), 1u);
+    EXPECT_EQ(sync.buffered(1), 1u);
+
+    // Matching the 12 ms sample also drops the stale 0 ms one before it.
+    EXPECT_TRUE(sync.push(0, {ms(12), 3.0}));
+    ASSERT_EQ(rec.tuples.size(), 1u);
+    EXPECT_EQ(rec.tuples[0][0].value, 3.0);
+    EXPECT_EQ(rec.tuples[0][1].value, 2.0);
+    EXPECT_EQ(sync.buffered(0), 0u);
+}
+
+TEST(TopicSynchronizer, PicksTheNearestPartner) {
+    Recorder rec;
+    platform::TopicSynchronizer sync(2, {.tolerance = 5ms}, rec.callback());
+    for (const std::int64_t t : {0, 4, 8, 12}) {
+        sync.push(1, {ms(t), static_cast<double>(t)});
+    }
+    EXPECT_TRUE(sync.push(0, {ms(7), -1.0}));
+    ASSERT_EQ(rec.tuples.size(), 1u);
+    EXPECT_EQ(rec.tuples[0][1].timestamp_ns, ms(8));
+    EXPECT_EQ(sync.buffered(1), 1u);
+}
+
+TEST(TopicSynchronizer, RejectsOutOfOrderSamples) {
+    platform::TopicSynchronizer sync(2, {}, nullptr);
+    sync.push(0, {ms(10), 1.0});
+    EXPECT_FALSE(sync.push(0, {ms(5), 1.0}));
+    EXPECT_EQ(sync.stats().out_of_order, 1u);
+    EXPECT_EQ(sync.buffered(0), 1u);
+}
+
+TEST(TopicSynchronizer, EvictsOldestWhenFull) {
+    // Capacity rounds up to a power of two.
+    platform::TopicSynchronizer sync(2, {.tolerance = 1ms, .capacity = 3}, nullptr);
+    for (std::int64_t t = 0; t < 6; ++t) {
+        sync.push(0, {ms(t * 10), 0.0});
+    }
+    EXPECT_EQ(sync.buffered(0), 4u);
+    EXPECT_EQ(sync.stats().overflowed, 2u);
+
+    // The evicted 0 ms and 10 ms samples are gone; 20 ms is now the oldest.
+    EXPECT_FALSE(sync.push(1, {ms(10), 0.0}));
+    EXPECT_TRUE(sync.push(1, {ms(20), 0.0}));
+}
+
+TEST(TopicSynchronizer, AlignsManyTopics) {
+    constexpr std::size_t kTopics = 8;
+    constexpr int kRounds         = 50;
+    Recorder rec;
+    platform::TopicSynchronizer sync(kTopics, {.tolerance = 2ms}, rec.callback());
+    for (int round = 0; round < kRounds; ++round) {
+        for (std::size_t topic = 0; topic < kTopics; ++topic) {
+            const std::int64_t t = ms(round * 10) + static_cast<std::int64_t>(topic) * 100'000;
+            sync.push(topic, {t, static_cast<double>(round)});
+        }
+    }
+    ASSERT_EQ(rec.tuples.size(), static_cast<std::size_t>(kRounds));
+    for (int round = 0; round < kRounds; ++round) {
+        ASSERT_EQ(rec.tuples[round].size(), kTopics);
+        for (const auto &sample : rec.tuples[round]) {
+            EXPECT_EQ(sample.value, static_cast<double>(round));
+        }
+    }
+    EXPECT_EQ(sync.stats().overflowed, 0u);
+}
@@ -0,0 +1,49 @@
+// test_wait_strategy.cpp - spin budgets, stop requests and wait mode names.
+#include "platform/wait_strategy.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST(WaitStrategy, BlockNeverSpinsAndSpinThenParkGivesUpAfterItsBudget) {
+    int polls = 0;
+    auto never = [&polls] {
+        ++polls;
+        return false;
+    };
+    EXPECT_FALSE(platform::spin_until({.mode = platform::WaitMode::kBlock}, {}, never));
+    EXPECT_EQ(polls, 0);
+
+    const auto started = std::chrono::steady_clock::now();
+    EXPECT_FALSE(platform::spin_until({.mode = platform::WaitMode::kSpinThenPark, .spin = 200us}, {}, never));
+    EXPECT_GE(std::chrono::steady_clock::now() - started, 200us);
+    EXPECT_GT(polls, 0);
+}
+
+TEST(WaitStrategy, SpinWaitsForReadyOrStop) {
+    std::atomic<bool> ready{false};
+    std::jthread setter([&ready] {
+        std::this_thread::sleep_for(1ms);
+        ready.store(true);
+    });
+    EXPECT_TRUE(platform::spin_until({.mode = platform::WaitMode::kSpin}, {}, [&ready] { return ready.load(); }));
+
+    std::stop_source stop;
+    std::jthread stopper([&stop] {
+        std::this_thread::sleep_for(1ms);
+        stop.request_stop();
+    });
+    EXPECT_FALSE(platform::spin_until({.mode = platform::WaitMode::kSpin}, stop.get_token(), [] { return false; }));
+}
+
+TEST(WaitStrategy, ModeNamesRoundTrip) {
+    using platform::WaitMode;
+    for (const auto mode : {WaitMode::kBlock, WaitMode::kSpinThenPark, WaitMode::kSpin}) {
+        EXPECT_EQ(platform::parse_wait_mode(platform::to_string(mode)), mode);
+    }
+    EXPECT_FALSE(platform::parse_wait_mode("busy"));
+}
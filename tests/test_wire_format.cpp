@@ -0,0 +1,125 @@
+// test_wire_format.cpp - binary record layout, round trips, versioning and format detection.
+#include "platform/wire_format.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace wire = platform::wire;
+
+TEST(WireFormat, SensorSampleRoundTripsInPlace) {
+    const std::string payload = wire::sensor_sample_payload("imu", 1.25, 123'456'789'000, 42);
+    ASSERT_EQ(payload.size(), sizeof(wire::SensorSampleRecord));
+    EXPECT_TRUE(wire::is_binary(payload));
+
+    const auto view = wire::SensorSampleView::from(payload);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->version(), wire::kVersion);
+    EXPECT_EQ(view->sequence(), 42u);
+    EXPECT_EQ(view->timestamp_ns(), 123'456'789'000);
+    EXPECT_EQ(view->value(), 1.25);
+    EXPECT_EQ(view->name(), "imu");
+
+    // The wire bytes are little-endian at the documented offsets.
+    EXPECT_EQ(static_cast<std::uint8_t>(payload[4]), 48u);
+    EXPECT_EQ(static_cast<std::uint8_t>(payload[8]), 42u);
+    EXPECT_EQ(payload.substr(32, 4), std::string("imu\0", 4));
+}
+
+TEST(WireFormat, ControlCommandRoundTrips) {
+    const std::string payload = wire::control_command_payload(-0.5, 7, 3);
+    const auto view           = wire::ControlCommandView::from(payload);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->effort(), -0.5);
+    EXPECT_EQ(view->timestamp_ns(), 7);
+    EXPECT_EQ(view->sequence(), 3u);
+    EXPECT_FALSE(wire::SensorSampleView::from(payload));
+}
+
+TEST(WireFormat, RejectsMalformedRecords) {
+    std::string payload = wire::sensor_sample_payload("imu", 1.0, 0);
+    EXPECT_FALSE(wire::SensorSampleView::from(std::string_view(payload).substr(0, 40)));
+
+    std::string bad_magic = payload;
+    bad_magic[0]          = 'i';
+    EXPECT_FALSE(wire::SensorSampleView::from(bad_magic));
+
+    std::string bad_size = payload;
+    bad_size[4]          = 64; // claims more bytes than present
+    EXPECT_FALSE(wire::SensorSampleView::from(bad_size));
+
+    EXPECT_TRUE(wire::sensor_sample_payload("a_sensor_name_too_long", 1.0, 0).empty());
+    char small[16];
+    EXPECT_EQ(wire::encode_control_command(small, 1.0, 0), 0u);
+}
+
+TEST(WireFormat, NewerVersionsWithAppendedFieldsStillDecode) {
+    std::string payload = wire::sensor_sample_payload("lidar", 2.0, 5);
+    payload[2]          = 2;
+    payload[4]          = 56;
+    payload.append(8, '\x7f');
+    const auto view = wire::SensorSampleView::from(payload);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->version(), 2u);
+    EXPECT_EQ(view->value(), 2.0);
+    EXPECT_EQ(view->name(), "lidar");
+}
+
+TEST(WireFormat, TextPayloadsAreNotBinary) {
+    EXPECT_FALSE(wire::is_binary("imu:1.000000"));
+    EXPECT_FALSE(wire::is_binary("0.500000"));
+    EXPECT_FALSE(wire::is_binary(""));
+}
+
+TEST(WireFormat, TextNumbersRoundTripExactly) {
+    std::mt19937_64 rng{11};
+    std::vector<double> values{0.0,
+                               -0.0,
+                               1.0,
+                               0.1,
+                               1.0 / 3.0,
+                               std::numeric_limits<double>::max(),
+                               std::numeric_limits<double>::lowest(),
+                               std::numeric_limits<double>::min(),
+                               std::numeric_limits<double>::denorm_min()};
+    while (values.size() < 10'000) {
+        const double v = std::bit_cast<double>(rng());
+        if (std::isfinite(v)) {
+            values.push_back(v);
+        }
+    }
+    char buf[wire::kMaxNumberChars];
+    for (const double v : values) {
+        const std::size_t n = wire::format_number(buf, v);
+        ASSERT_GT(n, 0u);
+        const auto parsed = wire::parse_number(std::string_view(buf, n));
+        ASSERT_TRUE(parsed) << std::string_view(buf, n);
+        EXPECT_EQ(std::bit_cast<std::uint64_t>(*parsed), std::bit_cast<std::uint64_t>(v)) << std::string_view(buf, n);
+    }
+}
+
+TEST(WireFormat, SensorTextRoundTripsAndRejectsGarbage) {
+    char buf[wire::kMaxSensorTextChars];
+    const std::size_t n = wire::format_sensor_text(buf, "imu", 1.0123456789);
+    EXPECT_EQ(std::string_view(buf, n), "imu:1.0123456789");
+    const auto text = wire::parse_sensor_text(std::string_view(buf, n));
+    ASSERT_TRUE(text);
+    EXPECT_EQ(text->name, "imu");
+    EXPECT_EQ(text->value, 1.0123456789);
+
+    // Existing producers' std::to_string output still parses.
+    EXPECT_EQ(wire::parse_sensor_text("imu:1.000000")->value, 1.0);
+    EXPECT_FALSE(wire::parse_sensor_text("imu1.0"));
+    EXPECT_FALSE(wire::parse_sensor_text("imu:"));
+    EXPECT_FALSE(wire::parse_sensor_text("imu:1.0x"));
+    EXPECT_FALSE(wire::parse_number(" 1.0"));
+    EXPECT_EQ(wire::format_sensor_text(buf, "a:b", 1.0), 0u);
+    char tiny[4];
+    EXPECT_EQ(wire::format_number(tiny, 0.123456), 0u);
+}
@@ -0,0 +1,404 @@
+#include "bench_compare.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <map>
+#include <numeric>
+
+namespace bench_compare {
+
+    namespace {
+        // Just enough JSON for Google Benchmark output: objects, arrays, strings, numbers, literals.
+        struct JsonValue {
+            enum class Kind { kNull, kBool, kNumber, kString, kArray, kObject };
+            Kind kind{Kind::kNull};
+            bool boolean{false};
+            double number{0.0};
+            std::string string;
+            std::vector<JsonValue> items;
+            std::vector<std::string> keys; // Parallel to `items` for objects.
+
+            const JsonValue *find(std::string_view key) const {
+                for (std::size_t i = 0; i < keys.size(); ++i) {
+                    if (keys[i] == key) {
+                        return &items[i];
+                    }
+                }
+                return nullptr;
+            }
+        };
+
+        class JsonParser {
+          public:
+            explicit JsonParser(std::string_view text) : text_(text) {}
+
+            std::optional<JsonValue> parse(std::string *error) {
+                JsonValue value;
+                skip_ws();
+                if (!parse_value(value, 0) || (skip_ws(), pos_ != text_.size())) {
+                    if (error != nullptr) {
+                        *error = "invalid JSON near offset " + std::to_string(pos_);
+                    }
+                    return std::nullopt;
+                }
+                return value;
+            }
+
+          private:
+            static constexpr int kMaxDepth = 64;
+
+            void skip_ws() {
+                while (pos_ < text_.size() &&
+                       (text_[pos_] == ' ' || text_[pos_] == '\n' || text_[pos_] == '\r' || text_[pos_] == '\t')) {
+                    ++pos_;
+                }
+            }
+
+            bool consume(char c) {
+                skip_ws();
+                if (pos_ < text_.size() && text_[pos_] == c) {
+                    ++pos_;
+                    return true;
+                }
+                return false;
+            }
+
+            bool parse_literal(std::string_view literal) {
+                if (text_.substr(pos_, literal.size()) != literal) {
+                    return false;
+                }
+                pos_ += literal.size();
+                return true;
+            }
+
+            bool parse_string(std::string &out) {
+                if (!consume('"')) {
+                    return false;
+                }
+                while (pos_ < text_.size()) {
+                    const char c = text_[pos_++];
+                    if (c == '"') {
+                        return true;
+                    }
+                    if (c != '\\') {
+                        out += c;
+                        continue;
+                    }
+                    if (pos_ >= text_.size()) {
+                        return false;
+                    }
+                    const char esc = text_[pos_++];
+                    switch (esc) {
+                    case 'n':
+                        out += '\n';
+                        break;
+                    case 't':
+                        out += '\t';
+                        break;
+                    case 'r':
+                        out += '\r';
+                        break;
+                    case 'b':
+                        out += '\b';
+                        break;
+                    case 'f':
+                        out += '\f';
+                        break;
+                    case 'u':
+                        // Benchmark names are ASCII; keep the escape verbatim rather than transcoding.
+                        if (pos_ + 4 > text_.size()) {
+                            return false;
+                        }
+                        out += "\\u";
+                        out += text_.substr(pos_, 4);
+                        pos_ += 4;
+                        break;
+                    default:
+                        out += esc;
+                        break;
+                    }
+                }
+                return false;
+            }
+
+            bool parse_number(double &out) {
+                const char *begin = text_.data() + pos_;
+                const char *end   = text_.data() + text_.size();
+                auto [ptr, ec]    = std::from_chars(begin, end, out);
+                if (ec != std::errc{}) {
+                    return false;
+                }
+                pos_ += static_cast<std::size_t>(ptr - begin);
+                return true;
+            }
+
+            bool parse_value(JsonValue &value, int depth) {
+                if (depth > kMaxDepth) {
+                    return false;
+                }
+                skip_ws();
+                if (pos_ >= text_.size()) {
+                    return false;
+                }
+                const char c = text_[pos_];
+                if (c == '{') {
+                    ++pos_;
+                    value.kind = JsonValue::Kind::kObject;
+                    if (consume('}')) {
+                        return true;
+                    }
+                    do {
+                        std::string key;
+                        JsonValue item;
+                        if (!parse_string(key) || !consume(':') || !parse_value(item, depth + 1)) {
+                            return false;
+                        }
+                        value.keys.push_back(std::move(key));
+                        value.items.push_back(std::move(item));
+                    } while (consume(','));
+                    return consume('}');
+                }
+                if (c == '[') {
+                    ++pos_;
+                    value.kind = JsonValue::Kind::kArray;
+                    if (consume(']')) {
+                        return true;
+                    }
+                    do {
+                        JsonValue item;
+                        if (!parse_value(item, depth + 1)) {
+                            return false;
+                        }
+                        value.items.push_back(std::move(item));
+                    } while (consume(','));
+                    return consume(']');
+                }
+                if (c == '"') {
+                    value.kind = JsonValue::Kind::kString;
+                    return parse_string(value.string);
+                }
+                if (c == 't' || c == 'f') {
+                    value.kind    = JsonValue::Kind::kBool;
+                    value.boolean = c == 't';
+                    return parse_literal(c == 't' ? "true" : "false");
+                }
+                if (c == 'n') {
+                    return parse_literal("null");
+                }
+                value.kind = JsonValue::Kind::kNumber;
+                return parse_number(value.number);
+            }
+
+            std::string_view text_;
+            std::size_t pos_{0};
+        };
+
+        double unit_to_ns(std::string_view unit) {
+            if (unit == "us") {
+                return 1e3;
+            }
+            if (unit == "ms") {
+                return 1e6;
+            }
+            if (unit == "s") {
+                return 1e9;
+            }
+            return 1.0;
+        }
+
+        std::string_view string_field(const JsonValue &obj, std::string_view key) {
+            const auto *v = obj.find(key);
+            return v != nullptr && v->kind == JsonValue::Kind::kString ? std::string_view(v->string)
+                                                                       : std::string_view{};
+        }
+
+        // Exact two-sided p-value from the distribution of U for tie-free samples.
+        double exact_p_value(std::size_t n1, std::size_t n2, double u) {
+            const std::size_t max_u = n1 * n2;
+            // ways[i][j][k]: orderings of i + j values with U == k.
+            std::vector<std::vector<std::vector<double>>> ways(
+                n1 + 1, std::vector<std::vector<double>>(n2 + 1, std::vector<double>(max_u + 1, 0.0)));
+            for (std::size_t i = 0; i <= n1; ++i) {
+                for (std::size_t j = 0; j <= n2; ++j) {
+                    if (i == 0 || j == 0) {
+                        ways[i][j][0] = 1.0;
+                        continue;
+                    }
+                    for (std::size_t k = 0; k <= i * j; ++k) {
+                        ways[i][j][k] = (k >= j ? ways[i - 1][j][k - j] : 0.0) + ways[i][j - 1][k];
+                    }
+                }
+            }
+            const double total = std::accumulate(ways[n1][n2].begin(), ways[n1][n2].end(), 0.0);
+            const auto k       = static_cast<std::size_t>(u);
+            double lower       = 0.0;
+            for (std::size_t i = 0; i <= k; ++i) {
+                lower += ways[n1][n2][i];
+            }
+            double upper = 0.0;
+            for (std::size_t i = k; i <= max_u; ++i) {
+                upper += ways[n1][n2][i];
+            }
+            return std::min(1.0, 2.0 * std::min(lower, upper) / total);
+        }
+    } // namespace
+
+    std::optional<std::vector<BenchmarkSamples>> parse_benchmark_json(std::string_view json, std::string_view metric,
+                                                                      std::string *error) {
+        auto root = JsonParser(json).parse(error);
+        if (!root) {
+            return std::nullopt;
+        }
+        const auto *benchmarks = root->find("benchmarks");
+        if (benchmarks == nullptr || benchmarks->kind != JsonValue::Kind::kArray) {
+            if (error != nullptr) {
+                *error = "missing \"benchmarks\" array";
+            }
+            return std::nullopt;
+        }
+        std::vector<BenchmarkSamples> out;
+        std::map<std::string, std::size_t, std::less<>> index;
+        for (const auto &entry : benchmarks->items) {
+            if (entry.kind != JsonValue::Kind::kObject) {
+                continue;
+            }
+            const auto run_type = string_field(entry, "run_type");
+            if (!run_type.empty() && run_type != "iteration") {
+                continue;
+            }
+            if (const auto *skipped = entry.find("error_occurred"); skipped != nullptr && skipped->boolean) {
+                continue;
+            }
+            auto name = string_field(entry, "run_name");
+            if (name.empty()) {
+                name = string_field(entry, "name");
+            }
+            const auto *value = entry.find(metric);
+            if (name.empty() || value == nullptr || value->kind != JsonValue::Kind::kNumber) {
+                continue;
+            }
+            auto it = index.find(name);
+            if (it == index.end()) {
+                it = index.emplace(std::string(name), out.size()).first;
+                out.push_back({std::string(name), {}});
+            }
+            out[it->second].values.push_back(value->number * unit_to_ns(string_field(entry, "time_unit")));
+        }
+        return out;
+    }
+
+    double mann_whitney_p_value(std::span<const double> a, std::span<const double> b) {
+        const std::size_t n1 = a.size();
+        const std::size_t n2 = b.size();
+        if (n1 == 0 || n2 == 0) {
+            return 1.0;
+        }
+        struct Ranked {
+            double value;
+            bool from_a;
+        };
+        std::vector<Ranked> all;
+        all.reserve(n1 + n2);
+        for (double v : a) {
+            all.push_back({v, true});
+        }
+        for (double v : b) {
+            all.push_back({v, false});
+        }
+        std::sort(all.begin(), all.end(), [](const Ranked &x, const Ranked &y) { return x.value < y.value; });
+
+        // Average ranks over ties and accumulate the tie correction term sum(t^3 - t).
+        double rank_sum_a = 0.0;
+        double tie_term   = 0.0;
+        for (std::size_t i = 0; i < all.size();) {
+            std::size_t j = i;
+            while (j < all.size() && all[j].value == all[i].value) {
+                ++j;
+            }
+            const double avg_rank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.0;
+            const auto t          = static_cast<double>(j - i);
+            tie_term += t * t * t - t;
+            for (std::size_t k = i; k < j; ++k) {
+                if (all[k].from_a) {
+                    rank_sum_a += avg_rank;
+                }
+            }
+            i = j;
+        }
+        const double d1 = static_cast<double>(n1);
+        const double d2 = static_cast<double>(n2);
+        const double u  = rank_sum_a - d1 * (d1 + 1.0) / 2.0;
+
+        constexpr std::size_t kExactLimit = 20;
+        if (tie_term == 0.0 && n1 <= kExactLimit && n2 <= kExactLimit) {
+            return exact_p_value(n1, n2, u);
+        }
+        const double n     = d1 + d2;
+        const double mean  = d1 * d2 / 2.0;
+        const double var   = d1 * d2 / 12.0 * ((n + 1.0) - tie_term / (n * (n - 1.0)));
+        if (var <= 0.0) {
+            return 1.0;
+        }
+        const double z = (std::abs(u - mean) - 0.5) / std::sqrt(var);
+        return std::min(1.0, std::erfc(std::max(z, 0.0) / std::sqrt(2.0)));
+    }
+
+    double median(std::vector<double> values) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        const auto mid = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+        std::nth_element(values.begin(), mid, values.end());
+        if (values.size() % 2 == 1) {
+            return *mid;
+        }
+        const double upper = *mid;
+        const double lower = *std::max_element(values.begin(), mid);
+        return (lower + upper) / 2.0;
+    }
+
+    std::vector<Comparison> compare(const std::vector<BenchmarkSamples> &baseline,
+                                    const std::vector<BenchmarkSamples> &candidate, const CompareOptions &options) {
+        std::vector<Comparison> out;
+        for (const auto &base : baseline) {
+            Comparison cmp{.name = base.name, .baseline_median = median(base.values)};
+            auto it = std::find_if(candidate.begin(), candidate.end(),
+                                   [&](const BenchmarkSamples &c) { return c.name == base.name; });
+            if (it == candidate.end() || it->values.empty() || base.values.empty()) {
+                cmp.verdict = Verdict::kMissing;
+                out.push_back(std::move(cmp));
+                continue;
+            }
+            cmp.candidate_median = median(it->values);
+            cmp.relative_change  = cmp.baseline_median > 0.0
+                                       ? (cmp.candidate_median - cmp.baseline_median) / cmp.baseline_median
+                                       : 0.0;
+            cmp.tested = base.values.size() >= options.min_repetitions && it->values.size() >= options.min_repetitions;
+            cmp.p_value      = cmp.tested ? mann_whitney_p_value(base.values, it->values) : 1.0;
+            const bool significant = !cmp.tested || cmp.p_value < options.alpha;
+            if (significant && cmp.relative_change > options.threshold) {
+                cmp.verdict = Verdict::kRegressed;
+            } else if (significant && cmp.relative_change < -options.threshold) {
+                cmp.verdict = Verdict::kImproved;
+            }
+            out.push_back(std::move(cmp));
+        }
+        return out;
+    }
+
+    const char *to_string(Verdict verdict) {
+        switch (verdict) {
+        case Verdict::kUnchanged:
+            return "ok";
+        case Verdict::kImproved:
+            return "improved";
+        case Verdict::kRegressed:
+            return "REGRESSED";
+        case Verdict::kMissing:
+            return "missing";
+        }
+        return "unknown";
+    }
+
+} // namespace bench_compare
@@ -0,0 +1,57 @@
+// bench_compare.hpp - Google Benchmark JSON comparison with Mann-Whitney significance testing.
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bench_compare {
+
+    // Per-repetition samples for one benchmark run, normalised to nanoseconds.
+    struct BenchmarkSamples {
+        std::string name;
+        std::vector<double> values;
+    };
+
+    // Parses `--benchmark_format=json` / `--benchmark_out` output and collects the chosen metric
+    // (`real_time` or `cpu_time`) of every iteration run, grouped by run name. Aggregate rows
+    // (mean/median/stddev) are ignored. Returns std::nullopt and fills `error` on malformed input.
+    std::optional<std::vector<BenchmarkSamples>> parse_benchmark_json(std::string_view json, std::string_view metric,
+                                                                      std::string *error = nullptr);
+
+    // Two-sided Mann-Whitney U test p-value. Exact for small tie-free samples, otherwise the
+    // tie-corrected normal approximation with continuity correction. Returns 1 for empty input.
+    double mann_whitney_p_value(std::span<const double> a, std::span<const double> b);
+
+    double median(std::vector<double> values);
+
+    struct CompareOptions {
+        // Relative slowdown of the median (0.05 = 5%) tolerated before a run counts as a regression.
+        double threshold{0.05};
+        // Significance level for the Mann-Whitney test.
+        double alpha{0.05};
+        // Below this many repetitions per side the test cannot reach significance, so only the
+        // threshold is applied.
+        std::size_t min_repetitions{3};
+    };
+
+    enum class Verdict { kUnchanged, kImproved, kRegressed, kMissing };
+
+    struct Comparison {
+        std::string name;
+        double baseline_median{0.0};
+        double candidate_median{0.0};
+        double relative_change{0.0};
+        double p_value{1.0};
+        bool tested{false};
+        Verdict verdict{Verdict::kUnchanged};
+    };
+
+    std::vector<Comparison> compare(const std::vector<BenchmarkSamples> &baseline,
+                                    const std::vector<BenchmarkSamples> &candidate, const CompareOptions &options);
+
+    const char *to_string(Verdict verdict);
+
+} // namespace bench_compare
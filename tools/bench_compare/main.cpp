@@ -0,0 +1,98 @@
+// platform_bench_compare - fails (exit 1) when a candidate benchmark run regresses against a baseline.
+//
+// Usage: platform_bench_compare [--metric real_time|cpu_time] [--threshold 0.05] [--alpha 0.05]
+//                               [--min-repetitions 3] baseline.json candidate.json
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "bench_compare.hpp"
+
+namespace {
+    constexpr int kExitOk         = 0;
+    constexpr int kExitRegression = 1;
+    constexpr int kExitUsage      = 2;
+
+    bool read_file(const std::string &path, std::string &out) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            return false;
+        }
+        std::ostringstream ss;
+        ss << in.rdbuf();
+        out = ss.str();
+        return true;
+    }
+
+    int usage(const char *argv0) {
+        std::cerr << "usage: " << argv0
+                  << " [--metric real_time|cpu_time] [--threshold F] [--alpha F] [--min-repetitions N]"
+                     " baseline.json candidate.json\n";
+        return kExitUsage;
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench_compare::CompareOptions options;
+    std::string metric = "real_time";
+    std::string paths[2];
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const bool has_value       = i + 1 < argc;
+        if (arg == "--metric" && has_value) {
+            metric = argv[++i];
+        } else if (arg == "--threshold" && has_value) {
+            options.threshold = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--alpha" && has_value) {
+            options.alpha = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--min-repetitions" && has_value) {
+            options.min_repetitions = std::strtoul(argv[++i], nullptr, 10);
+        } else if (!arg.starts_with("--") && positional < 2) {
+            paths[positional++] = std::string(arg);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (positional != 2) {
+        return usage(argv[0]);
+    }
+
+    std::vector<bench_compare::BenchmarkSamples> runs[2];
+    for (int i = 0; i < 2; ++i) {
+        std::string text;
+        std::string error;
+        if (!read_file(paths[i], text)) {
+            std::cerr << "cannot read " << paths[i] << '\n';
+            return kExitUsage;
+        }
+        auto parsed = bench_compare::parse_benchmark_json(text, metric, &error);
+        if (!parsed) {
+            std::cerr << paths[i] << ": " << error << '\n';
+            return kExitUsage;
+        }
+        runs[i] = std::move(*parsed);
+    }
+
+    const auto results = bench_compare::compare(runs[0], runs[1], options);
+    int regressions    = 0;
+    std::printf("%-60s %14s %14s %9s %9s  %s\n", "benchmark", "baseline_ns", "candidate_ns", "change", "p", "verdict");
+    for (const auto &r : results) {
+        std::printf("%-60s %14.1f %14.1f %+8.1f%% %9.4f  %s%s\n", r.name.c_str(), r.baseline_median,
+                    r.candidate_median, 100.0 * r.relative_change, r.p_value, bench_compare::to_string(r.verdict),
+                    r.tested || r.verdict == bench_compare::Verdict::kMissing ? "" : " (threshold only)");
+        if (r.verdict == bench_compare::Verdict::kRegressed) {
+            ++regressions;
+        }
+    }
+    if (regressions > 0) {
+        std::printf("%d benchmark(s) regressed beyond %.1f%% (alpha %.3f)\n", regressions, 100.0 * options.threshold,
+                    options.alpha);
+        return kExitRegression;
+    }
+    return kExitOk;
+}